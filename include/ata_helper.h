@@ -406,6 +406,14 @@ extern "C"
         ATA_PT_LEN_TPSIU
     }eATAPassthroughLength;
 
+    //Controls when a passthrough layer may issue additional commands (results log, return response info, request sense) to complete the RTFRs of a command.
+    typedef enum _eATAPassthroughRTFRPolicy
+    {
+        ATA_RTFR_POLICY_ALWAYS,//default. Always try to get the complete RTFRs
+        ATA_RTFR_POLICY_ON_ERROR,//only go after complete RTFRs when the command reports an error. Meant for bulk reads/writes where nobody looks at the registers on success
+        ATA_RTFR_POLICY_NEVER,//only use what comes back with the command itself
+    }eATAPassthroughRTFRPolicy;
+
 // \struct typedef struct _ataPassthroughCommand
     typedef struct _ataPassthroughCommand
     {
@@ -424,6 +432,7 @@ extern "C"
         uint8_t                         multipleCount;//This is the exponent value specifying the number of sectors used in a read/write multiple command transfer. All other commands should leave this at zero. This ONLY matters on read/write multiple commands, if this is nonzero on any other command, it will fail. Only bits 0:2 are valid (SAT limitation)
         bool                            forceCheckConditionBit;//Set this to force setting the check condition bit on a command. This is here because by default,only non-data gets this bit due to some weird chipsets. This is an override that can be used in certain commands.
         uint8_t                         forceCDBSize;//only set this if you want to force a specific SAT passthrough CDB size (12B, 16B, or 32B). Bad parameter may be returned if setting registers in a command that cannot be set in the specified SAT CDB
+        eATAPassthroughRTFRPolicy       rtfrPolicy;//When follow up commands may be used to retrieve RTFRs. Zero (memset) keeps the default of always.
     } ataPassthroughCommand;
 
     //added these packs to make sure this structure gets interpreted correctly
@@ -178,6 +178,26 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_TRANSPORT_API int ata_Read_Log_Ext(tDevice *device, uint8_t logAddress, uint16_t pageNumber, uint8_t *ptrData, uint32_t dataSize, bool useDMA, uint16_t featureRegister);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  ata_Read_Log_Ext_Cached()
+    //
+    //! \brief   Description:  Same as ata_Read_Log_Ext with a feature register of 0, but uses the device log cache (see set_Device_Log_Cache_TTL).
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] logAddress = the log address to be read
+    //!   \param[in] pageNumber = the page of the log you wish to retrieve
+    //!   \param[out] ptrData = pointer to the data buffer that will be filled in upon successful command completion
+    //!   \param[in] dataSize = value describing the size of the buffer that will be filled in
+    //!   \param[in] useDMA = use the DMA command instead of the PIO command
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, !SUCCESS = something when wrong
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int ata_Read_Log_Ext_Cached(tDevice *device, uint8_t logAddress, uint16_t pageNumber, uint8_t *ptrData, uint32_t dataSize, bool useDMA);
+
     //-----------------------------------------------------------------------------
     //
     //  ata_Write_Log_Ext()
@@ -126,6 +126,114 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_TRANSPORT_API int fill_Drive_Info_Data(tDevice *device);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  set_Discovery_Cache_File()
+    //
+    //! \brief   Description:  Sets the file used to remember discovered device information between scans.
+    //!                         Devices opened with the DISCOVERY_CACHE flag look up a record here keyed by handle, interface and adapter IDs.
+    //!                         A record is only used when the device's identify/inquiry/capacity data still hashes to the stored value.
+    //!                         The cache is disabled until a file is set.
+    //
+    //  Entry:
+    //!   \param path - path to the cache file. NULL disables the cache.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, BAD_PARAMETER = path is too long
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int set_Discovery_Cache_File(const char *path);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  clear_Discovery_Cache()
+    //
+    //! \brief   Description:  Removes the discovery cache file so that all devices are fully discovered on the next scan.
+    //
+    //  Entry:
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, NOT_SUPPORTED = no cache file set, FAILURE = could not remove the file
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int clear_Discovery_Cache(void);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_Drive_Info_Data_With_Cache()
+    //
+    //! \brief   Description:  Same as fill_Drive_Info_Data, but uses the discovery cache when the DISCOVERY_CACHE flag is set.
+    //!                         On a cache hit only the validation commands are sent. On a miss full discovery is run and a record is added to the cache.
+    //!                         Call this from the OS layer only after the handle, interface type and adapter information are set.
+    //
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, !SUCCESS = something when wrong
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int fill_Drive_Info_Data_With_Cache(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  complete_Drive_Info_Data()
+    //
+    //! \brief   Description:  Finishes discovery for a device that only has the identity tier of driveInfo filled in (LAZY_DISCOVERY, FAST_SCAN or DO_NOT_WAKE_DRIVE).
+    //!                         Does nothing if discovery is already complete. The library only calls this on its own for LAZY_DISCOVERY devices (see complete_Lazy_Drive_Info_Data).
+    //!                         Devices opened with FAST_SCAN or DO_NOT_WAKE_DRIVE are only completed when the caller asks, since discovery may touch the media and spin up the drive.
+    //
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, !SUCCESS = something when wrong
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int complete_Drive_Info_Data(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  complete_Lazy_Drive_Info_Data()
+    //
+    //! \brief   Description:  Calls complete_Drive_Info_Data only when the device was opened with LAZY_DISCOVERY and discovery is not complete yet.
+    //!                         This is called automatically by the library functions that use capacity, block size or other complete tier data
+    //!                         (reads, writes, verifies, write same, uncorrectables, synchronize cache, deallocate, firmware download, zone map, the get_Drive_Info_ accessors)
+    //!                         and by the SAT and NVMe software translators for commands that use capacity or block size. Code reading driveInfo directly must call it first.
+    //
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass or nothing to do, !SUCCESS = something when wrong
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int complete_Lazy_Drive_Info_Data(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Drive_Info_Max_LBA()
+    //  get_Drive_Info_Logical_Block_Size()
+    //  get_Drive_Info_Physical_Block_Size()
+    //  get_Drive_Info_Zoned_Type()
+    //
+    //! \brief   Description:  Accessors for driveInfo fields that are not part of the identity tier. Discovery is completed on first use for LAZY_DISCOVERY devices.
+    //
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!
+    //  Exit:
+    //!   \return requested value
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API uint64_t get_Drive_Info_Max_LBA(tDevice *device);
+
+    OPENSEA_TRANSPORT_API uint32_t get_Drive_Info_Logical_Block_Size(tDevice *device);
+
+    OPENSEA_TRANSPORT_API uint32_t get_Drive_Info_Physical_Block_Size(tDevice *device);
+
+    OPENSEA_TRANSPORT_API eZonedDeviceType get_Drive_Info_Zoned_Type(tDevice *device);
+
     typedef enum _eDownloadMode
     {
         DL_FW_ACTIVATE,
@@ -286,6 +394,9 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_TRANSPORT_API int write_Flagged_Uncorrectable_Error(tDevice *device, uint64_t corruptLBA);
 
+    //Smallest read_LBA/write_LBA transfer sent through os_Read/os_Write when the device was opened with OS_BLOCK_IO_FOR_LARGE_TRANSFERS
+    #define OS_BLOCK_IO_MIN_TRANSFER_SIZE (512 * 1024)
+
     //-----------------------------------------------------------------------------
     //
     //  read_LBA()
@@ -294,7 +405,7 @@ extern "C"
     //  Entry:
     //!   \param device - pointer to the device structure
     //!   \param lba - the LBA you wish to start reading at
-    //!   \param async - set to true for an asynchronous read command (NOT SUPPORTED at this time)
+    //!   \param async - set to true to submit the read to the device's asynchronous IO queue (see submit_Async_IO). The completion must be collected with poll_Async_IO or wait_Async_IO
     //!   \param ptrData - pointer to the data buf to fill in with read data
     //!   \param dataSize - size of the buffer, in bytes, for what is to be read. This size is divided by the device's logical sector size to get how many sectors to transfer.
     //!   
@@ -312,7 +423,7 @@ extern "C"
     //  Entry:
     //!   \param device - pointer to the device structure
     //!   \param lba - the LBA you wish to start writing at
-    //!   \param async - set to true for an asynchronous write command (NOT SUPPORTED at this time)
+    //!   \param async - set to true to submit the write to the device's asynchronous IO queue (see submit_Async_IO). The completion must be collected with poll_Async_IO or wait_Async_IO
     //!   \param ptrData - pointer to the data buf to use for writing data
     //!   \param dataSize - size of the buffer, in bytes, for what is to be written. This size is divided by the device's logical sector size to get how many sectors to transfer.
     //!   
@@ -352,6 +463,31 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_TRANSPORT_API int flush_Cache(tDevice *device);
 
+    typedef struct _deallocateRange
+    {
+        uint64_t lba;
+        uint64_t length;//number of logical blocks. Zero length ranges are ignored.
+    }deallocateRange;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  deallocate_LBA_Ranges()
+    //
+    //! \brief   Description:  Deallocates (TRIM/UNMAP/NVMe deallocate) a list of LBA ranges using as few commands as possible.
+    //!                         The ranges are sorted and overlapping or adjacent ranges are merged, then packed into as many
+    //!                         Data Set Management (XL), NVMe Dataset Management or UNMAP commands as needed for the device's limits.
+    //
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param ranges - list of ranges to deallocate. This list is sorted and merged in place.
+    //!   \param numberOfRanges - number of entries in the ranges list
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, BAD_PARAMETER = a range is beyond the end of the device, NOT_SUPPORTED = device does not support deallocation, !SUCCESS = a command failed
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int deallocate_LBA_Ranges(tDevice *device, deallocateRange *ranges, uint32_t numberOfRanges);
+
     //-----------------------------------------------------------------------------
     //
     //  os_Read()
@@ -388,19 +524,218 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_TRANSPORT_API int os_Write(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint32_t dataSize);
 
+    #define ASYNC_IO_DEFAULT_QUEUE_DEPTH UINT32_C(32)
+    #define ASYNC_IO_MAX_QUEUE_DEPTH UINT32_C(256)
+    #define ASYNC_IO_INFINITE_WAIT UINT32_MAX
+    #define ASYNC_IO_STOP_REAP_ATTEMPTS UINT32_C(3)//stop_Async_IO gives up on an issued command after this many waits of twice the command timeout with no completion
+
+    typedef enum _eAsyncIOState
+    {
+        ASYNC_IO_STATE_FREE,//slot is not in use
+        ASYNC_IO_STATE_QUEUED,//accepted by the library, but not yet issued to the OS/device. Can still be cancelled.
+        ASYNC_IO_STATE_ISSUED,//handed to the OS and in flight to the device
+        ASYNC_IO_STATE_COMPLETE,//finished, waiting to be reported by poll_Async_IO or wait_Async_IO
+    }eAsyncIOState;
+
+    //One command tracked by an asynchronous IO queue. The OS layer uses cdb and senseData directly when issuing the command.
+    typedef struct _asyncIOSlot
+    {
+        eAsyncIOState state;
+        uint32_t tag;//Identifier handed back to the caller on submission. Never 0.
+        uint64_t sequence;//Submission order. Queued commands are issued, and completions reported, oldest first.
+        bool write;
+        uint64_t lba;
+        uint8_t *ptrData;
+        uint32_t dataSize;
+        uint8_t cdb[16];
+        uint8_t cdbLength;
+        int result;
+        uint64_t commandTimeNanoSeconds;
+        uint8_t senseData[SPC3_SENSE_LEN];
+        uint32_t nvmeStatus;//NVMe completion DW3 (status in bits 31:17) for commands sent to an NVMe device. 0 otherwise.
+    }asyncIOSlot;
+
+    struct _asyncIOQueue
+    {
+        uint32_t queueDepth;//number of slots, which is how many commands may be outstanding (queued + issued + complete but not reported)
+        uint32_t osQueueDepth;//number of commands the OS layer can keep in flight at once. 0 means the OS has no asynchronous interface for this device and queued commands are issued synchronously as they are waited on.
+        uint32_t queuedCount;
+        uint32_t issuedCount;
+        uint32_t completeCount;
+        uint32_t nextTag;
+        uint64_t nextSequence;
+        asyncIOSlot *slots;
+        void *osContext;//owned by the OS layer (os_Async_IO_Init/os_Async_IO_Cleanup)
+    };
+
+    //Information returned to the caller about a finished asynchronous command.
+    typedef struct _asyncIOCompletion
+    {
+        uint32_t tag;
+        bool write;
+        uint64_t lba;
+        uint8_t *ptrData;
+        uint32_t dataSize;
+        int result;//SUCCESS, or the failure status of the command. Check senseData for details
+        uint64_t commandTimeNanoSeconds;
+        uint8_t senseData[SPC3_SENSE_LEN];
+        uint32_t nvmeStatus;//NVMe completion DW3 (status in bits 31:17) for commands sent to an NVMe device. 0 otherwise.
+    }asyncIOCompletion;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  start_Async_IO()
+    //
+    //! \brief   Description:  Sets up an asynchronous IO queue for the device so that multiple reads/writes can be kept in flight at once.
+    //!                        If the OS/interface does not have an asynchronous interface, the queue still works, but commands are issued one at a time when they are waited on.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param queueDepth - maximum number of commands that can be outstanding. 0 selects ASYNC_IO_DEFAULT_QUEUE_DEPTH. Limited to ASYNC_IO_MAX_QUEUE_DEPTH
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = pass, MEMORY_FAILURE = could not allocate the queue, BAD_PARAMETER = a queue is already set up on this device
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int start_Async_IO(tDevice *device, uint32_t queueDepth);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  stop_Async_IO()
+    //
+    //! \brief   Description:  Cancels any queued commands, waits for any commands already issued to the device to finish, then releases the asynchronous IO queue.
+    //!                        Completions that have not been reported are discarded. If issued commands cannot be reaped (OS error, or no completion after ASYNC_IO_STOP_REAP_ATTEMPTS waits)
+    //!                        the queue is detached from the device but not freed, since the OS still references it. The data buffers of those commands must not be freed by the caller either.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = pass, !SUCCESS = something when wrong
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int stop_Async_IO(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  submit_Async_IO()
+    //
+    //! \brief   Description:  Submits a read or write to the device's asynchronous IO queue. The data buffer must remain valid until the command's completion has been reported.
+    //!                        If no queue has been set up, one is created with the default queue depth.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param write - true = write command, false = read command
+    //!   \param lba - the LBA to start reading/writing at
+    //!   \param ptrData - pointer to the data buffer
+    //!   \param dataSize - size of the buffer, in bytes. Must be a multiple of the logical sector size.
+    //!   \param tag - (optional) set to the tag for this command. This is reported in the completion and can be used to cancel it.
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = command accepted, FAILURE = queue is full (wait for a completion and try again), BAD_PARAMETER = invalid buffer or size
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int submit_Async_IO(tDevice *device, bool write, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, uint32_t *tag);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  wait_Async_IO()
+    //
+    //! \brief   Description:  Waits for the oldest finished asynchronous command and reports it. Reporting a command frees its slot in the queue.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param completion - filled in with the finished command's information
+    //!   \param timeoutMilliseconds - how long to wait for a command to finish. 0 = do not wait, ASYNC_IO_INFINITE_WAIT = wait until one finishes
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = completion reported, IN_PROGRESS = nothing finished before the timeout, FAILURE = no commands outstanding
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int wait_Async_IO(tDevice *device, asyncIOCompletion *completion, uint32_t timeoutMilliseconds);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  poll_Async_IO()
+    //
+    //! \brief   Description:  Same as wait_Async_IO with a timeout of zero.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param completion - filled in with the finished command's information
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = completion reported, IN_PROGRESS = nothing has finished yet, FAILURE = no commands outstanding
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int poll_Async_IO(tDevice *device, asyncIOCompletion *completion);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  cancel_Async_IO()
+    //
+    //! \brief   Description:  Cancels an asynchronous command. Only commands that have not been issued to the device yet can be cancelled.
+    //!                        A cancelled command does not get a completion reported.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param tag - tag returned by submit_Async_IO
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = cancelled, IN_PROGRESS = already issued to the device, its completion will still be reported, BAD_PARAMETER = tag not found
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int cancel_Async_IO(tDevice *device, uint32_t tag);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Async_IO_Outstanding_Count()
+    //
+    //! \brief   Description:  Returns the number of commands in the device's queue that have not been reported yet (queued, issued, or finished but not yet reported)
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //!   \return number of outstanding commands. 0 if no queue is set up.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API uint32_t get_Async_IO_Outstanding_Count(tDevice *device);
+
+    //OS layer hooks for the asynchronous IO queue. Every OS helper provides these. If an OS does not support asynchronous IO,
+    //os_Async_IO_Init returns NOT_SUPPORTED and the queue issues commands synchronously instead.
+    //os_Async_IO_Init must set queue->osQueueDepth to the number of commands it can keep in flight.
+    //os_Reap_Async_IO returns SUCCESS and sets completedSlot when a command finished, or IN_PROGRESS when the timeout expired first.
+    OPENSEA_TRANSPORT_API int os_Async_IO_Init(tDevice *device, asyncIOQueue *queue);
+
+    OPENSEA_TRANSPORT_API int os_Submit_Async_IO(tDevice *device, asyncIOQueue *queue, asyncIOSlot *slot);
+
+    OPENSEA_TRANSPORT_API int os_Reap_Async_IO(tDevice *device, asyncIOQueue *queue, uint32_t timeoutMilliseconds, asyncIOSlot **completedSlot);
+
+    OPENSEA_TRANSPORT_API void os_Async_IO_Cleanup(tDevice *device, asyncIOQueue *queue);
+
     OPENSEA_TRANSPORT_API int os_Verify(tDevice *device, uint64_t lba, uint32_t range);
 
     OPENSEA_TRANSPORT_API int os_Flush(tDevice *device);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Max_Transfer_Length_Blocks()
+    //
+    //! \brief   Description:  Gets the largest number of logical blocks a single read or write command can transfer to this device.
+    //!                        This accounts for the command set (28 vs 48bit ATA, NVMe MDTS, etc) and any passthrough maxTransferLength hacks.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //!   \return maximum number of logical blocks per command. UINT32_MAX if there is no known limit.
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API uint32_t get_Max_Transfer_Length_Blocks(tDevice *device);
+
     //-----------------------------------------------------------------------------
     //
     //  io_Read()
     //
     //! \brief   Description:  This function sends the best possible read for the device's interface (ATA vs SCSI). This calls scsi_Read or ata_Read based on the interface type for the drive
+    //!                        Transfers larger than get_Max_Transfer_Length_Blocks are split into multiple commands.
     //  Entry:
     //!   \param device - pointer to the device structure
     //!   \param lba - the LBA you wish to start reading at
-    //!   \param async - set to true for an asynchronous read command (NOT SUPPORTED at this time)
+    //!   \param async - set to true to submit the read to the device's asynchronous IO queue (see submit_Async_IO). The completion must be collected with poll_Async_IO or wait_Async_IO
     //!   \param ptrData - pointer to the data buf to fill in with read data
     //!   \param dataSize - size of the buffer, in bytes, for what is to be read. This size is divided by the device's logical sector size to get how many sectors to transfer.
     //!   
@@ -415,10 +750,11 @@ extern "C"
     //  io_Write()
     //
     //! \brief   Description:  This function sends the best possible write for the device's interface (ATA vs SCSI). This calls scsi_Write or ata_Write based on the interface type for the drive
+    //!                        Transfers larger than get_Max_Transfer_Length_Blocks are split into multiple commands.
     //  Entry:
     //!   \param device - pointer to the device structure
     //!   \param lba - the LBA you wish to start writing at
-    //!   \param async - set to true for an asynchronous write command (NOT SUPPORTED at this time)
+    //!   \param async - set to true to submit the write to the device's asynchronous IO queue (see submit_Async_IO). The completion must be collected with poll_Async_IO or wait_Async_IO
     //!   \param ptrData - pointer to the data buf to use for writing data
     //!   \param dataSize - size of the buffer, in bytes, for what is to be written. This size is divided by the device's logical sector size to get how many sectors to transfer.
     //!   
@@ -436,7 +772,7 @@ extern "C"
     //  Entry:
     //!   \param device - pointer to the device structure
     //!   \param lba - the LBA you wish to start writing at
-    //!   \param async - set to true for an asynchronous write command (NOT SUPPORTED at this time)
+    //!   \param async - set to true to submit the write to the device's asynchronous IO queue (see submit_Async_IO). The completion must be collected with poll_Async_IO or wait_Async_IO
     //!   \param ptrData - pointer to the data buf to use for writing data
     //!   \param dataSize - size of the buffer, in bytes, for what is to be written. This size is divided by the device's logical sector size to get how many sectors to transfer.
     //!   
@@ -454,7 +790,7 @@ extern "C"
     //  Entry:
     //!   \param device - pointer to the device structure
     //!   \param lba - the LBA you wish to start reading at
-    //!   \param async - set to true for an asynchronous read command (NOT SUPPORTED at this time)
+    //!   \param async - set to true to submit the read to the device's asynchronous IO queue (see submit_Async_IO). The completion must be collected with poll_Async_IO or wait_Async_IO
     //!   \param ptrData - pointer to the data buf to use for reading data
     //!   \param dataSize - size of the buffer, in bytes, for what is to be read. This size is divided by the device's logical sector size to get how many sectors to transfer.
     //!   
@@ -472,7 +808,7 @@ extern "C"
     //  Entry:
     //!   \param device - pointer to the device structure
     //!   \param lba - the LBA you wish to start writing at
-    //!   \param async - set to true for an asynchronous write command (NOT SUPPORTED at this time)
+    //!   \param async - set to true to submit the write to the device's asynchronous IO queue (see submit_Async_IO). The completion must be collected with poll_Async_IO or wait_Async_IO
     //!   \param ptrData - pointer to the data buf to use for writing data
     //!   \param dataSize - size of the buffer, in bytes, for what is to be written. This size is divided by the device's logical sector size to get how many sectors to transfer.
     //!   
@@ -490,7 +826,7 @@ extern "C"
     //  Entry:
     //!   \param device - pointer to the device structure
     //!   \param lba - the LBA you wish to start reading at
-    //!   \param async - set to true for an asynchronous read command (NOT SUPPORTED at this time)
+    //!   \param async - set to true to submit the read to the device's asynchronous IO queue (see submit_Async_IO). The completion must be collected with poll_Async_IO or wait_Async_IO
     //!   \param ptrData - pointer to the data buf to use for reading data
     //!   \param dataSize - size of the buffer, in bytes, for what is to be read. This size is divided by the device's logical sector size to get how many sectors to transfer.
     //!   
@@ -518,6 +854,114 @@ extern "C"
 
     OPENSEA_TRANSPORT_API int report_Zones(tDevice *device, eZoneReportingOptions reportingOptions, bool partial, uint64_t zoneLocator, uint8_t *ptrData, uint32_t dataSize);
 
+    //Size of the data buffer used for each report zones command issued by the zone map. This holds the 64 byte header and 511 zone descriptors.
+    #define ZONE_MAP_REPORT_BUFFER_SIZE UINT32_C(32768)
+    #define ZONE_DESCRIPTOR_LENGTH UINT32_C(64)
+
+    //Zone type field of a zone descriptor (ZBC/ZAC)
+    typedef enum _eZoneType
+    {
+        ZONE_TYPE_CONVENTIONAL                      = 0x1,
+        ZONE_TYPE_SEQUENTIAL_WRITE_REQUIRED         = 0x2,
+        ZONE_TYPE_SEQUENTIAL_WRITE_PREFERRED        = 0x3,
+        ZONE_TYPE_SEQUENTIAL_OR_BEFORE_REQUIRED     = 0x4,
+    }eZoneType;
+
+    //Zone condition field of a zone descriptor (ZBC/ZAC)
+    typedef enum _eZoneCondition
+    {
+        ZONE_CONDITION_NOT_WRITE_POINTER    = 0x0,
+        ZONE_CONDITION_EMPTY                = 0x1,
+        ZONE_CONDITION_IMPLICITLY_OPENED    = 0x2,
+        ZONE_CONDITION_EXPLICITLY_OPENED    = 0x3,
+        ZONE_CONDITION_CLOSED               = 0x4,
+        ZONE_CONDITION_READ_ONLY            = 0xD,
+        ZONE_CONDITION_FULL                 = 0xE,
+        ZONE_CONDITION_OFFLINE              = 0xF,
+    }eZoneCondition;
+
+    #define ZONE_FLAG_RESET     BIT0 //RESET bit from the zone descriptor
+    #define ZONE_FLAG_NON_SEQ   BIT1 //NON_SEQ bit from the zone descriptor
+
+    //Zone list kept with a device. Each array has zoneCount entries, sorted by zone start LBA, so zone i is described by zoneStart[i], zoneLength[i], writePointer[i], zoneType[i], zoneCondition[i] and zoneFlags[i].
+    //Only read this. It is changed by build_Zone_Map, refresh_Zone_Map and by zone actions and writes made through this library.
+    struct _deviceZoneMap
+    {
+        uint32_t zoneCount;
+        uint32_t zoneCapacity;//number of entries allocated in each array
+        uint64_t maxLBA;//from the report zones header
+        uint64_t *zoneStart;
+        uint64_t *zoneLength;
+        uint64_t *writePointer;
+        uint8_t *zoneType;//eZoneType
+        uint8_t *zoneCondition;//eZoneCondition
+        uint8_t *zoneFlags;//ZONE_FLAG_RESET, ZONE_FLAG_NON_SEQ
+    };
+
+    //-----------------------------------------------------------------------------
+    //
+    //  build_Zone_Map()
+    //
+    //! \brief   Description:  Reads the device's full zone list with report zones commands (using the partial bit to page through it) and stores it as device->zoneMap.
+    //!                        Any existing zone map is replaced.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = pass, NOT_SUPPORTED = not a zoned device, MEMORY_FAILURE = could not allocate the map, !SUCCESS = report zones failed
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int build_Zone_Map(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  refresh_Zone_Map()
+    //
+    //! \brief   Description:  Updates the write pointer, condition and flags of zones already in device->zoneMap without rereading the whole zone list.
+    //!                        Only zones returned by the device are updated, so a reporting option filter (ex: ZONE_REPORT_LIST_IMPLICIT_OPEN_ZONES) refreshes just those zones.
+    //!                        Zones that no longer match the filter keep their previous values. Use ZONE_REPORT_LIST_ALL_ZONES with a zone count to refresh a range of zones.
+    //!                        If there is no zone map yet, build_Zone_Map is called instead.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param reportingOptions - filter for which zones are reported
+    //!   \param startLBA - zone locator to start reporting from
+    //!   \param maxZones - stop after this many zones have been reported. 0 = through the end of the device
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = pass, !SUCCESS = report zones failed
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int refresh_Zone_Map(tDevice *device, eZoneReportingOptions reportingOptions, uint64_t startLBA, uint32_t maxZones);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Zone_Map_Index()
+    //
+    //! \brief   Description:  Finds the zone containing an LBA in device->zoneMap with a binary search.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param lba - LBA to look up
+    //!   \param zoneIndex - set to the index of the zone in the zone map's arrays
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = found, NOT_SUPPORTED = no zone map, BAD_PARAMETER = the LBA is not in any zone
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int get_Zone_Map_Index(tDevice *device, uint64_t lba, uint32_t *zoneIndex);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_Zone_Map()
+    //
+    //! \brief   Description:  Releases device->zoneMap. close_Device calls this.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API void free_Zone_Map(tDevice *device);
+
     #if defined (__cplusplus)
 }
     #endif
@@ -672,6 +672,11 @@ extern "C"
         bool enableLegacyPassthroughDetectionThroughTrialAndError;//This must be set to true in order to work on legacy (ancient) passthrough if the VID/PID is not in the list and not read from the system.
         bool senseDataReportingEnabled;//this is to track when the RTFRs may contain a sense data bit so it can be read automatically.
         uint8_t forceSATCDBLength;//set this to 12, 16, or 32 to force a specific CDB length to use. If you set 12, but send an extended command 16B will be used if any extended registers are set. Same with 32B will be used if ICC or AUX are set.
+        //The following are set when the DMA version of a command is rejected (invalid field in CDB) so that the PIO version is used for this device from then on.
+        bool trustedSendDMAFailed;
+        bool trustedReceiveDMAFailed;
+        bool readStreamDMAFailed;
+        bool writeStreamDMAFailed;
     }ataOptions;
 
     typedef enum _eZonedDeviceType {
@@ -703,6 +708,7 @@ extern "C"
         bool senseDataDescriptorFormat;//DO NOT SET DIRECTLY! This should be changed through a mode select command to the software SAT layer. false = fixed format, true = descriptor format
         bool dataSetManagementXLSupported;//Needed to help the translator know when this command is supported so it can be used.
         bool zeroExtSupported;
+        bool deviceInfoAvailable;//Set once the software SAT or SNTL layer has read the identify data it needs for this device.
         uint8_t rtfrIndex;
         ataReturnTFRs ataPassthroughResults[16];
     }softwareSATFlags;
@@ -806,7 +812,8 @@ extern "C"
                     bool securityReceive;
                     //TODO: As other passthroughs are learned with different capabilities, add other commands that ARE supported by them here so that other layers of code can know what capabilities a given device has.
                 }limitedCommandsSupported;
-                uint8_t reserved[5];//padd out above bools to 8 byte boundaries
+                bool ioErrorsFailSCSIStatus;//USB bridges (JMicron/ASMedia): the bridge fails the SCSI status whenever an NVM I/O command (read, write, flush, etc) completes with an NVMe error. Only set for bridges validated to do this. When set, the completion is not read back for NVM I/O that returned good SCSI status.
+                uint8_t reserved[4];//padd out above bools to 8 byte boundaries
                 uint32_t maxTransferLength;
                 uint32_t nvmepadding;//padd 4 more bytes after transfer length to keep 8 byte boundaries
             }nvmePTHacks;
@@ -814,6 +821,8 @@ extern "C"
         //TODO: Add more hacks and padd this structure
     }passthroughHacks;
 
+    //driveInfo is ordered hot to cold. The fields the command send paths read or update on every command are first so they share as few cache lines as possible.
+    //Identification data read at discovery (strings, identify/VPD data, bridge and adapter info, software SAT state) is after them.
     typedef struct _driveInfo {
         eMediaType     media_type;
         eDriveType     drive_type;
@@ -825,6 +834,29 @@ extern "C"
         uint16_t       sectorAlignment;//This will usually be set to 0 on newer drives. Older drives may set this alignment differently
         uint8_t padd0[2];
         uint64_t       deviceMaxLba;
+        uint32_t defaultTimeoutSeconds;//If this is not set (set to zero), a default value of 15 seconds will be used.
+        union {
+            uint32_t namespaceID;//This is the current namespace you are talking with. If this is zero, then this value is invalid. This may not be available on all OS's or driver interfaces
+            uint32_t lun;//Logical unit number for SCSI. Not currently populated.
+        };
+        uint64_t        lastCommandTimeNanoSeconds;//The time the last command took in nanoseconds
+        struct {
+            uint32_t lastNVMeCommandSpecific;//DW0 of command completion. Not all OS's return this so it is not always valid...only really useful for SNTL when it is used. Linux, Solaris, FreeBSD, UEFI. Windows is the problem child here.
+            uint32_t lastNVMeStatus;//DW3 of command completion. Not all OS's return this so it is not always valid...only really useful for SNTL when it is used. Linux, Solaris, FreeBSD, UEFI. Windows is the problem child here.
+        }lastNVMeResult;
+        ataReturnTFRs lastCommandRTFRs;//This holds the RTFRs for the last command to be sent to the device. This is not necessarily the last function called as functions may send multiple commands to the device.
+        struct {
+            bool validData;//must be true for any other fields to be useful
+            uint8_t senseKey;
+            uint8_t additionalSenseCode;
+            uint8_t additionalSenseCodeQualifier;
+            uint8_t padd[4];
+        }ataSenseData;
+        ataOptions      ata_Options;
+        passthroughHacks passThroughHacks;
+        uint8_t lastCommandSenseData[SPC3_SENSE_LEN];//This holds the sense data for the last command to be sent to the device. This is not necessarily the last function called as functions may send multiple commands to the device.
+        uint8_t padd5[4];
+        //Identification data. Filled in by discovery and not needed to send most commands.
         char           serialNumber[SERIAL_NUM_LEN + 1];
         uint8_t padd1[7];
         char           T10_vendor_ident[T10_VENDOR_ID_LEN + 1];
@@ -834,6 +866,13 @@ extern "C"
         char           product_revision[FW_REV_LEN + 1];
         uint8_t padd4[7];
         uint64_t       worldWideName;
+        uint8_t currentProtectionType;//Useful for certain operations. Read in readCapacityOnSCSI. TODO: NVMe
+        uint8_t piExponent;//Only valid for protection types 2 & 3 I believe...-TJE
+        uint8_t scsiVersion;//from STD Inquiry. Can be used elsewhere to help filter capabilities. NOTE: not an exact copy for old products where there was also EMCA and ISO versions. Set to ANSI version number in those cases.
+        union {
+            uint32_t numberOfLUs;//number of logical units on the device
+            uint32_t numberOfNamespaces;//number of namespaces on the controller
+        };
         union{
             tAtaIdentifyData ata;
 #if !defined(DISABLE_NVME_PASSTHROUGH)
@@ -843,41 +882,10 @@ extern "C"
             uint8_t reserved[8192];//putting this here to allow some compatibility when NVMe passthrough is NOT enabled.
         }IdentifyData; //THis MUST be at an even 8 byte offset to be accessed correctly!!!
         tVpdData         scsiVpdData; // Intentionally not part of the above IdentifyData union
-        ataReturnTFRs lastCommandRTFRs;//This holds the RTFRs for the last command to be sent to the device. This is not necessarily the last function called as functions may send multiple commands to the device.
-        struct {
-            bool validData;//must be true for any other fields to be useful
-            uint8_t senseKey;
-            uint8_t additionalSenseCode;
-            uint8_t additionalSenseCodeQualifier;
-            uint8_t padd[4];
-        }ataSenseData;
-        uint8_t lastCommandSenseData[SPC3_SENSE_LEN];//This holds the sense data for the last command to be sent to the device. This is not necessarily the last function called as functions may send multiple commands to the device.
-        uint8_t padd5[4];
-        struct {
-            uint32_t lastNVMeCommandSpecific;//DW0 of command completion. Not all OS's return this so it is not always valid...only really useful for SNTL when it is used. Linux, Solaris, FreeBSD, UEFI. Windows is the problem child here.
-            uint32_t lastNVMeStatus;//DW3 of command completion. Not all OS's return this so it is not always valid...only really useful for SNTL when it is used. Linux, Solaris, FreeBSD, UEFI. Windows is the problem child here.
-        }lastNVMeResult;
         //TODO: a union or something so that we don't need to keep adding more bytes for drive types that won't use the ATA stuff or NVMe stuff in this struct.
         bridgeInfo      bridge_info;
         adapterInfo     adapter_info;
-        ataOptions      ata_Options;
-        uint64_t        lastCommandTimeNanoSeconds;//The time the last command took in nanoseconds
         softwareSATFlags softSATFlags;//This is used by the software SAT translation layer. DO NOT Update this directly. This should only be updated by the lower layers of opensea-transport.
-        uint32_t defaultTimeoutSeconds;//If this is not set (set to zero), a default value of 15 seconds will be used.
-        uint8_t padd6[4];
-        union {
-            uint32_t namespaceID;//This is the current namespace you are talking with. If this is zero, then this value is invalid. This may not be available on all OS's or driver interfaces
-            uint32_t lun;//Logical unit number for SCSI. Not currently populated.
-        };
-        uint8_t currentProtectionType;//Useful for certain operations. Read in readCapacityOnSCSI. TODO: NVMe
-        uint8_t piExponent;//Only valid for protection types 2 & 3 I believe...-TJE
-        uint8_t scsiVersion;//from STD Inquiry. Can be used elsewhere to help filter capabilities. NOTE: not an exact copy for old products where there was also EMCA and ISO versions. Set to ANSI version number in those cases.
-        union {
-            uint32_t numberOfLUs;//number of logical units on the device
-            uint32_t numberOfNamespaces;//number of namespaces on the controller
-        };
-        //9304 bytes to make divisible by 8
-        passthroughHacks passThroughHacks;
     }driveInfo;
 
 #if defined(UEFI_C_SOURCE)
@@ -919,8 +927,6 @@ extern "C"
     // \struct typedef struct _OSDriveInfo
     typedef struct _OSDriveInfo
     {
-        char                name[256];//handle name (string)
-        char                friendlyName[24];//Handle name in a shorter/more friendly format. Example: name=\\.\PHYSICALDRIVE0 friendlyName=PD0
         eOSType             osType;//useful for lower layers to do OS specific things
         uint8_t             minimumAlignment;//This is a power of 2 value representing the byte alignment required. 0 - no requirement, 1 - single byte alignment, 2 - word, 4 - dword, 8 - qword, 16 - 128bit aligned
         uint8_t padd0[3];
@@ -995,7 +1001,9 @@ extern "C"
         #if defined(VMK_CROSS_COMP)
         uint8_t paddSG[35];//TODO: need to change this based on size of NVMe handle for VMWare.
         #else
-        uint8_t paddSG[35];
+        struct _linuxIOUring *ioUring;//io_uring engine for NVMe generic (/dev/ngXnY) passthrough. NULL when the engine is not in use. Requested with the IO_URING_ENGINE discovery flag.
+        bool                blockDeviceUnavailable;//Set when the block device could not be found or opened for direct IO so os_Read/os_Write/os_Verify/os_Flush stop trying it and passthrough is used.
+        uint8_t paddSG[26];
         #endif
         #elif defined (_WIN32)
         HANDLE              fd;
@@ -1048,6 +1056,9 @@ extern "C"
             bool isSystemDisk;//This will be set if the drive has a file system and the OS is running off of it. Ex: Windows' C:\Windows\System32, Linux's / & /boot, etc
         }fileSystemInfo;
         uint8_t padd[4];//padd to 400 byte on UEFI. TODO: Make all OS's keep this structure the same size!!!
+        //Names are only needed for opening handles and display, so they are kept after the handles used to send commands.
+        char                name[256];//handle name (string)
+        char                friendlyName[24];//Handle name in a shorter/more friendly format. Example: name=\\.\PHYSICALDRIVE0 friendlyName=PD0
     }OSDriveInfo;
 
     typedef enum _eDiscoveryOptions
@@ -1063,6 +1074,10 @@ extern "C"
         FORCE_ATA_DMA_SAT_MODE = BIT17, //troubleshooting option to send all DMA commands with protocol set to DMA in SAT CDBs
         FORCE_ATA_UDMA_SAT_MODE = BIT18, //troubleshooting option to send all DMA commands with protocol set to DMA in SAT CDBs
         GET_DEVICE_FUNCS_IGNORE_CSMI = BIT19, //use this bit in get_Device_Count and get_Device_List to ignore CSMI devices.
+        IO_URING_ENGINE = BIT20, //Linux only. Use io_uring to issue asynchronous NVMe commands when the kernel supports it. Falls back to ioctls when it is not available.
+        DISCOVERY_CACHE = BIT21, //Use the discovery cache file set with set_Discovery_Cache_File() to skip the full discovery of devices that were seen before. Does nothing if no cache file is set.
+        LAZY_DISCOVERY = BIT22, //Only used with DEFAULT_DISCOVERY. Reads the same basic information as FAST_SCAN up front. The rest of discovery is done the first time it is needed (library functions that use capacity or block size, software translated commands that use them, complete_Drive_Info_Data or the get_Drive_Info_ accessors).
+        OS_BLOCK_IO_FOR_LARGE_TRANSFERS = BIT23, //read_LBA and write_LBA send transfers of at least OS_BLOCK_IO_MIN_TRANSFER_SIZE through the OS block layer (os_Read/os_Write) instead of passthrough. Linux uses the block device with O_DIRECT. Falls back to passthrough where the OS does not support it.
 #if defined (ENABLE_CSMI)
         CSMI_FLAG_IGNORE_PORT = BIT25,
         CSMI_FLAG_USE_PORT = BIT26,
@@ -1073,9 +1088,37 @@ extern "C"
 #endif
     } eDiscoveryOptions;
 
+    //get_Device_List can discover devices on multiple threads. The number of threads goes in bits 39:32 of its flags. 0 or 1 discovers one device at a time. Only implemented in Linux.
+    //Devices are always returned in the same order as a single threaded discovery. Ex: get_Device_List(list, size, ver, FAST_SCAN | DISCOVERY_THREAD_COUNT(8));
+    #define DISCOVERY_THREAD_COUNT(count) (((uint64_t)((count) & 0xFF)) << 32)
+    #define GET_DISCOVERY_THREAD_COUNT(flags) ((uint8_t)(((uint64_t)(flags) >> 32) & 0xFF))
+
     typedef int (*issue_io_func)( void * );
 
-    #define DEVICE_BLOCK_VERSION    (6)
+    //Asynchronous IO queue for a device. This is allocated by start_Async_IO (see cmds.h) and released by stop_Async_IO or close_Device.
+    typedef struct _asyncIOQueue asyncIOQueue;
+
+    //Pool of aligned data buffers kept with a device. This is allocated by start_Device_Buffer_Pool or lease_Device_Buffer and released by stop_Device_Buffer_Pool or close_Device.
+    typedef struct _deviceBufferPool deviceBufferPool;
+
+    //Cache of recently read device logs so that several translated or reported pages can share one device read. This is allocated by set_Device_Log_Cache_TTL and released by stop_Device_Log_Cache or close_Device.
+    typedef struct _deviceLogCache deviceLogCache;
+
+    //Host side copy of a zoned device's zone list (start, length, write pointer, type and condition for each zone). This is allocated by build_Zone_Map (see cmds.h) and released by free_Zone_Map or close_Device.
+    typedef struct _deviceZoneMap deviceZoneMap;
+
+    //Software translator REPORT SUPPORTED OPERATION CODES data for all commands. This is allocated by get_Memoized_Supported_Op_Codes and released by free_Memoized_Supported_Op_Codes or close_Device.
+    typedef struct _deviceSupportedOpCodes deviceSupportedOpCodes;
+
+    //How much of driveInfo has been filled in by discovery.
+    //Devices opened with FAST_SCAN, DO_NOT_WAKE_DRIVE or LAZY_DISCOVERY only have the identity tier until complete_Drive_Info_Data is called.
+    typedef enum _eDriveInfoTier
+    {
+        DRIVE_INFO_TIER_COMPLETE = 0,//All discovery has been done. This is the default so that devices set up without fill_Drive_Info_Data are not rediscovered.
+        DRIVE_INFO_TIER_IDENTITY,//Model, serial, firmware, WWN and drive type are available. Capacity, VPD page data, log support and other features may not be.
+    }eDriveInfoTier;
+
+    #define DEVICE_BLOCK_VERSION    (17)
 
     // verification for compatibility checking
     typedef struct _versionBlock
@@ -1088,13 +1131,22 @@ extern "C"
     typedef struct _tDevice
     {
         versionBlock        sanity;
-        OSDriveInfo         os_info;
-        driveInfo           drive_info;
+        //Fields checked on every command are first, ahead of the large os_info and drive_info structures.
+        eDiscoveryOptions   dFlags;
+        eVerbosityLevels    deviceVerbosity;
         void                *raid_device;
         issue_io_func       issue_io;//scsi IO function pointer for raid or other driver/custom interface to send commands
         issue_io_func       issue_nvme_io;//nvme IO function pointer for raid or other driver/custom interface to send commands
-        eDiscoveryOptions   dFlags;
-        eVerbosityLevels    deviceVerbosity;
+        deviceBufferPool    *bufferPool;//NULL until a buffer is leased or start_Device_Buffer_Pool is called. Do not modify directly.
+        asyncIOQueue        *asyncIO;//NULL unless start_Async_IO has been called for this device. Do not modify directly.
+        deviceLogCache      *logCache;//NULL unless set_Device_Log_Cache_TTL has been called for this device. Do not modify directly.
+        deviceZoneMap       *zoneMap;//NULL unless build_Zone_Map has been called for this device. Do not modify directly.
+        deviceSupportedOpCodes *supportedOpCodes;//NULL until the software translator reports all supported operation codes. Do not modify directly.
+        uint64_t            commandHeapAllocations;//Number of heap allocations made by lease_Device_Buffer for this device (pool growth, or fallbacks when the pool is full or unavailable). Stays flat once the pool has warmed up.
+        eDriveInfoTier      driveInfoTier;//Set by fill_Drive_Info_Data. Do not modify directly.
+        uint8_t             paddHot[4];
+        OSDriveInfo         os_info;
+        driveInfo           drive_info;
     }tDevice;
 
      //Common enum for getting/setting power states.
@@ -1366,7 +1418,7 @@ extern "C"
     //!   \param[in]  ver = versionBlock structure filled in by application for 
     //!                              sanity check by library. 
     //!   \param[in] flags = bitfield based mask to let application control. 
-    //!                      NOTE: only csmi flags are used right now
+    //!                      NOTE: only csmi flags are used right now. In Linux, DISCOVERY_THREAD_COUNT() can be added to discover devices in parallel.
     //!
     //  Exit:
     //!   \return SUCCESS - pass, WARN_NOT_ALL_DEVICES_ENUMERATED - some deviec had trouble being enumerated. Validate that it's drive_type is not UNKNOWN_DRIVE, !SUCCESS fail or something went wrong
@@ -1762,6 +1814,38 @@ extern "C"
 
     OPENSEA_TRANSPORT_API int remove_Duplicate_Devices(tDevice *deviceList, volatile uint32_t * numberOfDevices, removeDuplicateDriveType rmvDevFlag);
 
+    typedef enum _eDuplicateDeviceKeep
+    {
+        DUPLICATE_KEEP_BOTH,//not a duplicate to remove (or no preference)
+        DUPLICATE_KEEP_FIRST,//remove the second device
+        DUPLICATE_KEEP_SECOND,//remove the first device
+    }eDuplicateDeviceKeep;
+
+    //first is the device found earlier in the list, second is the later one. Both have the same serial number (and WWN when both report one).
+    typedef eDuplicateDeviceKeep (*duplicateDevicePolicy)(tDevice *first, tDevice *second, void *policyData);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  remove_Duplicate_Devices_By_Policy()
+    //
+    //! \brief   Description:  Removes devices that are the same drive seen through more than one path (CSMI and native, SCSI translation and NVMe, multipath, etc).
+    //!                        Devices are matched by hashing serial numbers, the policy picks which one to keep, and the list is compacted in a single pass.
+    //!                        Removed devices are closed with close_Device before the list is compacted, so the caller must not close them again.
+    //  Entry:
+    //!   \param deviceList - list of devices
+    //!   \param numberOfDevices - number of devices in the list. Updated to the number left after removing duplicates.
+    //!   \param policy - decides which of two matching devices to keep. (prefer_NVMe_Over_SCSI_Duplicate_Policy, or a custom one)
+    //!   \param policyData - passed to the policy as is
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, BAD_PARAMETER = NULL list, count, or policy, MEMORY_FAILURE = could not allocate the hash
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int remove_Duplicate_Devices_By_Policy(tDevice *deviceList, volatile uint32_t * numberOfDevices, duplicateDevicePolicy policy, void *policyData);
+
+    //Keeps the NVMe device when the same drive is also listed as a SCSI device (ex: /dev/sg through a SCSI to NVMe translation and /dev/nvme).
+    OPENSEA_TRANSPORT_API eDuplicateDeviceKeep prefer_NVMe_Over_SCSI_Duplicate_Policy(tDevice *first, tDevice *second, void *policyData);
+
     OPENSEA_TRANSPORT_API int remove_Device(tDevice *deviceList, uint32_t driveToRemoveIdx, volatile uint32_t * numberOfDevices);
 
     OPENSEA_TRANSPORT_API bool is_CSMI_Device(tDevice *device);
@@ -1769,6 +1853,278 @@ extern "C"
 
     bool setup_Passthrough_Hacks_By_ID(tDevice *device);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Passthrough_Hacks_By_ID()
+    //
+    //! \brief   Description:  Looks up the known hacks for an adapter in the built in table (and the overlay file, if one is set) and applies them.
+    //!                        Only fields the matching records list are changed. The record for all revisions is applied before a record for the specific revision.
+    //  Entry:
+    //!   \param infoType - USB, PCI, or IEEE1394 adapter
+    //!   \param vendorID - adapter vendor ID
+    //!   \param productID - adapter product ID
+    //!   \param revision - adapter revision. UINT32_MAX to only apply records for all revisions.
+    //!   \param hacks - passthrough hacks to update
+    //!   \param driveType - set when the adapter is known to be a specific drive type (USB to NVMe, for example). May be NULL.
+    //!   \param mediaType - set when the adapter is known to be a specific media type (flash drives, for example). May be NULL.
+    //!
+    //  Exit:
+    //!   \return true = hacks were found for this adapter, false = not found
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API bool get_Passthrough_Hacks_By_ID(eAdapterInfoType infoType, uint32_t vendorID, uint32_t productID, uint32_t revision, passthroughHacks *hacks, eDriveType *driveType, eMediaType *mediaType);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  set_Passthrough_Hacks_Overlay_File()
+    //
+    //! \brief   Description:  Loads a file of additional passthrough hacks that are applied after the built in table so new adapters can be tuned without rebuilding.
+    //!                        Each line is: infoType(eAdapterInfoType in decimal) vendorID(hex) productID(hex) revision(hex or * for all) field=value ...
+    //!                        Fields use the passthroughHacks member names (ex: scsiHacks.noLogPages=true ataPTHacks.maxTransferLength=65536).
+    //!                        driveType=<eDriveType> and mediaType=<eMediaType> are also accepted. Lines starting with # are comments.
+    //!                        Safe to call while get_Device_List is running on other threads. Devices already discovered keep the hacks they were given.
+    //  Entry:
+    //!   \param path - path to the overlay file. NULL removes any loaded overlay.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = loaded, FILE_OPEN_ERROR = could not open the file, MEMORY_FAILURE = out of memory, FAILURE = one or more lines could not be parsed and were skipped
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int set_Passthrough_Hacks_Overlay_File(const char *path);
+
+    #define DEVICE_BUFFER_POOL_MAX_BUFFERS 16
+
+    //-----------------------------------------------------------------------------
+    //
+    //  start_Device_Buffer_Pool()
+    //
+    //! \brief   Description:  Preallocates data buffers for a device so that commands can be issued without allocating memory each time.
+    //!                        Buffers are aligned to the larger of the OS page size and device->os_info.minimumAlignment, which allows OS direct IO (no bounce buffer) where it is supported.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param bufferCount - number of buffers to allocate now. Capped at DEVICE_BUFFER_POOL_MAX_BUFFERS
+    //!   \param bufferSize - size of each buffer in bytes. 0 uses get_Sector_Count_For_Read_Write worth of logical sectors
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = pass, MEMORY_FAILURE if the buffers could not be allocated
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int start_Device_Buffer_Pool(tDevice *device, uint32_t bufferCount, uint32_t bufferSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  stop_Device_Buffer_Pool()
+    //
+    //! \brief   Description:  Frees the device's buffer pool. Buffers still leased are left to the caller, who must still hand them to return_Device_Buffer.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API void stop_Device_Buffer_Pool(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  lease_Device_Buffer()
+    //
+    //! \brief   Description:  Gets a zeroed, aligned data buffer from the device's buffer pool. This is a replacement for calloc_aligned(size, sizeof(uint8_t), device->os_info.minimumAlignment).
+    //!                        The pool is created if it does not exist yet, and pooled buffers grow to fit requests. If every pooled buffer is leased, a new aligned buffer is allocated instead.
+    //!                        Requests larger than the normal transfer length (get_Sector_Count_For_Read_Write logical sectors, or the start_Device_Buffer_Pool size if larger) are not pooled and are freed when returned.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param size - number of bytes needed
+    //!   
+    //  Exit:
+    //!   \return pointer to the buffer, or NULL if memory could not be allocated. Must be given back with return_Device_Buffer
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API uint8_t* lease_Device_Buffer(tDevice *device, uint32_t size);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  return_Device_Buffer()
+    //
+    //! \brief   Description:  Gives a buffer from lease_Device_Buffer back to the device's pool (or frees it if it did not come from the pool or is larger than the pool keeps).
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param buffer - buffer from lease_Device_Buffer. NULL is allowed and ignored
+    //!   
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API void return_Device_Buffer(tDevice *device, uint8_t *buffer);
+
+    //return_Device_Buffer and set the pointer to NULL, like safe_Free_aligned
+    #define safe_Return_Device_Buffer(device, mem) do { return_Device_Buffer(device, mem); (mem) = NULL; } while(0)
+
+    //-----------------------------------------------------------------------------
+    //
+    //  is_Device_Pool_Buffer()
+    //
+    //! \brief   Description:  Checks if a data pointer is within a buffer owned by the device's buffer pool. OS layers use this to decide if direct IO can be requested.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param buffer - data pointer to check
+    //!   \param length - number of bytes from buffer that will be transferred
+    //!   
+    //  Exit:
+    //!   \return true = buffer and length are inside a pooled buffer, false = not a pool buffer
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API bool is_Device_Pool_Buffer(tDevice *device, const uint8_t *buffer, uint32_t length);
+
+    #define DEVICE_LOG_CACHE_MAX_ENTRIES 8
+
+    //Which command set a cached log was read with. This keeps ATA log addresses and NVMe log identifiers apart.
+    typedef enum _eDeviceLogCacheSource
+    {
+        DEVICE_LOG_CACHE_ATA_LOG,//logAddress = ATA log address, subAddress = page number
+        DEVICE_LOG_CACHE_NVME_LOG,//logAddress = NVMe log identifier, subAddress = namespace ID
+    }eDeviceLogCacheSource;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  set_Device_Log_Cache_TTL()
+    //
+    //! \brief   Description:  Turns on the device log cache, or changes how long cached logs are used for. Logs read with ata_Read_Log_Ext_Cached or nvme_Get_Log_Page_Cached
+    //!                        (which the software SAT and NVMe translators use) are kept for this long, so polling several pages that come from the same log only reads the device once.
+    //!                        The cache is off by default.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param ttlMilliseconds - how long a cached log may be returned after it was read. 0 turns the cache off and frees it.
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = pass, MEMORY_FAILURE if the cache could not be allocated
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int set_Device_Log_Cache_TTL(tDevice *device, uint32_t ttlMilliseconds);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  invalidate_Device_Log_Cache()
+    //
+    //! \brief   Description:  Drops everything in the device log cache so that the next read of each log goes to the device. The TTL is kept.
+    //!                        Use this after doing something that changes the logs (resetting statistics, running a self test, etc).
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API void invalidate_Device_Log_Cache(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  stop_Device_Log_Cache()
+    //
+    //! \brief   Description:  Frees the device log cache and turns it off.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API void stop_Device_Log_Cache(tDevice *device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Device_Log_Cache_Entry()
+    //
+    //! \brief   Description:  Copies a log out of the device log cache if it is there, has not expired, and was stored with the same size.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param source - command set the log was read with
+    //!   \param logAddress - log address/identifier
+    //!   \param subAddress - page number (ATA) or namespace ID (NVMe)
+    //!   \param ptrData - buffer to copy the log into
+    //!   \param dataSize - size of ptrData
+    //!   
+    //  Exit:
+    //!   \return true = ptrData was filled in from the cache, false = the log must be read from the device
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API bool get_Device_Log_Cache_Entry(tDevice *device, eDeviceLogCacheSource source, uint32_t logAddress, uint32_t subAddress, uint8_t *ptrData, uint32_t dataSize);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  set_Device_Log_Cache_Entry()
+    //
+    //! \brief   Description:  Stores a log that was just read from the device in the device log cache. Does nothing if the cache is off.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param source - command set the log was read with
+    //!   \param logAddress - log address/identifier
+    //!   \param subAddress - page number (ATA) or namespace ID (NVMe)
+    //!   \param ptrData - log data
+    //!   \param dataSize - size of the log data
+    //!   
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API void set_Device_Log_Cache_Entry(tDevice *device, eDeviceLogCacheSource source, uint32_t logAddress, uint32_t subAddress, const uint8_t *ptrData, uint32_t dataSize);
+
+    //Builds the REPORT SUPPORTED OPERATION CODES data for all commands. This is the signature of the software SAT and SNTL builders.
+    typedef int (*build_Supported_Op_Codes_Func)(tDevice *device, bool rctd, uint8_t **pdata, uint32_t *dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  get_Memoized_Supported_Op_Codes()
+    //
+    //! \brief   Description:  Returns the software translator's REPORT SUPPORTED OPERATION CODES data for all commands. It is built once with the
+    //!                        provided function, then reused until the identify data is reread (discovery frees it with free_Memoized_Supported_Op_Codes).
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   \param rctd - true to include command timeouts descriptors
+    //!   \param build - function that builds the data when it is not memoized yet
+    //!   \param pdata - set to the memoized data. This belongs to the device and must not be freed.
+    //!   \param dataLength - set to the length of the memoized data
+    //!   
+    //  Exit:
+    //!   \return SUCCESS = pass, otherwise the error from building the data
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int get_Memoized_Supported_Op_Codes(tDevice *device, bool rctd, build_Supported_Op_Codes_Func build, const uint8_t **pdata, uint32_t *dataLength);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  free_Memoized_Supported_Op_Codes()
+    //
+    //! \brief   Description:  Frees the data memoized by get_Memoized_Supported_Op_Codes. close_Device and the identify data parsing in discovery call this.
+    //  Entry:
+    //!   \param device - pointer to the device structure
+    //!   
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API void free_Memoized_Supported_Op_Codes(tDevice *device);
+
+    typedef enum _eDeviceStringOptions
+    {
+        DEVICE_STRING_NO_OPTIONS = 0,
+        DEVICE_STRING_WORD_SWAP = BIT0,//ATA strings have the bytes in each word swapped
+        DEVICE_STRING_SCRUB_NON_PRINTABLE = BIT1,//change anything that is not printable ASCII to a space
+    }eDeviceStringOptions;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  copy_Device_String()
+    //
+    //! rief   Description:  Copies a fixed length identification string (model, serial, firmware, vendor) from identify/inquiry/VPD data in one pass:
+    //!                        optional word swap and non-printable scrubbing, stop at the first NUL, and remove leading and trailing whitespace.
+    //!                        Uses SSE2 or NEON when available. The rest of destination is zero filled.
+    //  Entry:
+    //!   \param destination - string to fill in
+    //!   \param destinationSize - size of destination including room for the NUL terminator
+    //!   \param source - raw string bytes from the device
+    //!   \param sourceLength - length of the raw string field
+    //!   \param options - DEVICE_STRING_ flags
+    //!
+    //  Exit:
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API void copy_Device_String(char *destination, size_t destinationSize, const uint8_t *source, size_t sourceLength, eDeviceStringOptions options);
+
     #if defined (_DEBUG)
     //This function is more for debugging than anything else!
     void print_tDevice_Size();
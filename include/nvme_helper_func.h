@@ -25,6 +25,7 @@ extern "C"
     void print_NVMe_Cmd_Result_Verbose(const nvmeCmdCtx * cmdCtx);
     void get_NVMe_Status_Fields_From_DWord(uint32_t nvmeStatusDWord, bool *doNotRetry, bool *more, uint8_t *statusCodeType, uint8_t *statusCode);
     int check_NVMe_Status(uint32_t nvmeStatusDWord);//converts NVMe status to a return status used by open-sea libs
+    bool nvme_Command_Uses_Completion_DW0(const nvmeCmdCtx * cmdCtx);//false for NVM I/O commands that only report a status. USB bridges with nvmePTHacks.ioErrorsFailSCSIStatus use this to skip reading the completion when the bridge already reported good status.
 
     //These reset functions will be defined in the os_Helper file since this is OS specific. Not all OS's will support this function either.
     int nvme_Reset(tDevice *device);
@@ -80,6 +81,22 @@ OPENSEA_TRANSPORT_API int nvme_Get_Features(tDevice *device, nvmeFeaturesCmdOpt
 //-----------------------------------------------------------------------------
 OPENSEA_TRANSPORT_API int nvme_Get_Log_Page(tDevice *device, nvmeGetLogPageCmdOpts * getLogPageCmdOpts);
 
+//-----------------------------------------------------------------------------
+//
+//  nvme_Get_Log_Page_Cached
+//
+//! \brief   Description:  Same as nvme_Get_Log_Page, but uses the device log cache (see set_Device_Log_Cache_TTL) for whole logs read from offset 0.
+//
+//  Entry:
+//!   \param[in] device = pointer to tDevice structure
+//!   \param[in,out] getLogPageCmdOpts = commands options for get log page. 
+//!
+//  Exit:
+//!   \return SUCCESS = pass, !SUCCESS = something when wrong
+//
+//-----------------------------------------------------------------------------
+OPENSEA_TRANSPORT_API int nvme_Get_Log_Page_Cached(tDevice *device, nvmeGetLogPageCmdOpts * getLogPageCmdOpts);
+
 //-----------------------------------------------------------------------------
 //
 //  nvme_Get_SMART_Log_Page
@@ -77,7 +77,8 @@ extern "C"
     //
     //  get_Return_TFRs_From_Sense_Data(tDevice *device, ataPassthroughCommand *ataCommandOptions, int senseRet)
     //
-    //! \brief   Description:  This will parse the returned sense data and in some cases issue a follow up command to get the rtfrs from a device
+    //! \brief   Description:  This will parse the returned sense data and in some cases issue a follow up command to get the rtfrs from a device.
+    //!                        Follow up commands are only issued when ataCommandOptions->rtfrPolicy allows them.
     //
     //  Entry:
     //!   \param[in] device = pointer to the device structure for the device to issue the command to.
@@ -223,6 +224,25 @@ extern "C"
     //-----------------------------------------------------------------------------
     int build_SAT_CDB(tDevice *device, uint8_t **satCDB, eCDBLen *cdbLen, ataPassthroughCommand *ataCommandOptions);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  fill_SAT_CDB(tDevice *device, uint8_t *satCDB, eCDBLen *cdbLen, ataPassthroughCommand *ataCommandOptions)
+    //
+    //! \brief   Description:  Construct a SAT Pass-through CDB in a caller provided buffer (such as the cdb in a ScsiIoCtx).
+    //!                        The fixed parts of the CDB come from precomputed templates so no memory is allocated.
+    //
+    //  Entry:
+    //!   \param[in] device = pointer to device struct for device command will be sent to.
+    //!   \param[out] satCDB = buffer at least CDB_LEN_32 bytes long to hold the built command.
+    //!   \param[out] cdbLen = length of CDB built
+    //!   \param[in] ataCommandOptions = pointer to ATA command options that defines the command to build.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, !SUCCESS = something when wrong
+    //
+    //-----------------------------------------------------------------------------
+    int fill_SAT_CDB(tDevice *device, uint8_t *satCDB, eCDBLen *cdbLen, ataPassthroughCommand *ataCommandOptions);
+
     //-----------------------------------------------------------------------------
     //
     //  send_SAT_Passthrough_Command(tDevice *device, ataPassthroughCommand  *ataCommandOptions)
@@ -67,6 +67,26 @@ extern "C"
     //-----------------------------------------------------------------------------
     OPENSEA_TRANSPORT_API uint16_t calculate_Logical_Block_Guard(uint8_t *buffer, uint32_t userDataLength, uint32_t totalDataLength);
 
+    //-----------------------------------------------------------------------------
+    //
+    //  calculate_Logical_Block_Guards(uint8_t *buffer, uint32_t bufferLength, uint32_t userDataLength, uint32_t logicalBlockLength, uint16_t *guards, uint32_t numberOfBlocks)
+    //
+    //! \brief   Description:  Calculates the logical block guard for many logical blocks at once. Each block is userDataLength bytes of data followed by protection information.
+    //
+    //  Entry:
+    //!   \param buffer - pointer a buffer with user data, such as data read with protection information
+    //!   \param bufferLength - total length of the buffer in bytes
+    //!   \param userDataLength - how many bytes of user data are in each logical block (sector size, IE 512 or 4096)
+    //!   \param logicalBlockLength - distance in bytes from one logical block to the next. Ex: sector size + 8 bytes of protection information
+    //!   \param guards - pointer to memory for numberOfBlocks guards. Filled in on return
+    //!   \param numberOfBlocks - number of logical blocks to calculate the guard for
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, BAD_PARAMETER = buffer is too small or a pointer is NULL
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int calculate_Logical_Block_Guards(uint8_t *buffer, uint32_t bufferLength, uint32_t userDataLength, uint32_t logicalBlockLength, uint16_t *guards, uint32_t numberOfBlocks);
+
     //-----------------------------------------------------------------------------
     //
     //  check_Sense_Key_ASC_ASCQ_And_FRU()
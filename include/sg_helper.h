@@ -80,11 +80,29 @@ extern "C"
         #endif
     #endif
     #include "nvme_helper.h"
+    //io_uring is used for NVMe passthrough through the generic char device (/dev/ngXnY) when the IO_URING_ENGINE flag is given to get_Device.
+    //This needs kernel headers new enough to have IORING_OP_URING_CMD and struct nvme_uring_cmd (5.19 and later). Define DISABLE_IO_URING to leave it out.
+    #if !defined (DISABLE_IO_URING)
+        #if defined (__has_include)
+            #if __has_include (<linux/io_uring.h>)
+                #include <linux/io_uring.h>
+                #if !defined (SEA_IO_URING_H)
+                    #define SEA_IO_URING_H
+                #endif
+            #endif
+        #elif defined (SEA_IO_URING_H)
+            #include <linux/io_uring.h>
+        #endif
+        #if defined (SEA_IO_URING_H) && defined (IORING_SETUP_SQE128) && defined (IORING_SETUP_CQE32) && defined (NVME_URING_CMD_IO)
+            #define SEA_IO_URING_NVME
+        #endif
+    #endif
 #endif
 
 #define SG_PHYSICAL_DRIVE   "/dev/sg" //followed by a number
 #define SD_PHYSICAL_DRIVE   "/dev/sd" //followed by a letter
 #define BSG_PHYSICAL_DRIVE  "/dev/bsg/" //remaining part of the handle is h:c:t:l
+#define NVME_GENERIC_DRIVE  "/dev/ng" //followed by controller number, n, namespace number. Ex: /dev/ng0n1
 
 //SG Driver status's since they are not available through standard includes we're using
 
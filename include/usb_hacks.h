@@ -21,6 +21,23 @@ extern "C"
 {
 #endif
 
+    //-----------------------------------------------------------------------------
+    //
+    //  set_USB_Passthrough_Learning_File(const char *path)
+    //
+    //! \brief   Description:  Sets a file to remember which ATA passthrough worked for each USB/IEEE1394 adapter (by vendor, product and revision).
+    //!                         set_ATA_Passthrough_Type_By_Trial_And_Error tries the remembered passthrough first on later opens and tries
+    //!                         passthroughs for unknown adapters in order of how many adapters in the file use them. Learning is off until a file is set.
+    //
+    //  Entry:
+    //!   \param[in] path = path to the file. NULL turns learning off.
+    //!
+    //  Exit:
+    //!   \return SUCCESS = pass, BAD_PARAMETER = path is too long
+    //
+    //-----------------------------------------------------------------------------
+    OPENSEA_TRANSPORT_API int set_USB_Passthrough_Learning_File(const char *path);
+
     //-----------------------------------------------------------------------------
     //
     //  set_ATA_Passthrough_Type_By_Trial_And_Error(tDevice* device)
@@ -19,6 +19,7 @@
 
 #include "asmedia_nvme_helper.h"
 #include "scsi_helper_func.h" //for ability to send a SCSI IO
+#include "nvme_helper_func.h"
 
 //This builds the CDB that can be used to read a log or read identify data.
 //This will return OS_COMMAND_NOT_AVAILABLE if it is given a command that is unable to be sent using this pass-through method.
@@ -473,17 +474,19 @@ int send_ASM_NVMe_Cmd(nvmeCmdCtx *nvmCmd)
     eDataTransferDirection asmCDBDir = 0;
     //if the NVMe command is not doing a multiple of 512B data transfer, we need to allocate local memory, rounded up to 512B boundaries before the command.
     //Then we can copy that back to the smaller buffer after command is complete.
-    uint8_t *dataPhasePtr = nvmCmd->ptrData;
-    uint32_t dataPhaseSize = nvmCmd->dataSize;
+    uint8_t *dataPhasePtr = NULL;
+    uint32_t dataPhaseSize = 0;
     bool localMemory = false;
     if (!nvmCmd)
     {
         return BAD_PARAMETER;
     }
+    dataPhasePtr = nvmCmd->ptrData;
+    dataPhaseSize = nvmCmd->dataSize;
     if (nvmCmd->ptrData && nvmCmd->dataSize > 0 && nvmCmd->dataSize % 512)
     {
         dataPhaseSize = ((nvmCmd->dataSize + 511) / 512) * 512;//round up to nearest 512B boundary
-        dataPhasePtr = (uint8_t*)calloc_aligned(dataPhaseSize, sizeof(uint8_t), nvmCmd->device->os_info.minimumAlignment);
+        dataPhasePtr = lease_Device_Buffer(nvmCmd->device, dataPhaseSize);
         if (!dataPhasePtr)
         {
             return MEMORY_FAILURE;
@@ -502,7 +505,7 @@ int send_ASM_NVMe_Cmd(nvmeCmdCtx *nvmCmd)
     {
         if (localMemory)
         {
-            safe_Free_aligned(dataPhasePtr);
+            safe_Return_Device_Buffer(nvmCmd->device, dataPhasePtr);
         }
         return ret;
     }
@@ -511,7 +514,7 @@ int send_ASM_NVMe_Cmd(nvmeCmdCtx *nvmCmd)
     {
         if (localMemory)
         {
-            safe_Free_aligned(dataPhasePtr);
+            safe_Return_Device_Buffer(nvmCmd->device, dataPhasePtr);
         }
         return ret;
     }
@@ -522,11 +525,11 @@ int send_ASM_NVMe_Cmd(nvmeCmdCtx *nvmCmd)
     {
         if (localMemory)
         {
-            safe_Free_aligned(dataPhasePtr);
+            safe_Return_Device_Buffer(nvmCmd->device, dataPhasePtr);
         }
         return ret;
     }
-    int sendRet = scsi_Send_Cdb(nvmCmd->device, asmCDB, ASMEDIA_NVME_PACKET_CDB_SIZE, dataPhasePtr, dataPhaseSize, asmCDBDir, NULL, 0, 15);
+    int sendRet = scsi_Send_Cdb(nvmCmd->device, asmCDB, ASMEDIA_NVME_PACKET_CDB_SIZE, dataPhasePtr, dataPhaseSize, asmCDBDir, NULL, 0, nvmCmd->timeout);
 
     if (localMemory)
     {
@@ -535,11 +538,14 @@ int send_ASM_NVMe_Cmd(nvmeCmdCtx *nvmCmd)
         {
             memcpy(nvmCmd->ptrData, dataPhasePtr, nvmCmd->dataSize);
         }
-        safe_Free_aligned(dataPhasePtr);
+        safe_Return_Device_Buffer(nvmCmd->device, dataPhasePtr);
     }
 
     bool senseDataIsAllWeGot = true;
-    if (sendRet != COMMAND_TIMEOUT)
+    //Good SCSI status does not normally mean the NVMe command passed, so the completion is always read unless this bridge is known to fail the SCSI status on NVMe I/O errors.
+    //Reads, writes and other I/O only return a status, so for those bridges skipping the completion request saves a round trip on every I/O.
+    bool skipCompletion = nvmCmd->device->drive_info.passThroughHacks.nvmePTHacks.ioErrorsFailSCSIStatus && sendRet == SUCCESS && !nvme_Command_Uses_Completion_DW0(nvmCmd);
+    if (sendRet != COMMAND_TIMEOUT && !skipCompletion)
     {
         //3. get the command completion
         uint8_t completionData[ASM_NVMP_RESPONSE_DATA_SIZE] = { 0 };
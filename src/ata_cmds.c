@@ -424,6 +424,21 @@ int ata_Read_Log_Ext(tDevice *device, uint8_t logAddress, uint16_t pageNumber, u
     return ret;
 }
 
+int ata_Read_Log_Ext_Cached(tDevice *device, uint8_t logAddress, uint16_t pageNumber, uint8_t *ptrData, uint32_t dataSize, bool useDMA)
+{
+    int ret = SUCCESS;
+    if (get_Device_Log_Cache_Entry(device, DEVICE_LOG_CACHE_ATA_LOG, logAddress, pageNumber, ptrData, dataSize))
+    {
+        return SUCCESS;
+    }
+    ret = ata_Read_Log_Ext(device, logAddress, pageNumber, ptrData, dataSize, useDMA, 0);
+    if (ret == SUCCESS)
+    {
+        set_Device_Log_Cache_Entry(device, DEVICE_LOG_CACHE_ATA_LOG, logAddress, pageNumber, ptrData, dataSize);
+    }
+    return ret;
+}
+
 int ata_Write_Log_Ext(tDevice *device, uint8_t logAddress, uint16_t pageNumber, \
                               uint8_t *ptrData, uint32_t dataSize, bool useDMA, bool forceRTFRs )
 {
@@ -2214,6 +2229,7 @@ int ata_Read_DMA(tDevice *device, uint64_t LBA, uint8_t *ptrData, uint16_t secto
     ataCommandOptions.ataTransferBlocks = ATA_PT_LOGICAL_SECTOR_SIZE;
     ataCommandOptions.ptrData = ptrData;
     ataCommandOptions.dataSize = dataSize;
+    ataCommandOptions.rtfrPolicy = ATA_RTFR_POLICY_ON_ERROR;//RTFRs are only needed to report an error on a read/write
     switch (device->drive_info.ata_Options.dmaMode)
     {
     case ATA_DMA_MODE_NO_DMA:
@@ -2298,6 +2314,7 @@ int ata_Read_Multiple(tDevice *device, uint64_t LBA, uint8_t *ptrData, uint16_t
     ataCommandOptions.ataTransferBlocks = ATA_PT_LOGICAL_SECTOR_SIZE;
     ataCommandOptions.ptrData = ptrData;
     ataCommandOptions.dataSize = dataSize;
+    ataCommandOptions.rtfrPolicy = ATA_RTFR_POLICY_ON_ERROR;//RTFRs are only needed to report an error on a read/write
     ataCommandOptions.commadProtocol = ATA_PROTOCOL_PIO;
     ataCommandOptions.tfr.LbaLow = M_Byte0(LBA);
     ataCommandOptions.tfr.LbaMid = M_Byte1(LBA);
@@ -2377,6 +2394,7 @@ int ata_Read_Sectors(tDevice *device, uint64_t LBA, uint8_t *ptrData, uint16_t s
     ataCommandOptions.ataTransferBlocks = ATA_PT_LOGICAL_SECTOR_SIZE;
     ataCommandOptions.ptrData = ptrData;
     ataCommandOptions.dataSize = dataSize;
+    ataCommandOptions.rtfrPolicy = ATA_RTFR_POLICY_ON_ERROR;//RTFRs are only needed to report an error on a read/write
     ataCommandOptions.commadProtocol = ATA_PROTOCOL_PIO;
     ataCommandOptions.tfr.LbaLow = M_Byte0(LBA);
     ataCommandOptions.tfr.LbaMid = M_Byte1(LBA);
@@ -2494,6 +2512,7 @@ int ata_Read_Stream_Ext(tDevice *device, bool useDMA, uint8_t streamID, bool not
     ataCommandOptions.ataTransferBlocks = ATA_PT_LOGICAL_SECTOR_SIZE;
     ataCommandOptions.ptrData = ptrData;
     ataCommandOptions.dataSize = dataSize;
+    ataCommandOptions.rtfrPolicy = ATA_RTFR_POLICY_ON_ERROR;//RTFRs are only needed to report an error on a read/write
     ataCommandOptions.commandType = ATA_CMD_TYPE_EXTENDED_TASKFILE;
     ataCommandOptions.tfr.LbaLow = M_Byte0(LBA);
     ataCommandOptions.tfr.LbaMid = M_Byte1(LBA);
@@ -3144,6 +3163,7 @@ int ata_Write_DMA(tDevice *device, uint64_t LBA, uint8_t *ptrData, uint32_t data
     ataCommandOptions.ataTransferBlocks = ATA_PT_LOGICAL_SECTOR_SIZE;
     ataCommandOptions.ptrData = ptrData;
     ataCommandOptions.dataSize = dataSize;
+    ataCommandOptions.rtfrPolicy = ATA_RTFR_POLICY_ON_ERROR;//RTFRs are only needed to report an error on a read/write
     switch (device->drive_info.ata_Options.dmaMode)
     {
     case ATA_DMA_MODE_NO_DMA:
@@ -3235,6 +3255,7 @@ int ata_Write_Multiple(tDevice *device, uint64_t LBA, uint8_t *ptrData, uint32_t
     ataCommandOptions.ataTransferBlocks = ATA_PT_LOGICAL_SECTOR_SIZE;
     ataCommandOptions.ptrData = ptrData;
     ataCommandOptions.dataSize = dataSize;
+    ataCommandOptions.rtfrPolicy = ATA_RTFR_POLICY_ON_ERROR;//RTFRs are only needed to report an error on a read/write
     ataCommandOptions.commadProtocol = ATA_PROTOCOL_PIO;
     ataCommandOptions.tfr.LbaLow = M_Byte0(LBA);
     ataCommandOptions.tfr.LbaMid = M_Byte1(LBA);
@@ -3330,6 +3351,7 @@ int ata_Write_Sectors(tDevice *device, uint64_t LBA, uint8_t *ptrData, uint32_t
     ataCommandOptions.ataTransferBlocks = ATA_PT_LOGICAL_SECTOR_SIZE;
     ataCommandOptions.ptrData = ptrData;
     ataCommandOptions.dataSize = dataSize;
+    ataCommandOptions.rtfrPolicy = ATA_RTFR_POLICY_ON_ERROR;//RTFRs are only needed to report an error on a read/write
     ataCommandOptions.commadProtocol = ATA_PROTOCOL_PIO;
     ataCommandOptions.tfr.LbaLow = M_Byte0(LBA);
     ataCommandOptions.tfr.LbaMid = M_Byte1(LBA);
@@ -3446,6 +3468,7 @@ int ata_Write_Stream_Ext(tDevice *device, bool useDMA, uint8_t streamID, bool fl
     ataCommandOptions.ataTransferBlocks = ATA_PT_LOGICAL_SECTOR_SIZE;
     ataCommandOptions.ptrData = ptrData;
     ataCommandOptions.dataSize = dataSize;
+    ataCommandOptions.rtfrPolicy = ATA_RTFR_POLICY_ON_ERROR;//RTFRs are only needed to report an error on a read/write
     ataCommandOptions.commandType = ATA_CMD_TYPE_EXTENDED_TASKFILE;
     ataCommandOptions.tfr.LbaLow = M_Byte0(LBA);
     ataCommandOptions.tfr.LbaMid = M_Byte1(LBA);
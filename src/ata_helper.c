@@ -505,8 +505,7 @@ int send_ATA_Trusted_Send_Cmd(tDevice *device, uint8_t securityProtocol, uint16_
 {
     int ret = NOT_SUPPORTED;
     bool dmaRetry = false;
-    static bool dmaTrustedCmd = true;
-    if (device->drive_info.ata_Options.dmaMode != ATA_DMA_MODE_NO_DMA && dmaTrustedCmd && device->drive_info.ata_Options.dmaSupported)
+    if (device->drive_info.ata_Options.dmaMode != ATA_DMA_MODE_NO_DMA && !device->drive_info.ata_Options.trustedSendDMAFailed && device->drive_info.ata_Options.dmaSupported)
     {
         ret = ata_Trusted_Send(device, true, securityProtocol, securityProtocolSpecific, ptrData, dataSize);
         if (ret == SUCCESS)
@@ -522,7 +521,7 @@ int send_ATA_Trusted_Send_Cmd(tDevice *device, uint8_t securityProtocol, uint16_
             {
                 //turn off DMA mode
                 dmaRetry = true;
-                dmaTrustedCmd = false;
+                device->drive_info.ata_Options.trustedSendDMAFailed = true;
             }
             else
             {
@@ -535,7 +534,7 @@ int send_ATA_Trusted_Send_Cmd(tDevice *device, uint8_t securityProtocol, uint16_
     if (dmaRetry && ret != SUCCESS)
     {
         //this means something else is wrong, and it's not the DMA mode, so we can turn it back on
-        dmaTrustedCmd = true;
+        device->drive_info.ata_Options.trustedSendDMAFailed = false;
     }
     return ret;
 }
@@ -544,8 +543,7 @@ int send_ATA_Trusted_Receive_Cmd(tDevice *device, uint8_t securityProtocol, uint
 {
     int ret = NOT_SUPPORTED;
     bool dmaRetry = false;
-    static bool dmaTrustedCmd = true;
-    if (device->drive_info.ata_Options.dmaMode != ATA_DMA_MODE_NO_DMA && dmaTrustedCmd && device->drive_info.ata_Options.dmaSupported)
+    if (device->drive_info.ata_Options.dmaMode != ATA_DMA_MODE_NO_DMA && !device->drive_info.ata_Options.trustedReceiveDMAFailed && device->drive_info.ata_Options.dmaSupported)
     {
         ret = ata_Trusted_Receive(device, true, securityProtocol, securityProtocolSpecific, ptrData, dataSize);
         if (ret == SUCCESS)
@@ -561,7 +559,7 @@ int send_ATA_Trusted_Receive_Cmd(tDevice *device, uint8_t securityProtocol, uint
             {
                 //turn off DMA mode
                 dmaRetry = true;
-                dmaTrustedCmd = false;
+                device->drive_info.ata_Options.trustedReceiveDMAFailed = true;
             }
             else
             {
@@ -574,7 +572,7 @@ int send_ATA_Trusted_Receive_Cmd(tDevice *device, uint8_t securityProtocol, uint
     if (dmaRetry && ret != SUCCESS)
     {
         //this means something else is wrong, and it's not the DMA mode, so we can turn it back on
-        dmaTrustedCmd = true;
+        device->drive_info.ata_Options.trustedReceiveDMAFailed = false;
     }
     return ret;
 }
@@ -659,8 +657,7 @@ int send_ATA_Read_Stream_Cmd(tDevice *device, uint8_t streamID, bool notSequenti
 {
     int ret = NOT_SUPPORTED;
     bool dmaRetry = false;
-    static bool streamDMA = true;
-    if (device->drive_info.ata_Options.dmaMode != ATA_DMA_MODE_NO_DMA && streamDMA && device->drive_info.ata_Options.dmaSupported)
+    if (device->drive_info.ata_Options.dmaMode != ATA_DMA_MODE_NO_DMA && !device->drive_info.ata_Options.readStreamDMAFailed && device->drive_info.ata_Options.dmaSupported)
     {
         ret = ata_Read_Stream_Ext(device, true, streamID, notSequential, readContinuous, commandCCTL, LBA, ptrData, dataSize);
         if (ret == SUCCESS)
@@ -676,7 +673,7 @@ int send_ATA_Read_Stream_Cmd(tDevice *device, uint8_t streamID, bool notSequenti
             {
                 //turn off DMA mode
                 dmaRetry = true;
-                streamDMA = false;
+                device->drive_info.ata_Options.readStreamDMAFailed = true;
             }
             else
             {
@@ -689,7 +686,7 @@ int send_ATA_Read_Stream_Cmd(tDevice *device, uint8_t streamID, bool notSequenti
     if (dmaRetry && ret != SUCCESS)
     {
         //this means something else is wrong, and it's not the DMA mode, so we can turn it back on
-        streamDMA = true;
+        device->drive_info.ata_Options.readStreamDMAFailed = false;
     }
     return ret;
 }
@@ -698,8 +695,7 @@ int send_ATA_Write_Stream_Cmd(tDevice *device, uint8_t streamID, bool flush, boo
 {
     int ret = NOT_SUPPORTED;
     bool dmaRetry = false;
-    static bool streamDMA = true;
-    if (device->drive_info.ata_Options.dmaMode != ATA_DMA_MODE_NO_DMA && streamDMA && device->drive_info.ata_Options.dmaSupported)
+    if (device->drive_info.ata_Options.dmaMode != ATA_DMA_MODE_NO_DMA && !device->drive_info.ata_Options.writeStreamDMAFailed && device->drive_info.ata_Options.dmaSupported)
     {
         ret = ata_Write_Stream_Ext(device, true, streamID, flush, writeContinuous, commandCCTL, LBA, ptrData, dataSize);
         if (ret == SUCCESS)
@@ -715,7 +711,7 @@ int send_ATA_Write_Stream_Cmd(tDevice *device, uint8_t streamID, bool flush, boo
             {
                 //turn off DMA mode
                 dmaRetry = true;
-                streamDMA = false;
+                device->drive_info.ata_Options.writeStreamDMAFailed = true;
             }
             else
             {
@@ -728,7 +724,7 @@ int send_ATA_Write_Stream_Cmd(tDevice *device, uint8_t streamID, bool flush, boo
     if (dmaRetry && ret != SUCCESS)
     {
         //this means something else is wrong, and it's not the DMA mode, so we can turn it back on
-        streamDMA = true;
+        device->drive_info.ata_Options.writeStreamDMAFailed = false;
     }
     return ret;
 }
@@ -744,6 +740,8 @@ int fill_In_ATA_Drive_Info(tDevice *device)
 #endif
 
     bool retrievedIdentifyData = false;
+    //identify data is being reread, so anything the software translator derived from it must be rebuilt
+    free_Memoized_Supported_Op_Codes(device);
     //try an identify command, then also try an identify packet device command. The data we care about parsing will be in the same location so everything inside this if should work as expected
     //Note: if this is NOT an ATA HDD or SSD, then this code will only try one command: 85h SAT CDB since most ATAPI devices do not properly validate all fields of A1h and often receive it as a packet passthrough command for "blank"
     if ((device->drive_info.drive_type == ATAPI_DRIVE || device->drive_info.drive_type == LEGACY_TAPE_DRIVE || device->drive_info.media_type == MEDIA_OPTICAL || device->drive_info.media_type == MEDIA_TAPE)
@@ -836,20 +834,10 @@ int fill_In_ATA_Drive_Info(tDevice *device)
             device->drive_info.T10_vendor_ident[7] = 0;
         }
         device->drive_info.numberOfLUs = 1;
-        memcpy(fillModelNumber, &ident_word[27], MODEL_NUM_LEN);
-        fillModelNumber[MODEL_NUM_LEN] = '\0';
-        memcpy(fillSerialNumber, &ident_word[10], SERIAL_NUM_LEN);
-        fillSerialNumber[SERIAL_NUM_LEN] = '\0';
-        memcpy(fillFWRev, &ident_word[23], 8);
-        fillFWRev[FW_REV_LEN] = '\0';
-        //Byte swap due to endianess
-        byte_Swap_String(fillModelNumber);
-        byte_Swap_String(fillSerialNumber);
-        byte_Swap_String(fillFWRev);
-        //remove leading and trailing whitespace
-        remove_Leading_And_Trailing_Whitespace(fillModelNumber);
-        remove_Leading_And_Trailing_Whitespace(fillSerialNumber);
-        remove_Leading_And_Trailing_Whitespace(fillFWRev);
+        //Byte swap due to endianess and remove leading and trailing whitespace
+        copy_Device_String(fillModelNumber, MODEL_NUM_LEN + 1, (const uint8_t*)&ident_word[27], MODEL_NUM_LEN, DEVICE_STRING_WORD_SWAP);
+        copy_Device_String(fillSerialNumber, SERIAL_NUM_LEN + 1, (const uint8_t*)&ident_word[10], SERIAL_NUM_LEN, DEVICE_STRING_WORD_SWAP);
+        copy_Device_String(fillFWRev, FW_REV_LEN + 1, (const uint8_t*)&ident_word[23], 8, DEVICE_STRING_WORD_SWAP);
         //get the WWN
         *fillWWN = M_WordsTo8ByteValue(device->drive_info.IdentifyData.ata.Word108,\
                                        device->drive_info.IdentifyData.ata.Word109,\
@@ -12,6 +12,7 @@
 #include <stdio.h>
 #include <dirent.h>
 #include "cam_helper.h"
+#include "cmds.h"
 #include "scsi_helper_func.h"
 #include "ata_helper_func.h"
 #include "sat_helper_func.h"
@@ -791,6 +792,11 @@ static int ada_filter( const struct dirent *entry )
 
 int close_Device(tDevice *dev)
 {
+    stop_Async_IO(dev);
+    free_Zone_Map(dev);
+    stop_Device_Buffer_Pool(dev);
+    stop_Device_Log_Cache(dev);
+    free_Memoized_Supported_Op_Codes(dev);
     if (cam_dev)
     {
         cam_close_device(cam_dev);
@@ -975,6 +981,26 @@ int os_Flush(tDevice *device)
     return NOT_SUPPORTED;
 }
 
+int os_Async_IO_Init(tDevice *device, asyncIOQueue *queue)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Submit_Async_IO(tDevice *device, asyncIOQueue *queue, asyncIOSlot *slot)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Reap_Async_IO(tDevice *device, asyncIOQueue *queue, uint32_t timeoutMilliseconds, asyncIOSlot **completedSlot)
+{
+    return NOT_SUPPORTED;
+}
+
+void os_Async_IO_Cleanup(tDevice *device, asyncIOQueue *queue)
+{
+    return;
+}
+
 //TODO: Add code for CAM resets. There should be XPT function codes to do some amount of resetting
 int os_Device_Reset(tDevice *device)
 {
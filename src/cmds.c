@@ -257,6 +257,12 @@ int fill_Drive_Info_Data(tDevice *device)
             status = BAD_PARAMETER;
             return status;
         }
+        eDiscoveryOptions requestedFlags = device->dFlags;
+        if ((device->dFlags & LAZY_DISCOVERY) && M_Word0(device->dFlags) == DEFAULT_DISCOVERY)
+        {
+            //only read the identity tier now. complete_Drive_Info_Data() reads the rest when it is needed
+            device->dFlags = (eDiscoveryOptions)((device->dFlags & ~UINT64_C(0xFFFF)) | FAST_SCAN);
+        }
         switch (device->drive_info.interface_type)
         {
         case IDE_INTERFACE:
@@ -293,6 +299,16 @@ int fill_Drive_Info_Data(tDevice *device)
             status = fill_In_Device_Info(device);
             break;
         }       
+        //NVMe discovery is only the identify commands, so it is always complete
+        if ((M_Word0(device->dFlags) == FAST_SCAN || M_Word0(device->dFlags) == DO_NOT_WAKE_DRIVE) && device->drive_info.interface_type != NVME_INTERFACE)
+        {
+            device->driveInfoTier = DRIVE_INFO_TIER_IDENTITY;
+        }
+        else
+        {
+            device->driveInfoTier = DRIVE_INFO_TIER_COMPLETE;
+        }
+        device->dFlags = requestedFlags;
     }
     else
     {
@@ -310,12 +326,391 @@ int fill_Drive_Info_Data(tDevice *device)
     return status;
 }
 
+int complete_Drive_Info_Data(tDevice *device)
+{
+    int ret = SUCCESS;
+    if (!device)
+    {
+        return BAD_PARAMETER;
+    }
+    if (device->driveInfoTier != DRIVE_INFO_TIER_COMPLETE)
+    {
+        eDiscoveryOptions requestedFlags = device->dFlags;
+        if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+        {
+            printf("Completing device discovery for %s\n", device->os_info.name);
+        }
+        device->dFlags = (eDiscoveryOptions)(device->dFlags & ~(UINT64_C(0xFFFF) | LAZY_DISCOVERY));
+        //Marked complete while discovery runs so that entry points reached from discovery itself (ex: the software translators) do not start it again
+        device->driveInfoTier = DRIVE_INFO_TIER_COMPLETE;
+        ret = fill_Drive_Info_Data(device);
+        device->dFlags = requestedFlags;
+        if (ret != SUCCESS)
+        {
+            //leave this marked incomplete so the next access can try again
+            device->driveInfoTier = DRIVE_INFO_TIER_IDENTITY;
+        }
+    }
+    return ret;
+}
+
+int complete_Lazy_Drive_Info_Data(tDevice *device)
+{
+    if (!device || device->driveInfoTier == DRIVE_INFO_TIER_COMPLETE || !(device->dFlags & LAZY_DISCOVERY))
+    {
+        return SUCCESS;
+    }
+    return complete_Drive_Info_Data(device);
+}
+
+uint64_t get_Drive_Info_Max_LBA(tDevice *device)
+{
+    complete_Lazy_Drive_Info_Data(device);
+    return device->drive_info.deviceMaxLba;
+}
+
+uint32_t get_Drive_Info_Logical_Block_Size(tDevice *device)
+{
+    complete_Lazy_Drive_Info_Data(device);
+    return device->drive_info.deviceBlockSize;
+}
+
+uint32_t get_Drive_Info_Physical_Block_Size(tDevice *device)
+{
+    complete_Lazy_Drive_Info_Data(device);
+    return device->drive_info.devicePhyBlockSize;
+}
+
+eZonedDeviceType get_Drive_Info_Zoned_Type(tDevice *device)
+{
+    complete_Lazy_Drive_Info_Data(device);
+    return device->drive_info.zonedType;
+}
+
+//Discovery cache. Each record is written with a single unbuffered append, so devices discovered on multiple threads can add records at the same time without a lock.
+//When reading, the last record matching a device wins. Records from a different library layout are skipped.
+#define DISCOVERY_CACHE_SIGNATURE "SEADSCVR"
+#define DISCOVERY_CACHE_MAX_FILE_SIZE (64 * 1024 * 1024)//the file is started over when it grows beyond this from repeated appends
+static char discoveryCacheFile[4096] = { 0 };
+
+typedef struct _discoveryCacheRecord
+{
+    char signature[8];
+    uint32_t deviceBlockVersion;
+    uint32_t recordSize;
+    //key. These are set by the OS layer before any commands are sent.
+    char handle[256];
+    eInterfaceType interfaceType;
+    eDriveType driveType;
+    uint32_t namespaceID;
+    eAdapterInfoType adapterType;
+    uint32_t adapterVendorID;
+    uint32_t adapterProductID;
+    uint32_t adapterRevision;
+    //validation. Hash of the identifying data read from the device (see get_Discovery_Cache_Validation)
+    bool unitSNInValidation;
+    uint64_t validationHash;
+    eDriveInfoTier driveInfoTier;
+    driveInfo info;
+}discoveryCacheRecord;
+
+int set_Discovery_Cache_File(const char *path)
+{
+    if (!path)
+    {
+        memset(discoveryCacheFile, 0, sizeof(discoveryCacheFile));
+        return SUCCESS;
+    }
+    if (strlen(path) >= sizeof(discoveryCacheFile))
+    {
+        return BAD_PARAMETER;
+    }
+    snprintf(discoveryCacheFile, sizeof(discoveryCacheFile), "%s", path);
+    return SUCCESS;
+}
+
+int clear_Discovery_Cache(void)
+{
+    if (discoveryCacheFile[0] == '\0')
+    {
+        return NOT_SUPPORTED;
+    }
+    if (remove(discoveryCacheFile) != 0)
+    {
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+//FNV-1a
+static uint64_t discovery_Cache_Hash(uint64_t hash, const uint8_t *data, uint32_t length)
+{
+    for (uint32_t iter = 0; iter < length; ++iter)
+    {
+        hash ^= data[iter];
+        hash *= UINT64_C(0x100000001B3);
+    }
+    return hash;
+}
+
+static void set_Discovery_Cache_Key(tDevice *device, discoveryCacheRecord *record)
+{
+    memcpy(record->signature, DISCOVERY_CACHE_SIGNATURE, sizeof(record->signature));
+    record->deviceBlockVersion = DEVICE_BLOCK_VERSION;
+    record->recordSize = sizeof(discoveryCacheRecord);
+    snprintf(record->handle, sizeof(record->handle), "%s", device->os_info.name);
+    record->interfaceType = device->drive_info.interface_type;
+    record->driveType = device->drive_info.drive_type;
+    record->namespaceID = device->drive_info.namespaceID;
+    record->adapterType = device->drive_info.adapter_info.infoType;
+    record->adapterVendorID = device->drive_info.adapter_info.vendorID;
+    record->adapterProductID = device->drive_info.adapter_info.productID;
+    record->adapterRevision = device->drive_info.adapter_info.revision;
+}
+
+static bool discovery_Cache_Key_Match(discoveryCacheRecord *key, discoveryCacheRecord *record)
+{
+    return memcmp(record->signature, DISCOVERY_CACHE_SIGNATURE, sizeof(record->signature)) == 0
+        && record->deviceBlockVersion == DEVICE_BLOCK_VERSION
+        && record->recordSize == sizeof(discoveryCacheRecord)
+        && strncmp(record->handle, key->handle, sizeof(record->handle)) == 0
+        && record->interfaceType == key->interfaceType
+        && record->driveType == key->driveType
+        && record->namespaceID == key->namespaceID
+        && record->adapterType == key->adapterType
+        && record->adapterVendorID == key->adapterVendorID
+        && record->adapterProductID == key->adapterProductID
+        && record->adapterRevision == key->adapterRevision;
+}
+
+//Reads the data that identifies the device and its current configuration and hashes it. This is what decides if a cached record still describes the device.
+//NVMe: identify controller and namespace. ATA: identify device. SCSI: standard inquiry, read capacity and optionally the unit serial number VPD page.
+//Any of these changing (new drive, new firmware, format to a new sector size, etc) means the cached information cannot be used.
+static int get_Discovery_Cache_Validation(tDevice *device, bool includeUnitSN, uint64_t *validationHash)
+{
+    int ret = SUCCESS;
+    uint64_t hash = UINT64_C(0xCBF29CE484222325);
+    uint8_t *validationData = lease_Device_Buffer(device, 2 * NVME_IDENTIFY_DATA_LEN);
+    if (!validationData)
+    {
+        return MEMORY_FAILURE;
+    }
+    switch (device->drive_info.interface_type)
+    {
+    case NVME_INTERFACE:
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+        ret = nvme_Identify(device, validationData, 0, 1);
+        if (ret == SUCCESS)
+        {
+            ret = nvme_Identify(device, &validationData[NVME_IDENTIFY_DATA_LEN], device->drive_info.namespaceID, 0);
+        }
+        if (ret == SUCCESS)
+        {
+            hash = discovery_Cache_Hash(hash, validationData, 2 * NVME_IDENTIFY_DATA_LEN);
+        }
+        break;
+#else
+        ret = NOT_SUPPORTED;
+        break;
+#endif
+    case IDE_INTERFACE:
+        if (device->drive_info.drive_type != ATAPI_DRIVE && device->drive_info.drive_type != LEGACY_TAPE_DRIVE)
+        {
+            ret = ata_Identify(device, validationData, LEGACY_DRIVE_SEC_SIZE);
+            if (ret == SUCCESS)
+            {
+                hash = discovery_Cache_Hash(hash, validationData, LEGACY_DRIVE_SEC_SIZE);
+            }
+            break;
+        }
+        //fall through for ATAPI devices, which are discovered with SCSI commands
+    default:
+        ret = scsi_Inquiry(device, validationData, 96, 0, false, false);
+        if (ret == SUCCESS)
+        {
+            hash = discovery_Cache_Hash(hash, validationData, 96);
+            memset(validationData, 0, 96);
+            ret = scsi_Read_Capacity_10(device, validationData, READ_CAPACITY_10_LEN);
+            if (ret == SUCCESS)
+            {
+                hash = discovery_Cache_Hash(hash, validationData, READ_CAPACITY_10_LEN);
+                if (M_BytesTo4ByteValue(validationData[0], validationData[1], validationData[2], validationData[3]) == UINT32_MAX)
+                {
+                    memset(validationData, 0, READ_CAPACITY_16_LEN);
+                    ret = scsi_Read_Capacity_16(device, validationData, READ_CAPACITY_16_LEN);
+                    hash = discovery_Cache_Hash(hash, validationData, READ_CAPACITY_16_LEN);
+                }
+            }
+            else
+            {
+                //Devices without media (or that don't support the command) still fail the same way each time, so that is fine to hash as well
+                ret = SUCCESS;
+            }
+        }
+        if (ret == SUCCESS && includeUnitSN)
+        {
+            memset(validationData, 0, 256);
+            if (SUCCESS == scsi_Inquiry(device, validationData, 255, UNIT_SERIAL_NUMBER, true, false))
+            {
+                hash = discovery_Cache_Hash(hash, validationData, 255);
+            }
+        }
+        break;
+    }
+    safe_Return_Device_Buffer(device, validationData);
+    *validationHash = hash;
+    return ret;
+}
+
+//Looks for a record for this device and validates it against the device. Returns SUCCESS when device->drive_info was filled in from the cache.
+static int load_Discovery_Cache_Record(tDevice *device)
+{
+    int ret = NOT_SUPPORTED;
+    FILE *cacheFile = NULL;
+    discoveryCacheRecord *key = NULL;
+    discoveryCacheRecord *record = NULL;
+    discoveryCacheRecord *match = NULL;
+    uint64_t validationHash = 0;
+    if (discoveryCacheFile[0] == '\0')
+    {
+        return NOT_SUPPORTED;
+    }
+    cacheFile = fopen(discoveryCacheFile, "rb");
+    if (!cacheFile)
+    {
+        return NOT_SUPPORTED;
+    }
+    key = (discoveryCacheRecord*)calloc(1, sizeof(discoveryCacheRecord));
+    record = (discoveryCacheRecord*)calloc(1, sizeof(discoveryCacheRecord));
+    match = (discoveryCacheRecord*)calloc(1, sizeof(discoveryCacheRecord));
+    if (!key || !record || !match)
+    {
+        safe_Free(key);
+        safe_Free(record);
+        safe_Free(match);
+        fclose(cacheFile);
+        return MEMORY_FAILURE;
+    }
+    set_Discovery_Cache_Key(device, key);
+    while (1 == fread(record, sizeof(discoveryCacheRecord), 1, cacheFile))
+    {
+        //A record from a lazy or fast scan cannot be used when full discovery was requested
+        if (discovery_Cache_Key_Match(key, record) && (record->driveInfoTier == DRIVE_INFO_TIER_COMPLETE || M_Word0(device->dFlags) != DEFAULT_DISCOVERY || (device->dFlags & LAZY_DISCOVERY)))
+        {
+            memcpy(match, record, sizeof(discoveryCacheRecord));
+            ret = SUCCESS;
+        }
+    }
+    fclose(cacheFile);
+    if (ret == SUCCESS)
+    {
+        ret = get_Discovery_Cache_Validation(device, match->unitSNInValidation, &validationHash);
+        if (ret == SUCCESS && validationHash == match->validationHash)
+        {
+            memcpy(&device->drive_info, &match->info, sizeof(driveInfo));
+            device->driveInfoTier = match->driveInfoTier;
+            //anything built from the identify data that was just replaced must be rebuilt
+            free_Memoized_Supported_Op_Codes(device);
+            if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+            {
+                printf("Using cached discovery information for %s\n", device->os_info.name);
+            }
+        }
+        else
+        {
+            ret = FAILURE;
+        }
+    }
+    safe_Free(key);
+    safe_Free(record);
+    safe_Free(match);
+    return ret;
+}
+
+static int save_Discovery_Cache_Record(tDevice *device, discoveryCacheRecord *record)
+{
+    int ret = SUCCESS;
+    FILE *cacheFile = NULL;
+    if (discoveryCacheFile[0] == '\0')
+    {
+        return NOT_SUPPORTED;
+    }
+    //The unit serial number is only requested when the discovered hacks say it is safe to do so on this device.
+    record->unitSNInValidation = device->drive_info.interface_type != NVME_INTERFACE && (!device->drive_info.passThroughHacks.scsiHacks.noVPDPages || device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable);
+    ret = get_Discovery_Cache_Validation(device, record->unitSNInValidation, &record->validationHash);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    memcpy(&record->info, &device->drive_info, sizeof(driveInfo));
+    record->driveInfoTier = device->driveInfoTier;
+    cacheFile = fopen(discoveryCacheFile, "rb");
+    if (cacheFile)
+    {
+        long cacheSize = 0;
+        if (0 == fseek(cacheFile, 0, SEEK_END))
+        {
+            cacheSize = ftell(cacheFile);
+        }
+        fclose(cacheFile);
+        if (cacheSize > DISCOVERY_CACHE_MAX_FILE_SIZE)
+        {
+            remove(discoveryCacheFile);
+        }
+    }
+    cacheFile = fopen(discoveryCacheFile, "ab");
+    if (!cacheFile)
+    {
+        return FAILURE;
+    }
+    //unbuffered so the record goes out in one write and is not interleaved with records from other threads
+    setvbuf(cacheFile, NULL, _IONBF, 0);
+    if (1 != fwrite(record, sizeof(discoveryCacheRecord), 1, cacheFile))
+    {
+        ret = FAILURE;
+    }
+    fclose(cacheFile);
+    return ret;
+}
+
+int fill_Drive_Info_Data_With_Cache(tDevice *device)
+{
+    int ret = SUCCESS;
+    discoveryCacheRecord *record = NULL;
+    if (!device)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!(device->dFlags & DISCOVERY_CACHE) || discoveryCacheFile[0] == '\0')
+    {
+        return fill_Drive_Info_Data(device);
+    }
+    if (SUCCESS == load_Discovery_Cache_Record(device))
+    {
+        return SUCCESS;
+    }
+    //the key must be taken before discovery since discovery can change the interface and drive type
+    record = (discoveryCacheRecord*)calloc(1, sizeof(discoveryCacheRecord));
+    if (record)
+    {
+        set_Discovery_Cache_Key(device, record);
+    }
+    ret = fill_Drive_Info_Data(device);
+    if (ret == SUCCESS && record)
+    {
+        save_Discovery_Cache_Record(device, record);
+    }
+    safe_Free(record);
+    return ret;
+}
+
 int firmware_Download_Command(tDevice *device, eDownloadMode dlMode, uint32_t offset, uint32_t xferLen, uint8_t *ptrData, uint8_t slotNumber, bool existingImage)
 {
     int ret = UNKNOWN;
 #ifdef _DEBUG
     printf("-->%s\n",__FUNCTION__);
 #endif
+    complete_Lazy_Drive_Info_Data(device);
     switch (device->drive_info.drive_type)
     {
     case ATA_DRIVE:
@@ -610,6 +1005,7 @@ int write_Same(tDevice *device, uint64_t startingLba, uint64_t numberOfLogicalBl
 {
     int ret = UNKNOWN;
     bool noDataTransfer = false;
+    complete_Lazy_Drive_Info_Data(device);
     if (!pattern)
     {
         noDataTransfer = true;
@@ -640,7 +1036,7 @@ int write_Same(tDevice *device, uint64_t startingLba, uint64_t numberOfLogicalBl
             uint8_t feature = LEGACY_WRITE_SAME_INITIALIZE_SPECIFIED_SECTORS;
             if (noDataTransfer)
             {
-                pattern = (uint8_t*)calloc_aligned(device->drive_info.deviceBlockSize, sizeof(uint8_t), device->os_info.minimumAlignment);
+                pattern = lease_Device_Buffer(device, device->drive_info.deviceBlockSize);
                 localPattern = true;
             }
             //Check range to see which feature to use
@@ -680,7 +1076,7 @@ int write_Same(tDevice *device, uint64_t startingLba, uint64_t numberOfLogicalBl
             }
             if (localPattern)
             {
-                safe_Free_aligned(pattern);
+                safe_Return_Device_Buffer(device, pattern);
             }
         }
         else
@@ -746,7 +1142,9 @@ int write_Psuedo_Uncorrectable_Error(tDevice *device, uint64_t corruptLBA)
 {
     int ret = UNKNOWN;
     bool multipleLogicalPerPhysical = false;//used to set the physical block bit when applicable
-    uint16_t logicalPerPhysicalBlocks = (uint16_t)(device->drive_info.devicePhyBlockSize / device->drive_info.deviceBlockSize);
+    uint16_t logicalPerPhysicalBlocks = 0;
+    complete_Lazy_Drive_Info_Data(device);
+    logicalPerPhysicalBlocks = (uint16_t)(device->drive_info.devicePhyBlockSize / device->drive_info.deviceBlockSize);
     if (logicalPerPhysicalBlocks > 1)
     {
         //since this device has multiple logical blocks per physical block, we also need to adjust the LBA to be at the start of the physical block
@@ -795,6 +1193,7 @@ int write_Psuedo_Uncorrectable_Error(tDevice *device, uint64_t corruptLBA)
 bool is_Write_Flagged_Uncorrectable_Supported(tDevice *device)
 {
     bool supported = false;
+    complete_Lazy_Drive_Info_Data(device);
     switch (device->drive_info.drive_type)
     {
     case ATA_DRIVE:
@@ -833,6 +1232,7 @@ bool is_Write_Flagged_Uncorrectable_Supported(tDevice *device)
 int write_Flagged_Uncorrectable_Error(tDevice *device, uint64_t corruptLBA)
 {
     int ret = UNKNOWN;
+    complete_Lazy_Drive_Info_Data(device);
     //This will only flag individual logical blocks
     switch (device->drive_info.drive_type)
     {
@@ -873,6 +1273,7 @@ int ata_Read(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint32
 {
     int ret = SUCCESS;//assume success
     uint32_t sectors = 0;
+    complete_Lazy_Drive_Info_Data(device);
     //make sure that the data size is at least logical sector in size
     if (dataSize < device->drive_info.deviceBlockSize)
     {
@@ -881,8 +1282,7 @@ int ata_Read(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint32
     sectors = dataSize / device->drive_info.deviceBlockSize;
     if (async)
     {
-        //asynchronous not supported yet
-        return NOT_SUPPORTED;
+        return submit_Async_IO(device, false, lba, ptrData, dataSize, NULL);
     }
     else //synchronous reads
     {   
@@ -1124,6 +1524,7 @@ int ata_Write(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint3
 {
     int ret = SUCCESS;//assume success
     uint32_t sectors = 0;
+    complete_Lazy_Drive_Info_Data(device);
     //make sure that the data size is at least logical sector in size
     if (dataSize < device->drive_info.deviceBlockSize)
     {
@@ -1132,8 +1533,7 @@ int ata_Write(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint3
     sectors = dataSize / device->drive_info.deviceBlockSize;
     if (async)
     {
-        //asynchronous not supported yet
-        return NOT_SUPPORTED;
+        return submit_Async_IO(device, true, lba, ptrData, dataSize, NULL);
     }
     else //synchronous writes
     {
@@ -1375,6 +1775,7 @@ int scsi_Read(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint3
 {
     int ret = SUCCESS;//assume success
     uint32_t sectors = 0;
+    complete_Lazy_Drive_Info_Data(device);
     //make sure that the data size is at least logical sector in size
     if (dataSize < device->drive_info.deviceBlockSize)
     {
@@ -1383,8 +1784,7 @@ int scsi_Read(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint3
     sectors = dataSize / device->drive_info.deviceBlockSize;
     if (async)
     {
-        //asynchronous not supported yet
-        return NOT_SUPPORTED;
+        return submit_Async_IO(device, false, lba, ptrData, dataSize, NULL);
     }
     else //synchronous reads
     {
@@ -1459,6 +1859,7 @@ int scsi_Write(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint
 {
     int ret = SUCCESS;//assume success
     uint32_t sectors = 0;
+    complete_Lazy_Drive_Info_Data(device);
     //make sure that the data size is at least logical sector in size
     if (dataSize < device->drive_info.deviceBlockSize)
     {
@@ -1467,8 +1868,7 @@ int scsi_Write(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint
     sectors = dataSize / device->drive_info.deviceBlockSize;
     if (async)
     {
-        //asynchronous not supported yet
-        return NOT_SUPPORTED;
+        return submit_Async_IO(device, true, lba, ptrData, dataSize, NULL);
     }
     else //synchronous reads
     {
@@ -1539,18 +1939,164 @@ int scsi_Write(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint
     return ret;
 }
 
+uint32_t get_Max_Transfer_Length_Blocks(tDevice *device)
+{
+    uint32_t maxBlocks = UINT32_MAX;
+    uint32_t maxBytes = 0;
+    if (!device)
+    {
+        return maxBlocks;
+    }
+    complete_Lazy_Drive_Info_Data(device);
+    if (device->drive_info.deviceBlockSize == 0)
+    {
+        return maxBlocks;
+    }
+    switch (device->drive_info.interface_type)
+    {
+    case IDE_INTERFACE:
+        if (device->drive_info.ata_Options.fourtyEightBitAddressFeatureSetSupported && !device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly)
+        {
+            maxBlocks = 65536;
+        }
+        else
+        {
+            maxBlocks = 256;
+        }
+        maxBytes = device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength;
+        break;
+    case NVME_INTERFACE:
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+        //number of logical blocks is a 16bit zeroes based value
+        maxBlocks = 65536;
+        if (device->drive_info.IdentifyData.nvme.ctrl.mdts > 0)
+        {
+            //MDTS is a power of 2 in units of the controller's minimum memory page size (CAP.MPSMIN). That is not read in here, so assume the 4KiB minimum.
+            if (device->drive_info.IdentifyData.nvme.ctrl.mdts < 20)
+            {
+                maxBytes = UINT32_C(4096) << device->drive_info.IdentifyData.nvme.ctrl.mdts;
+            }
+        }
+        if (device->drive_info.passThroughHacks.nvmePTHacks.maxTransferLength > 0)
+        {
+            maxBytes = maxBytes > 0 ? M_Min(maxBytes, device->drive_info.passThroughHacks.nvmePTHacks.maxTransferLength) : device->drive_info.passThroughHacks.nvmePTHacks.maxTransferLength;
+        }
+        break;
+#endif
+    default:
+        //SCSI reads and writes. Only the 6 and 10 byte commands limit the transfer length.
+        if (device->drive_info.passThroughHacks.scsiHacks.readWrite.available)
+        {
+            if (!device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 && !device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12)
+            {
+                if (device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10)
+                {
+                    maxBlocks = UINT16_MAX;
+                }
+                else if (device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6)
+                {
+                    maxBlocks = 256;
+                }
+            }
+        }
+        else if (device->drive_info.scsiVersion < SCSI_VERSION_SPC_3)
+        {
+            maxBlocks = UINT16_MAX;
+        }
+        maxBytes = device->drive_info.passThroughHacks.scsiHacks.maxTransferLength;
+        break;
+    }
+    if (maxBytes > 0)
+    {
+        maxBlocks = M_Min(maxBlocks, M_Max(UINT32_C(1), maxBytes / device->drive_info.deviceBlockSize));
+    }
+    return maxBlocks;
+}
+
+//Issues a read or write that is too large for a single command as a series of commands of at most maxBlocks each.
+//If the device has an asynchronous IO queue that the OS can keep multiple commands in flight on, and the caller has nothing else outstanding on it, the chunks are pipelined through it.
+static int split_IO_Transfer(tDevice *device, bool write, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, uint32_t maxBlocks)
+{
+    int ret = SUCCESS;
+    uint32_t chunkSize = maxBlocks * device->drive_info.deviceBlockSize;
+    uint32_t offset = 0;
+    if (device->asyncIO && device->asyncIO->osQueueDepth > 1 && get_Async_IO_Outstanding_Count(device) == 0)
+    {
+        uint32_t inFlightLimit = M_Min(device->asyncIO->queueDepth, device->asyncIO->osQueueDepth);
+        uint32_t outstanding = 0;
+        while (offset < dataSize || outstanding > 0)
+        {
+            asyncIOCompletion completion;
+            int waitRet = SUCCESS;
+            while (ret == SUCCESS && offset < dataSize && outstanding < inFlightLimit)
+            {
+                uint32_t thisChunk = M_Min(chunkSize, dataSize - offset);
+                ret = submit_Async_IO(device, write, lba + (offset / device->drive_info.deviceBlockSize), ptrData + offset, thisChunk, NULL);
+                if (ret == SUCCESS)
+                {
+                    offset += thisChunk;
+                    ++outstanding;
+                }
+            }
+            if (outstanding == 0)
+            {
+                break;
+            }
+            waitRet = wait_Async_IO(device, &completion, ASYNC_IO_INFINITE_WAIT);
+            if (waitRet == SUCCESS)
+            {
+                --outstanding;
+                if (completion.result != SUCCESS && ret == SUCCESS)
+                {
+                    //keep the sense data from the first failure so the caller can see why
+                    ret = completion.result;
+                    memcpy(device->drive_info.lastCommandSenseData, completion.senseData, SPC3_SENSE_LEN);
+                }
+            }
+            else if (waitRet != IN_PROGRESS)
+            {
+                ret = waitRet;
+                break;
+            }
+        }
+    }
+    else
+    {
+        while (ret == SUCCESS && offset < dataSize)
+        {
+            uint32_t thisChunk = M_Min(chunkSize, dataSize - offset);
+            if (write)
+            {
+                ret = io_Write(device, lba + (offset / device->drive_info.deviceBlockSize), false, ptrData + offset, thisChunk);
+            }
+            else
+            {
+                ret = io_Read(device, lba + (offset / device->drive_info.deviceBlockSize), false, ptrData + offset, thisChunk);
+            }
+            offset += thisChunk;
+        }
+    }
+    return ret;
+}
+
 int io_Read(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32_t dataSize)
 {
-    //asynchronous not supported yet
+    complete_Lazy_Drive_Info_Data(device);
     if (async)
     {
-        return NOT_SUPPORTED;
+        return submit_Async_IO(device, false, lba, ptrData, dataSize, NULL);
     }
+    uint32_t maxBlocks = 0;
     //make sure that the data size is at least logical sector in size
     if (dataSize < device->drive_info.deviceBlockSize)
     {
         return BAD_PARAMETER;
     }
+    maxBlocks = get_Max_Transfer_Length_Blocks(device);
+    if ((dataSize / device->drive_info.deviceBlockSize) > maxBlocks)
+    {
+        return split_IO_Transfer(device, false, lba, ptrData, dataSize, maxBlocks);
+    }
 
     switch (device->drive_info.interface_type)
     {
@@ -1568,7 +2114,7 @@ int io_Read(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32_
         break;
     case NVME_INTERFACE:
 #if !defined (DISABLE_NVME_PASSTHROUGH)
-        return nvme_Read(device, lba, (dataSize / device->drive_info.deviceBlockSize) - 1, false, false, 0, ptrData, dataSize);
+        return nvme_Read(device, lba, (uint16_t)((dataSize / device->drive_info.deviceBlockSize) - 1), false, false, 0, ptrData, dataSize);
 #else 
         //perform SCSI reads
         return scsi_Read(device, lba, async, ptrData, dataSize);
@@ -1586,16 +2132,22 @@ int io_Read(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32_
 
 int io_Write(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32_t dataSize)
 {
-    //asynchronous not supported yet
+    complete_Lazy_Drive_Info_Data(device);
     if (async)
     {
-        return NOT_SUPPORTED;
+        return submit_Async_IO(device, true, lba, ptrData, dataSize, NULL);
     }
+    uint32_t maxBlocks = 0;
     //make sure that the data size is at least logical sector in size
     if (dataSize < device->drive_info.deviceBlockSize)
     {
         return BAD_PARAMETER;
     }
+    maxBlocks = get_Max_Transfer_Length_Blocks(device);
+    if ((dataSize / device->drive_info.deviceBlockSize) > maxBlocks)
+    {
+        return split_IO_Transfer(device, true, lba, ptrData, dataSize, maxBlocks);
+    }
 
     switch (device->drive_info.interface_type)
     {
@@ -1613,7 +2165,7 @@ int io_Write(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32
         break;
     case NVME_INTERFACE:
 #if !defined (DISABLE_NVME_PASSTHROUGH)
-        return nvme_Write(device, lba, (dataSize / device->drive_info.deviceBlockSize) - 1, false, false, 0, 0, ptrData, dataSize);
+        return nvme_Write(device, lba, (uint16_t)((dataSize / device->drive_info.deviceBlockSize) - 1), false, false, 0, 0, ptrData, dataSize);
 #else 
         //perform SCSI writes
         return scsi_Write(device, lba, async, ptrData, dataSize);
@@ -1628,36 +2180,525 @@ int io_Write(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32
     return UNKNOWN;
 }
 
-int read_LBA(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32_t dataSize)
+//Large transfers do better through the block layer (multi-queue, request merging, no per command passthrough translation) when the caller opted in.
+static bool use_OS_Block_IO(tDevice *device, uint32_t dataSize)
 {
-    if (device->os_info.osReadWriteRecommended)
+    return (device->dFlags & OS_BLOCK_IO_FOR_LARGE_TRANSFERS) && dataSize >= OS_BLOCK_IO_MIN_TRANSFER_SIZE;
+}
+
+int read_LBA(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32_t dataSize)
+{
+    complete_Lazy_Drive_Info_Data(device);
+    if (async)
+    {
+        return submit_Async_IO(device, false, lba, ptrData, dataSize, NULL);
+    }
+    if (device->os_info.osReadWriteRecommended)
     {
-        //Old comment says this function does not always work reliably in Windows...This is NOT functional in other OS's.
+        //Old comment says this function does not always work reliably in Windows...
         return os_Read(device, lba, async, ptrData, dataSize);
     }
     else
     {
+        if (use_OS_Block_IO(device, dataSize))
+        {
+            int ret = os_Read(device, lba, async, ptrData, dataSize);
+            if (ret != NOT_SUPPORTED)
+            {
+                return ret;
+            }
+        }
         return io_Read(device, lba, async, ptrData, dataSize);
     }
 }
 
 
+//Zone conditions that have a write pointer
+static bool zone_Condition_Has_Write_Pointer(uint8_t zoneCondition)
+{
+    switch (zoneCondition)
+    {
+    case ZONE_CONDITION_EMPTY:
+    case ZONE_CONDITION_IMPLICITLY_OPENED:
+    case ZONE_CONDITION_EXPLICITLY_OPENED:
+    case ZONE_CONDITION_CLOSED:
+    case ZONE_CONDITION_FULL:
+        return true;
+    default:
+        return false;
+    }
+}
+
+//Moves the zone map's write pointers forward for a successful write so that the map does not have to be refreshed from the device.
+static void update_Zone_Map_After_Write(tDevice *device, uint64_t lba, uint32_t dataSize)
+{
+    deviceZoneMap *map = device->zoneMap;
+    uint32_t zoneIndex = 0;
+    uint64_t endLBA = 0;
+    if (!map || device->drive_info.deviceBlockSize == 0 || SUCCESS != get_Zone_Map_Index(device, lba, &zoneIndex))
+    {
+        return;
+    }
+    endLBA = lba + (dataSize / device->drive_info.deviceBlockSize);
+    for (; zoneIndex < map->zoneCount && map->zoneStart[zoneIndex] < endLBA; ++zoneIndex)
+    {
+        uint64_t zoneEnd = map->zoneStart[zoneIndex] + map->zoneLength[zoneIndex];
+        uint64_t newWritePointer = M_Min(endLBA, zoneEnd);
+        if (map->zoneType[zoneIndex] == ZONE_TYPE_CONVENTIONAL || !zone_Condition_Has_Write_Pointer(map->zoneCondition[zoneIndex]) || map->zoneCondition[zoneIndex] == ZONE_CONDITION_FULL)
+        {
+            continue;
+        }
+        if (newWritePointer > map->writePointer[zoneIndex])
+        {
+            map->writePointer[zoneIndex] = newWritePointer;
+        }
+        if (map->writePointer[zoneIndex] >= zoneEnd)
+        {
+            map->zoneCondition[zoneIndex] = ZONE_CONDITION_FULL;
+        }
+        else if (map->zoneCondition[zoneIndex] == ZONE_CONDITION_EMPTY || map->zoneCondition[zoneIndex] == ZONE_CONDITION_CLOSED)
+        {
+            map->zoneCondition[zoneIndex] = ZONE_CONDITION_IMPLICITLY_OPENED;
+        }
+    }
+}
+
 int write_LBA(tDevice *device, uint64_t lba, bool async, uint8_t* ptrData, uint32_t dataSize)
 {
+    complete_Lazy_Drive_Info_Data(device);
+    if (async)
+    {
+        return submit_Async_IO(device, true, lba, ptrData, dataSize, NULL);
+    }
+    int ret = NOT_SUPPORTED;
     if (device->os_info.osReadWriteRecommended)
     {
-        //Old comment says this function does not always work reliably in Windows...This is NOT functional in other OS's.
-        return os_Write(device, lba, async, ptrData, dataSize);
+        //Old comment says this function does not always work reliably in Windows...
+        ret = os_Write(device, lba, async, ptrData, dataSize);
+    }
+    else
+    {
+        if (use_OS_Block_IO(device, dataSize))
+        {
+            ret = os_Write(device, lba, async, ptrData, dataSize);
+        }
+        if (ret == NOT_SUPPORTED)
+        {
+            ret = io_Write(device, lba, async, ptrData, dataSize);
+        }
+    }
+    if (ret == SUCCESS)
+    {
+        update_Zone_Map_After_Write(device, lba, dataSize);
+    }
+    return ret;
+}
+
+int start_Async_IO(tDevice *device, uint32_t queueDepth)
+{
+    asyncIOQueue *queue = NULL;
+    if (!device)
+    {
+        return BAD_PARAMETER;
+    }
+    if (device->asyncIO)
+    {
+        return BAD_PARAMETER;
+    }
+    if (queueDepth == 0)
+    {
+        queueDepth = ASYNC_IO_DEFAULT_QUEUE_DEPTH;
+    }
+    queueDepth = M_Min(queueDepth, ASYNC_IO_MAX_QUEUE_DEPTH);
+    queue = (asyncIOQueue*)calloc(1, sizeof(asyncIOQueue));
+    if (!queue)
+    {
+        return MEMORY_FAILURE;
+    }
+    queue->slots = (asyncIOSlot*)calloc(queueDepth, sizeof(asyncIOSlot));
+    if (!queue->slots)
+    {
+        safe_Free(queue);
+        return MEMORY_FAILURE;
+    }
+    queue->queueDepth = queueDepth;
+    queue->nextTag = 1;
+    if (SUCCESS != os_Async_IO_Init(device, queue))
+    {
+        //No asynchronous interface in the OS for this device. Commands will be issued synchronously when they are waited on.
+        queue->osQueueDepth = 0;
+        queue->osContext = NULL;
+    }
+    if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+    {
+        printf("Async IO queue depth %" PRIu32 ", OS queue depth %" PRIu32 "\n", queue->queueDepth, queue->osQueueDepth);
+    }
+    device->asyncIO = queue;
+    return SUCCESS;
+}
+
+//Builds the read/write CDB for an asynchronous command following the same rules as scsi_Read/scsi_Write.
+static void build_Async_IO_CDB(tDevice *device, asyncIOSlot *slot)
+{
+    uint32_t sectors = slot->dataSize / device->drive_info.deviceBlockSize;
+    bool use16 = false;
+    memset(slot->cdb, 0, sizeof(slot->cdb));
+    if (device->drive_info.passThroughHacks.scsiHacks.readWrite.available)
+    {
+        if (device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16)
+        {
+            use16 = true;
+        }
+        else if (device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12)
+        {
+            slot->cdbLength = CDB_LEN_12;
+            slot->cdb[OPERATION_CODE] = slot->write ? WRITE12 : READ12;
+            slot->cdb[2] = M_Byte3(slot->lba);
+            slot->cdb[3] = M_Byte2(slot->lba);
+            slot->cdb[4] = M_Byte1(slot->lba);
+            slot->cdb[5] = M_Byte0(slot->lba);
+            slot->cdb[6] = M_Byte3(sectors);
+            slot->cdb[7] = M_Byte2(sectors);
+            slot->cdb[8] = M_Byte1(sectors);
+            slot->cdb[9] = M_Byte0(sectors);
+            return;
+        }
+        else if (device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 && !device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10)
+        {
+            slot->cdbLength = CDB_LEN_6;
+            slot->cdb[OPERATION_CODE] = slot->write ? WRITE6 : READ6;
+            slot->cdb[1] = M_GETBITRANGE(M_Byte2(slot->lba), 4, 0);
+            slot->cdb[2] = M_Byte1(slot->lba);
+            slot->cdb[3] = M_Byte0(slot->lba);
+            slot->cdb[4] = M_Byte0(sectors);//256 sectors is reported as 0
+            return;
+        }
+    }
+    else if (device->drive_info.scsiVersion >= SCSI_VERSION_SPC_3 && (device->drive_info.deviceMaxLba > SCSI_MAX_32_LBA || sectors > UINT16_MAX || (slot->lba + sectors) > SCSI_MAX_32_LBA))
+    {
+        use16 = true;
+    }
+    if (use16)
+    {
+        slot->cdbLength = CDB_LEN_16;
+        slot->cdb[OPERATION_CODE] = slot->write ? WRITE16 : READ16;
+        slot->cdb[2] = M_Byte7(slot->lba);
+        slot->cdb[3] = M_Byte6(slot->lba);
+        slot->cdb[4] = M_Byte5(slot->lba);
+        slot->cdb[5] = M_Byte4(slot->lba);
+        slot->cdb[6] = M_Byte3(slot->lba);
+        slot->cdb[7] = M_Byte2(slot->lba);
+        slot->cdb[8] = M_Byte1(slot->lba);
+        slot->cdb[9] = M_Byte0(slot->lba);
+        slot->cdb[10] = M_Byte3(sectors);
+        slot->cdb[11] = M_Byte2(sectors);
+        slot->cdb[12] = M_Byte1(sectors);
+        slot->cdb[13] = M_Byte0(sectors);
     }
     else
     {
-        return io_Write(device, lba, async, ptrData, dataSize);
+        slot->cdbLength = CDB_LEN_10;
+        slot->cdb[OPERATION_CODE] = slot->write ? WRITE10 : READ10;
+        slot->cdb[2] = M_Byte3(slot->lba);
+        slot->cdb[3] = M_Byte2(slot->lba);
+        slot->cdb[4] = M_Byte1(slot->lba);
+        slot->cdb[5] = M_Byte0(slot->lba);
+        slot->cdb[7] = M_Byte1(sectors);
+        slot->cdb[8] = M_Byte0(sectors);
+    }
+}
+
+static asyncIOSlot* get_Oldest_Async_IO_Slot(asyncIOQueue *queue, eAsyncIOState state)
+{
+    asyncIOSlot *oldest = NULL;
+    for (uint32_t slotIter = 0; slotIter < queue->queueDepth; ++slotIter)
+    {
+        if (queue->slots[slotIter].state == state && (!oldest || queue->slots[slotIter].sequence < oldest->sequence))
+        {
+            oldest = &queue->slots[slotIter];
+        }
+    }
+    return oldest;
+}
+
+//Sets the final status of a command that the OS finished, using the returned sense data the same way synchronous commands do.
+static void complete_Async_IO_Slot(tDevice *device, asyncIOQueue *queue, asyncIOSlot *slot, int osResult)
+{
+    int ret = osResult;
+    if (osResult == SUCCESS)
+    {
+        uint8_t senseKey = 0, asc = 0, ascq = 0, fru = 0;
+        get_Sense_Key_ASC_ASCQ_FRU(slot->senseData, SPC3_SENSE_LEN, &senseKey, &asc, &ascq, &fru);
+        ret = check_Sense_Key_ASC_ASCQ_And_FRU(device, senseKey, asc, ascq, fru);
+    }
+    if (ret == SUCCESS && slot->write)
+    {
+        update_Zone_Map_After_Write(device, slot->lba, slot->dataSize);
+    }
+    slot->result = ret;
+    slot->state = ASYNC_IO_STATE_COMPLETE;
+    queue->issuedCount--;
+    queue->completeCount++;
+}
+
+//Hands queued commands to the OS, oldest first, until the OS queue depth is reached.
+static void issue_Queued_Async_IO(tDevice *device, asyncIOQueue *queue)
+{
+    while (queue->queuedCount > 0 && queue->issuedCount < queue->osQueueDepth)
+    {
+        asyncIOSlot *slot = get_Oldest_Async_IO_Slot(queue, ASYNC_IO_STATE_QUEUED);
+        int osRet = SUCCESS;
+        if (!slot)
+        {
+            break;
+        }
+        build_Async_IO_CDB(device, slot);
+        memset(slot->senseData, 0, SPC3_SENSE_LEN);
+        slot->nvmeStatus = 0;
+        queue->queuedCount--;
+        queue->issuedCount++;
+        slot->state = ASYNC_IO_STATE_ISSUED;
+        osRet = os_Submit_Async_IO(device, queue, slot);
+        if (osRet != SUCCESS)
+        {
+            complete_Async_IO_Slot(device, queue, slot, osRet);
+        }
+    }
+}
+
+int submit_Async_IO(tDevice *device, bool write, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, uint32_t *tag)
+{
+    asyncIOQueue *queue = NULL;
+    asyncIOSlot *slot = NULL;
+    if (!device || !ptrData)
+    {
+        return BAD_PARAMETER;
+    }
+    complete_Lazy_Drive_Info_Data(device);
+    //make sure that the data size is at least logical sector in size
+    if (device->drive_info.deviceBlockSize == 0 || dataSize < device->drive_info.deviceBlockSize || dataSize % device->drive_info.deviceBlockSize)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!device->asyncIO)
+    {
+        int startRet = start_Async_IO(device, ASYNC_IO_DEFAULT_QUEUE_DEPTH);
+        if (startRet != SUCCESS)
+        {
+            return startRet;
+        }
+    }
+    queue = device->asyncIO;
+    for (uint32_t slotIter = 0; slotIter < queue->queueDepth; ++slotIter)
+    {
+        if (queue->slots[slotIter].state == ASYNC_IO_STATE_FREE)
+        {
+            slot = &queue->slots[slotIter];
+            break;
+        }
+    }
+    if (!slot)
+    {
+        return FAILURE;
+    }
+    slot->tag = queue->nextTag++;
+    if (queue->nextTag == 0)
+    {
+        queue->nextTag = 1;
+    }
+    slot->sequence = queue->nextSequence++;
+    slot->write = write;
+    slot->lba = lba;
+    slot->ptrData = ptrData;
+    slot->dataSize = dataSize;
+    slot->result = UNKNOWN;
+    slot->commandTimeNanoSeconds = 0;
+    slot->state = ASYNC_IO_STATE_QUEUED;
+    queue->queuedCount++;
+    if (tag)
+    {
+        *tag = slot->tag;
+    }
+    issue_Queued_Async_IO(device, queue);
+    return SUCCESS;
+}
+
+int wait_Async_IO(tDevice *device, asyncIOCompletion *completion, uint32_t timeoutMilliseconds)
+{
+    asyncIOQueue *queue = NULL;
+    asyncIOSlot *slot = NULL;
+    if (!device || !completion)
+    {
+        return BAD_PARAMETER;
+    }
+    queue = device->asyncIO;
+    if (!queue || (queue->queuedCount + queue->issuedCount + queue->completeCount) == 0)
+    {
+        return FAILURE;
+    }
+    if (queue->completeCount == 0)
+    {
+        if (queue->issuedCount > 0)
+        {
+            asyncIOSlot *reaped = NULL;
+            int reapRet = os_Reap_Async_IO(device, queue, timeoutMilliseconds, &reaped);
+            if (reapRet == SUCCESS && reaped)
+            {
+                complete_Async_IO_Slot(device, queue, reaped, reaped->result);
+            }
+            else if (reapRet != IN_PROGRESS)
+            {
+                return reapRet;
+            }
+            issue_Queued_Async_IO(device, queue);
+        }
+        else if (queue->osQueueDepth == 0 && queue->queuedCount > 0)
+        {
+            //No OS asynchronous interface. Issue the oldest queued command now.
+            slot = get_Oldest_Async_IO_Slot(queue, ASYNC_IO_STATE_QUEUED);
+            if (slot)
+            {
+                queue->queuedCount--;
+                slot->state = ASYNC_IO_STATE_ISSUED;
+                if (slot->write)
+                {
+                    slot->result = write_LBA(device, slot->lba, false, slot->ptrData, slot->dataSize);
+                }
+                else
+                {
+                    slot->result = read_LBA(device, slot->lba, false, slot->ptrData, slot->dataSize);
+                }
+                slot->commandTimeNanoSeconds = device->drive_info.lastCommandTimeNanoSeconds;
+                memcpy(slot->senseData, device->drive_info.lastCommandSenseData, SPC3_SENSE_LEN);
+                slot->nvmeStatus = device->drive_info.drive_type == NVME_DRIVE ? device->drive_info.lastNVMeResult.lastNVMeStatus : 0;
+                slot->state = ASYNC_IO_STATE_COMPLETE;
+                queue->completeCount++;
+            }
+        }
+    }
+    slot = get_Oldest_Async_IO_Slot(queue, ASYNC_IO_STATE_COMPLETE);
+    if (!slot)
+    {
+        return IN_PROGRESS;
+    }
+    memset(completion, 0, sizeof(asyncIOCompletion));
+    completion->tag = slot->tag;
+    completion->write = slot->write;
+    completion->lba = slot->lba;
+    completion->ptrData = slot->ptrData;
+    completion->dataSize = slot->dataSize;
+    completion->result = slot->result;
+    completion->commandTimeNanoSeconds = slot->commandTimeNanoSeconds;
+    memcpy(completion->senseData, slot->senseData, SPC3_SENSE_LEN);
+    completion->nvmeStatus = slot->nvmeStatus;
+    slot->state = ASYNC_IO_STATE_FREE;
+    queue->completeCount--;
+    return SUCCESS;
+}
+
+int poll_Async_IO(tDevice *device, asyncIOCompletion *completion)
+{
+    return wait_Async_IO(device, completion, 0);
+}
+
+int cancel_Async_IO(tDevice *device, uint32_t tag)
+{
+    if (!device || !device->asyncIO || tag == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t slotIter = 0; slotIter < device->asyncIO->queueDepth; ++slotIter)
+    {
+        asyncIOSlot *slot = &device->asyncIO->slots[slotIter];
+        if (slot->state != ASYNC_IO_STATE_FREE && slot->tag == tag)
+        {
+            if (slot->state == ASYNC_IO_STATE_QUEUED)
+            {
+                slot->state = ASYNC_IO_STATE_FREE;
+                device->asyncIO->queuedCount--;
+                return SUCCESS;
+            }
+            //already issued or finished. The completion will be reported.
+            return IN_PROGRESS;
+        }
+    }
+    return BAD_PARAMETER;
+}
+
+uint32_t get_Async_IO_Outstanding_Count(tDevice *device)
+{
+    if (!device || !device->asyncIO)
+    {
+        return 0;
     }
+    return device->asyncIO->queuedCount + device->asyncIO->issuedCount + device->asyncIO->completeCount;
+}
+
+int stop_Async_IO(tDevice *device)
+{
+    int ret = SUCCESS;
+    asyncIOQueue *queue = NULL;
+    uint32_t reapTimeoutMilliseconds = 0;
+    uint32_t failedReaps = 0;
+    if (!device)
+    {
+        return BAD_PARAMETER;
+    }
+    queue = device->asyncIO;
+    if (!queue)
+    {
+        return SUCCESS;
+    }
+    //wait longer than the OS layer's own command timeout so that the OS has a chance to abort and complete a stuck command first
+    reapTimeoutMilliseconds = (uint32_t)M_Min(UINT64_C(2000) * (device->drive_info.defaultTimeoutSeconds > 0 ? device->drive_info.defaultTimeoutSeconds : 15), ASYNC_IO_INFINITE_WAIT - 1);
+    //drop anything that has not been handed to the OS yet
+    for (uint32_t slotIter = 0; slotIter < queue->queueDepth; ++slotIter)
+    {
+        if (queue->slots[slotIter].state == ASYNC_IO_STATE_QUEUED)
+        {
+            queue->slots[slotIter].state = ASYNC_IO_STATE_FREE;
+        }
+    }
+    queue->queuedCount = 0;
+    //the OS still owns the buffers for anything issued, so those must finish before the queue can be released
+    while (queue->issuedCount > 0)
+    {
+        asyncIOSlot *reaped = NULL;
+        int reapRet = os_Reap_Async_IO(device, queue, reapTimeoutMilliseconds, &reaped);
+        if (reapRet == SUCCESS && reaped)
+        {
+            reaped->state = ASYNC_IO_STATE_FREE;
+            queue->issuedCount--;
+            failedReaps = 0;
+        }
+        else if (++failedReaps >= ASYNC_IO_STOP_REAP_ATTEMPTS)
+        {
+            ret = reapRet == IN_PROGRESS ? COMMAND_TIMEOUT : reapRet;
+            break;
+        }
+    }
+    if (queue->issuedCount > 0)
+    {
+        //The OS still owns these commands and will write their completions into the slots (and data into the caller's buffers).
+        //Freeing the queue here would let a late completion land in freed memory, so it is leaked on purpose.
+        if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+        {
+            printf("Unable to reap %" PRIu32 " asynchronous commands. Leaving the queue allocated.\n", queue->issuedCount);
+        }
+        device->asyncIO = NULL;
+        return ret;
+    }
+    os_Async_IO_Cleanup(device, queue);
+    safe_Free(queue->slots);
+    safe_Free(queue);
+    device->asyncIO = NULL;
+    return ret;
 }
 
 int ata_Read_Verify(tDevice *device, uint64_t lba, uint32_t range)
 {
     int ret = SUCCESS;//assume success
+    complete_Lazy_Drive_Info_Data(device);
     if (device->drive_info.ata_Options.fourtyEightBitAddressFeatureSetSupported)
     {
         //use 48bit commands by default
@@ -1748,6 +2789,7 @@ int ata_Read_Verify(tDevice *device, uint64_t lba, uint32_t range)
 int scsi_Verify(tDevice *device, uint64_t lba, uint32_t range)
 {
     int ret = SUCCESS;//assume success
+    complete_Lazy_Drive_Info_Data(device);
     //there's no real way to tell when scsi drive supports verify 10 vs verify 16 (which are all we will care about in here), so just based on transfer length and the maxLBA
     if (device->drive_info.deviceMaxLba <= SCSI_MAX_32_LBA && range <= UINT16_MAX && lba <= SCSI_MAX_32_LBA)
     {
@@ -1767,8 +2809,11 @@ int nvme_Verify_LBA(tDevice *device, uint64_t lba, uint32_t range)
 {
     //NVME doesn't have a verify command like ATA or SCSI, so we're going to substitute by doing a read with FUA set....should be the same minus doing a data transfer.
     int ret = SUCCESS;
-    uint32_t dataLength = device->drive_info.deviceBlockSize * range;
-    uint8_t *data = (uint8_t*)calloc_aligned(dataLength, sizeof(uint8_t), device->os_info.minimumAlignment);
+    uint32_t dataLength = 0;
+    uint8_t *data = NULL;
+    complete_Lazy_Drive_Info_Data(device);
+    dataLength = device->drive_info.deviceBlockSize * range;
+    data = (uint8_t*)calloc_aligned(dataLength, sizeof(uint8_t), device->os_info.minimumAlignment);
     if (data)
     {
         ret = nvme_Read(device, lba, range - 1, false, true, 0, data, dataLength);
@@ -1784,6 +2829,7 @@ int nvme_Verify_LBA(tDevice *device, uint64_t lba, uint32_t range)
 
 int verify_LBA(tDevice *device, uint64_t lba, uint32_t range)
 {
+    complete_Lazy_Drive_Info_Data(device);
     if (device->os_info.osReadWriteRecommended)
     {
         return os_Verify(device, lba, range);
@@ -1835,6 +2881,7 @@ int ata_Flush_Cache_Command(tDevice *device)
 
 int scsi_Synchronize_Cache_Command(tDevice *device)
 {
+    complete_Lazy_Drive_Info_Data(device);
     //synch/flush cache introduced in SCSI2. Not going to check for it though since some USB drives do support this command and report SCSI or no version. - TJE
     //there's no real way to tell when SCSI drive supports synchronize cache 10 vs synchronize cache 16 (which are all we will care about in here), so just based on the maxLBA
     if (device->drive_info.deviceMaxLba <= SCSI_MAX_32_LBA)
@@ -1888,6 +2935,374 @@ int flush_Cache(tDevice *device)
     return UNKNOWN;
 }
 
+static int deallocate_Range_Compare(const void *a, const void *b)
+{
+    const deallocateRange *rangeA = (const deallocateRange*)a;
+    const deallocateRange *rangeB = (const deallocateRange*)b;
+    if (rangeA->lba < rangeB->lba)
+    {
+        return -1;
+    }
+    else if (rangeA->lba > rangeB->lba)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+//Sorts the ranges by LBA, then merges any that overlap or are next to each other. Zero length ranges are dropped.
+//Returns the number of ranges left at the start of the list.
+static uint32_t coalesce_Deallocate_Ranges(deallocateRange *ranges, uint32_t numberOfRanges)
+{
+    uint32_t outputCount = 0;
+    qsort(ranges, numberOfRanges, sizeof(deallocateRange), deallocate_Range_Compare);
+    for (uint32_t rangeIter = 0; rangeIter < numberOfRanges; ++rangeIter)
+    {
+        if (ranges[rangeIter].length == 0)
+        {
+            continue;
+        }
+        if (outputCount > 0)
+        {
+            deallocateRange *current = &ranges[outputCount - 1];
+            //end is one past the last LBA in the range. Ranges are validated against the max LBA before this, so this cannot wrap.
+            uint64_t currentEnd = current->lba + current->length;
+            if (ranges[rangeIter].lba <= currentEnd)
+            {
+                uint64_t nextEnd = ranges[rangeIter].lba + ranges[rangeIter].length;
+                if (nextEnd > currentEnd)
+                {
+                    current->length = nextEnd - current->lba;
+                }
+                continue;
+            }
+        }
+        ranges[outputCount] = ranges[rangeIter];
+        ++outputCount;
+    }
+    return outputCount;
+}
+
+typedef enum _eDeallocateCommand
+{
+    DEALLOCATE_ATA_DSM,
+    DEALLOCATE_ATA_DSM_XL,
+    DEALLOCATE_NVME_DSM,
+    DEALLOCATE_SCSI_UNMAP,
+}eDeallocateCommand;
+
+static void set_Deallocate_Entry(eDeallocateCommand command, uint8_t *entry, uint64_t lba, uint64_t length)
+{
+    switch (command)
+    {
+    case DEALLOCATE_ATA_DSM:
+        //little endian qword. Bits 47:0 are the LBA, 63:48 are the range length
+        entry[0] = M_Byte0(lba);
+        entry[1] = M_Byte1(lba);
+        entry[2] = M_Byte2(lba);
+        entry[3] = M_Byte3(lba);
+        entry[4] = M_Byte4(lba);
+        entry[5] = M_Byte5(lba);
+        entry[6] = M_Byte0(length);
+        entry[7] = M_Byte1(length);
+        break;
+    case DEALLOCATE_ATA_DSM_XL:
+        //little endian. First qword is the LBA, second qword is the range length
+        entry[0] = M_Byte0(lba);
+        entry[1] = M_Byte1(lba);
+        entry[2] = M_Byte2(lba);
+        entry[3] = M_Byte3(lba);
+        entry[4] = M_Byte4(lba);
+        entry[5] = M_Byte5(lba);
+        entry[8] = M_Byte0(length);
+        entry[9] = M_Byte1(length);
+        entry[10] = M_Byte2(length);
+        entry[11] = M_Byte3(length);
+        entry[12] = M_Byte4(length);
+        entry[13] = M_Byte5(length);
+        entry[14] = M_Byte6(length);
+        entry[15] = M_Byte7(length);
+        break;
+    case DEALLOCATE_NVME_DSM:
+        //little endian. Bytes 3:0 are context attributes (left zero), 7:4 are the length, 15:8 the starting LBA
+        entry[4] = M_Byte0(length);
+        entry[5] = M_Byte1(length);
+        entry[6] = M_Byte2(length);
+        entry[7] = M_Byte3(length);
+        entry[8] = M_Byte0(lba);
+        entry[9] = M_Byte1(lba);
+        entry[10] = M_Byte2(lba);
+        entry[11] = M_Byte3(lba);
+        entry[12] = M_Byte4(lba);
+        entry[13] = M_Byte5(lba);
+        entry[14] = M_Byte6(lba);
+        entry[15] = M_Byte7(lba);
+        break;
+    case DEALLOCATE_SCSI_UNMAP:
+        //big endian. LBA, number of logical blocks, then 4 reserved bytes
+        entry[0] = M_Byte7(lba);
+        entry[1] = M_Byte6(lba);
+        entry[2] = M_Byte5(lba);
+        entry[3] = M_Byte4(lba);
+        entry[4] = M_Byte3(lba);
+        entry[5] = M_Byte2(lba);
+        entry[6] = M_Byte1(lba);
+        entry[7] = M_Byte0(lba);
+        entry[8] = M_Byte3(length);
+        entry[9] = M_Byte2(length);
+        entry[10] = M_Byte1(length);
+        entry[11] = M_Byte0(length);
+        break;
+    }
+}
+
+static int send_Deallocate_Command(tDevice *device, eDeallocateCommand command, uint8_t *buffer, uint32_t bufferSize, uint32_t numberOfEntries, uint32_t entrySize)
+{
+    int ret = NOT_SUPPORTED;
+    switch (command)
+    {
+    case DEALLOCATE_ATA_DSM:
+    case DEALLOCATE_ATA_DSM_XL:
+        //only transfer as many 512B blocks as have entries in them
+        ret = ata_Data_Set_Management(device, true, buffer, ((numberOfEntries * entrySize + LEGACY_DRIVE_SEC_SIZE - 1) / LEGACY_DRIVE_SEC_SIZE) * LEGACY_DRIVE_SEC_SIZE, command == DEALLOCATE_ATA_DSM_XL);
+        break;
+    case DEALLOCATE_NVME_DSM:
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+        //number of ranges is a zero based value
+        ret = nvme_Dataset_Management(device, (uint8_t)(numberOfEntries - 1), true, false, false, buffer, bufferSize);
+#endif
+        break;
+    case DEALLOCATE_SCSI_UNMAP:
+    {
+        uint16_t descriptorLength = (uint16_t)(numberOfEntries * entrySize);
+        buffer[0] = M_Byte1(descriptorLength + 6);
+        buffer[1] = M_Byte0(descriptorLength + 6);
+        buffer[2] = M_Byte1(descriptorLength);
+        buffer[3] = M_Byte0(descriptorLength);
+        ret = scsi_Unmap(device, false, 0, descriptorLength + 8, buffer);
+    }
+        break;
+    }
+    return ret;
+}
+
+int deallocate_LBA_Ranges(tDevice *device, deallocateRange *ranges, uint32_t numberOfRanges)
+{
+    int ret = SUCCESS;
+    eDeallocateCommand command = DEALLOCATE_SCSI_UNMAP;
+    uint32_t entrySize = 16;
+    uint32_t headerSize = 0;
+    uint32_t maxEntriesPerCommand = 0;
+    uint64_t maxLengthPerEntry = UINT32_MAX;
+    uint64_t maxLBAsPerCommand = UINT64_MAX;
+    uint32_t bufferSize = 0;
+    uint8_t *buffer = NULL;
+    if (!device || (!ranges && numberOfRanges > 0))
+    {
+        return BAD_PARAMETER;
+    }
+    complete_Lazy_Drive_Info_Data(device);
+    for (uint32_t rangeIter = 0; rangeIter < numberOfRanges; ++rangeIter)
+    {
+        if (ranges[rangeIter].length > 0 && (ranges[rangeIter].lba > device->drive_info.deviceMaxLba || ranges[rangeIter].length > device->drive_info.deviceMaxLba - ranges[rangeIter].lba + 1))
+        {
+            return BAD_PARAMETER;
+        }
+    }
+    numberOfRanges = coalesce_Deallocate_Ranges(ranges, numberOfRanges);
+    if (numberOfRanges == 0)
+    {
+        return SUCCESS;
+    }
+    switch (device->drive_info.drive_type)
+    {
+    case ATA_DRIVE:
+    {
+        uint16_t maxBlocks = device->drive_info.IdentifyData.ata.Word105 > 0 ? device->drive_info.IdentifyData.ata.Word105 : 1;//not reported on some older drives. 1 block is always allowed
+        if (!(device->drive_info.IdentifyData.ata.Word169 & BIT0))
+        {
+            return NOT_SUPPORTED;
+        }
+        if (device->drive_info.softSATFlags.dataSetManagementXLSupported)
+        {
+            command = DEALLOCATE_ATA_DSM_XL;
+            entrySize = 16;
+            maxLengthPerEntry = UINT64_MAX;
+        }
+        else
+        {
+            command = DEALLOCATE_ATA_DSM;
+            entrySize = 8;
+            maxLengthPerEntry = UINT16_MAX;
+        }
+        bufferSize = maxBlocks * LEGACY_DRIVE_SEC_SIZE;
+        maxEntriesPerCommand = bufferSize / entrySize;
+    }
+        break;
+    case NVME_DRIVE:
+#if !defined (DISABLE_NVME_PASSTHROUGH)
+        if (!(device->drive_info.IdentifyData.nvme.ctrl.oncs & BIT2))//dataset management supported
+        {
+            return NOT_SUPPORTED;
+        }
+        command = DEALLOCATE_NVME_DSM;
+        entrySize = 16;
+        maxLengthPerEntry = UINT32_MAX;
+        maxEntriesPerCommand = 256;
+        bufferSize = 4096;
+        break;
+#endif
+    default:
+    {
+        //UNMAP parameter list length is 16 bits, so this is the most that fit in one command. Lower this to the device's limits from the block limits VPD page when it is available.
+        uint8_t *blockLimits = lease_Device_Buffer(device, VPD_BLOCK_LIMITS_LEN);
+        command = DEALLOCATE_SCSI_UNMAP;
+        entrySize = 16;
+        headerSize = 8;
+        maxLengthPerEntry = UINT32_MAX;
+        maxEntriesPerCommand = (UINT16_MAX - headerSize) / entrySize;
+        if (blockLimits && SUCCESS == scsi_Inquiry(device, blockLimits, VPD_BLOCK_LIMITS_LEN, BLOCK_LIMITS, true, false) && blockLimits[1] == BLOCK_LIMITS)
+        {
+            uint32_t maxUnmapLBACount = M_BytesTo4ByteValue(blockLimits[20], blockLimits[21], blockLimits[22], blockLimits[23]);
+            uint32_t maxUnmapDescriptors = M_BytesTo4ByteValue(blockLimits[24], blockLimits[25], blockLimits[26], blockLimits[27]);
+            if (maxUnmapLBACount == 0 || maxUnmapDescriptors == 0)
+            {
+                safe_Return_Device_Buffer(device, blockLimits);
+                return NOT_SUPPORTED;
+            }
+            if (maxUnmapLBACount != UINT32_MAX)
+            {
+                maxLBAsPerCommand = maxUnmapLBACount;
+                maxLengthPerEntry = maxUnmapLBACount;
+            }
+            if (maxUnmapDescriptors != UINT32_MAX)
+            {
+                maxEntriesPerCommand = M_Min(maxEntriesPerCommand, maxUnmapDescriptors);
+            }
+        }
+        safe_Return_Device_Buffer(device, blockLimits);
+        bufferSize = headerSize + maxEntriesPerCommand * entrySize;
+    }
+        break;
+    }
+    buffer = lease_Device_Buffer(device, bufferSize);
+    if (!buffer)
+    {
+        return MEMORY_FAILURE;
+    }
+    uint32_t entryCount = 0;
+    uint64_t lbasInCommand = 0;
+    for (uint32_t rangeIter = 0; ret == SUCCESS && rangeIter < numberOfRanges; ++rangeIter)
+    {
+        uint64_t lba = ranges[rangeIter].lba;
+        uint64_t remaining = ranges[rangeIter].length;
+        while (remaining > 0)
+        {
+            uint64_t entryLength = M_Min(remaining, maxLengthPerEntry);
+            entryLength = M_Min(entryLength, maxLBAsPerCommand - lbasInCommand);
+            set_Deallocate_Entry(command, &buffer[headerSize + entryCount * entrySize], lba, entryLength);
+            ++entryCount;
+            lbasInCommand += entryLength;
+            lba += entryLength;
+            remaining -= entryLength;
+            if (entryCount == maxEntriesPerCommand || lbasInCommand == maxLBAsPerCommand)
+            {
+                ret = send_Deallocate_Command(device, command, buffer, bufferSize, entryCount, entrySize);
+                if (ret != SUCCESS)
+                {
+                    break;
+                }
+                memset(buffer, 0, bufferSize);
+                entryCount = 0;
+                lbasInCommand = 0;
+            }
+        }
+    }
+    if (ret == SUCCESS && entryCount > 0)
+    {
+        ret = send_Deallocate_Command(device, command, buffer, bufferSize, entryCount, entrySize);
+    }
+    safe_Return_Device_Buffer(device, buffer);
+    return ret;
+}
+
+//Applies a successful zone action to one zone in the zone map
+static void apply_Zone_Action_To_Zone_Map(deviceZoneMap *map, uint32_t zoneIndex, eZMAction action)
+{
+    switch (action)
+    {
+    case ZM_ACTION_CLOSE_ZONE:
+        map->zoneCondition[zoneIndex] = map->writePointer[zoneIndex] == map->zoneStart[zoneIndex] ? ZONE_CONDITION_EMPTY : ZONE_CONDITION_CLOSED;
+        break;
+    case ZM_ACTION_FINISH_ZONE:
+        map->writePointer[zoneIndex] = map->zoneStart[zoneIndex] + map->zoneLength[zoneIndex];
+        map->zoneCondition[zoneIndex] = ZONE_CONDITION_FULL;
+        break;
+    case ZM_ACTION_OPEN_ZONE:
+        map->zoneCondition[zoneIndex] = ZONE_CONDITION_EXPLICITLY_OPENED;
+        break;
+    case ZM_ACTION_RESET_WRITE_POINTERS:
+        map->writePointer[zoneIndex] = map->zoneStart[zoneIndex];
+        map->zoneCondition[zoneIndex] = ZONE_CONDITION_EMPTY;
+        map->zoneFlags[zoneIndex] &= (uint8_t)~(ZONE_FLAG_RESET | ZONE_FLAG_NON_SEQ);
+        break;
+    default:
+        break;
+    }
+}
+
+//Returns true when a zone action changes a zone in the given condition, following the ZBC/ZAC zone condition state machine.
+//The "all" forms skip zones that the single zone form would still change: OPEN ALL only opens closed zones and FINISH ALL does not finish empty zones.
+static bool zone_Action_Affects_Condition(eZMAction action, bool all, uint8_t zoneCondition)
+{
+    switch (zoneCondition)
+    {
+    case ZONE_CONDITION_EMPTY:
+        return !all && (action == ZM_ACTION_OPEN_ZONE || action == ZM_ACTION_FINISH_ZONE);
+    case ZONE_CONDITION_IMPLICITLY_OPENED:
+        return action != ZM_ACTION_OPEN_ZONE || !all;
+    case ZONE_CONDITION_EXPLICITLY_OPENED:
+        return action != ZM_ACTION_OPEN_ZONE;
+    case ZONE_CONDITION_CLOSED:
+        return action != ZM_ACTION_CLOSE_ZONE;
+    case ZONE_CONDITION_FULL:
+        return action == ZM_ACTION_RESET_WRITE_POINTERS;
+    default:
+        return false;
+    }
+}
+
+//Updates the zone map for a zone action the device completed
+static void update_Zone_Map_After_Zone_Action(tDevice *device, eZMAction action, bool all, uint64_t zoneID)
+{
+    deviceZoneMap *map = device->zoneMap;
+    uint32_t zoneIndex = 0;
+    uint32_t lastZoneIndex = 0;
+    if (!map)
+    {
+        return;
+    }
+    if (all)
+    {
+        lastZoneIndex = map->zoneCount - 1;
+    }
+    else if (SUCCESS == get_Zone_Map_Index(device, zoneID, &zoneIndex))
+    {
+        lastZoneIndex = zoneIndex;
+    }
+    else
+    {
+        return;
+    }
+    for (; zoneIndex <= lastZoneIndex && zoneIndex < map->zoneCount; ++zoneIndex)
+    {
+        if (map->zoneType[zoneIndex] != ZONE_TYPE_CONVENTIONAL && zone_Action_Affects_Condition(action, all, map->zoneCondition[zoneIndex]))
+        {
+            apply_Zone_Action_To_Zone_Map(map, zoneIndex, action);
+        }
+    }
+}
+
 int close_Zone(tDevice *device, bool closeAll, uint64_t zoneID)
 {
     int ret = UNKNOWN;
@@ -1903,6 +3318,10 @@ int close_Zone(tDevice *device, bool closeAll, uint64_t zoneID)
         ret = NOT_SUPPORTED;
         break;
     }
+    if (ret == SUCCESS)
+    {
+        update_Zone_Map_After_Zone_Action(device, ZM_ACTION_CLOSE_ZONE, closeAll, zoneID);
+    }
     return ret;
 }
 
@@ -1921,6 +3340,10 @@ int finish_Zone(tDevice *device, bool finishAll, uint64_t zoneID)
         ret = NOT_SUPPORTED;
         break;
     }
+    if (ret == SUCCESS)
+    {
+        update_Zone_Map_After_Zone_Action(device, ZM_ACTION_FINISH_ZONE, finishAll, zoneID);
+    }
     return ret;
 }
 
@@ -1939,6 +3362,10 @@ int open_Zone(tDevice *device, bool openAll, uint64_t zoneID)
         ret = NOT_SUPPORTED;
         break;
     }
+    if (ret == SUCCESS)
+    {
+        update_Zone_Map_After_Zone_Action(device, ZM_ACTION_OPEN_ZONE, openAll, zoneID);
+    }
     return ret;
 }
 
@@ -1957,6 +3384,10 @@ int reset_Write_Pointer(tDevice *device, bool resetAll, uint64_t zoneID)
         ret = NOT_SUPPORTED;
         break;
     }
+    if (ret == SUCCESS)
+    {
+        update_Zone_Map_After_Zone_Action(device, ZM_ACTION_RESET_WRITE_POINTERS, resetAll, zoneID);
+    }
     return ret;
 }
 
@@ -1980,4 +3411,281 @@ int report_Zones(tDevice *device, eZoneReportingOptions reportingOptions, bool p
         break;
     }
     return ret;
+}
+
+//Zone report fields are big endian from SCSI devices and little endian from ATA devices (report_Zones returns the raw ATA data)
+static uint64_t get_Zone_Report_Field_64(const uint8_t *field, bool bigEndian)
+{
+    if (bigEndian)
+    {
+        return M_BytesTo8ByteValue(field[0], field[1], field[2], field[3], field[4], field[5], field[6], field[7]);
+    }
+    return M_BytesTo8ByteValue(field[7], field[6], field[5], field[4], field[3], field[2], field[1], field[0]);
+}
+
+static uint32_t get_Zone_Report_List_Length(const uint8_t *header, bool bigEndian)
+{
+    if (bigEndian)
+    {
+        return M_BytesTo4ByteValue(header[0], header[1], header[2], header[3]);
+    }
+    return M_BytesTo4ByteValue(header[3], header[2], header[1], header[0]);
+}
+
+static int grow_Zone_Map(deviceZoneMap *map, uint32_t zoneCapacity)
+{
+    uint64_t *zoneStart = NULL, *zoneLength = NULL, *writePointer = NULL;
+    uint8_t *zoneType = NULL, *zoneCondition = NULL, *zoneFlags = NULL;
+    if (zoneCapacity <= map->zoneCapacity)
+    {
+        return SUCCESS;
+    }
+    //each array is stored as soon as it is reallocated so nothing leaks if a later allocation fails
+    zoneStart = (uint64_t*)realloc(map->zoneStart, zoneCapacity * sizeof(uint64_t));
+    if (!zoneStart)
+    {
+        return MEMORY_FAILURE;
+    }
+    map->zoneStart = zoneStart;
+    zoneLength = (uint64_t*)realloc(map->zoneLength, zoneCapacity * sizeof(uint64_t));
+    if (!zoneLength)
+    {
+        return MEMORY_FAILURE;
+    }
+    map->zoneLength = zoneLength;
+    writePointer = (uint64_t*)realloc(map->writePointer, zoneCapacity * sizeof(uint64_t));
+    if (!writePointer)
+    {
+        return MEMORY_FAILURE;
+    }
+    map->writePointer = writePointer;
+    zoneType = (uint8_t*)realloc(map->zoneType, zoneCapacity * sizeof(uint8_t));
+    if (!zoneType)
+    {
+        return MEMORY_FAILURE;
+    }
+    map->zoneType = zoneType;
+    zoneCondition = (uint8_t*)realloc(map->zoneCondition, zoneCapacity * sizeof(uint8_t));
+    if (!zoneCondition)
+    {
+        return MEMORY_FAILURE;
+    }
+    map->zoneCondition = zoneCondition;
+    zoneFlags = (uint8_t*)realloc(map->zoneFlags, zoneCapacity * sizeof(uint8_t));
+    if (!zoneFlags)
+    {
+        return MEMORY_FAILURE;
+    }
+    map->zoneFlags = zoneFlags;
+    map->zoneCapacity = zoneCapacity;
+    return SUCCESS;
+}
+
+//Sends one report zones command for the zone map. The transfer is sized for maxDescriptors (0 = as many as fit in ZONE_MAP_REPORT_BUFFER_SIZE).
+//descriptorCount is set to the number of descriptors returned and zoneListCount to the number of zones the device reports in the zone list length.
+static int read_Zone_Map_Report(tDevice *device, eZoneReportingOptions reportingOptions, bool partial, uint64_t zoneLocator, uint32_t maxDescriptors, uint8_t *buffer, uint32_t *descriptorCount, uint32_t *zoneListCount, uint64_t *maxLBA)
+{
+    int ret = SUCCESS;
+    bool bigEndian = device->drive_info.drive_type != ATA_DRIVE;
+    uint32_t reportSize = ZONE_MAP_REPORT_BUFFER_SIZE;
+    if (maxDescriptors > 0 && maxDescriptors < (ZONE_MAP_REPORT_BUFFER_SIZE / ZONE_DESCRIPTOR_LENGTH) - 1)
+    {
+        //ATA transfers whole 512 byte pages
+        reportSize = (((maxDescriptors + 1) * ZONE_DESCRIPTOR_LENGTH) + (LEGACY_DRIVE_SEC_SIZE - 1)) / LEGACY_DRIVE_SEC_SIZE * LEGACY_DRIVE_SEC_SIZE;
+    }
+    memset(buffer, 0, reportSize);
+    ret = report_Zones(device, reportingOptions, partial, zoneLocator, buffer, reportSize);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    *zoneListCount = get_Zone_Report_List_Length(buffer, bigEndian) / ZONE_DESCRIPTOR_LENGTH;
+    *descriptorCount = M_Min(*zoneListCount, (reportSize / ZONE_DESCRIPTOR_LENGTH) - 1);
+    *maxLBA = get_Zone_Report_Field_64(&buffer[8], bigEndian);
+    return ret;
+}
+
+int build_Zone_Map(tDevice *device)
+{
+    int ret = SUCCESS;
+    bool bigEndian = false;
+    uint64_t zoneLocator = 0;
+    deviceZoneMap *map = NULL;
+    uint8_t *buffer = NULL;
+    if (!device)
+    {
+        return BAD_PARAMETER;
+    }
+    //this completes lazy discovery first since the zoned type is not known until then
+    if (get_Drive_Info_Zoned_Type(device) == ZONED_TYPE_NOT_ZONED)
+    {
+        return NOT_SUPPORTED;
+    }
+    free_Zone_Map(device);
+    bigEndian = device->drive_info.drive_type != ATA_DRIVE;
+    map = (deviceZoneMap*)calloc(1, sizeof(deviceZoneMap));
+    buffer = lease_Device_Buffer(device, ZONE_MAP_REPORT_BUFFER_SIZE);
+    if (!map || !buffer)
+    {
+        safe_Free(map);
+        safe_Return_Device_Buffer(device, buffer);
+        return MEMORY_FAILURE;
+    }
+    while (ret == SUCCESS)
+    {
+        uint32_t descriptorCount = 0, zoneListCount = 0;
+        //The partial bit is not set so that the zone list length covers every zone from the locator on. That sizes the map from the first report.
+        ret = read_Zone_Map_Report(device, ZONE_REPORT_LIST_ALL_ZONES, false, zoneLocator, 0, buffer, &descriptorCount, &zoneListCount, &map->maxLBA);
+        if (ret != SUCCESS || descriptorCount == 0)
+        {
+            break;
+        }
+        ret = grow_Zone_Map(map, map->zoneCount + zoneListCount);
+        for (uint32_t descriptorIter = 0; ret == SUCCESS && descriptorIter < descriptorCount; ++descriptorIter)
+        {
+            const uint8_t *descriptor = &buffer[(descriptorIter + 1) * ZONE_DESCRIPTOR_LENGTH];
+            map->zoneType[map->zoneCount] = M_Nibble0(descriptor[0]);
+            map->zoneCondition[map->zoneCount] = M_Nibble1(descriptor[1]);
+            map->zoneFlags[map->zoneCount] = descriptor[1] & (ZONE_FLAG_RESET | ZONE_FLAG_NON_SEQ);
+            map->zoneLength[map->zoneCount] = get_Zone_Report_Field_64(&descriptor[8], bigEndian);
+            map->zoneStart[map->zoneCount] = get_Zone_Report_Field_64(&descriptor[16], bigEndian);
+            map->writePointer[map->zoneCount] = get_Zone_Report_Field_64(&descriptor[24], bigEndian);
+            ++map->zoneCount;
+        }
+        if (ret != SUCCESS || descriptorCount == zoneListCount || map->zoneLength[map->zoneCount - 1] == 0)
+        {
+            //all remaining zones were in this report
+            break;
+        }
+        zoneLocator = map->zoneStart[map->zoneCount - 1] + map->zoneLength[map->zoneCount - 1];
+        if (zoneLocator > map->maxLBA)
+        {
+            break;
+        }
+    }
+    safe_Return_Device_Buffer(device, buffer);
+    device->zoneMap = map;
+    if (ret != SUCCESS || map->zoneCount == 0)
+    {
+        free_Zone_Map(device);
+        if (ret == SUCCESS)
+        {
+            ret = NOT_SUPPORTED;
+        }
+    }
+    return ret;
+}
+
+int refresh_Zone_Map(tDevice *device, eZoneReportingOptions reportingOptions, uint64_t startLBA, uint32_t maxZones)
+{
+    int ret = SUCCESS;
+    bool bigEndian = false;
+    uint32_t zonesReported = 0;
+    uint64_t zoneLocator = startLBA;
+    uint8_t *buffer = NULL;
+    deviceZoneMap *map = NULL;
+    if (!device)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!device->zoneMap)
+    {
+        return build_Zone_Map(device);
+    }
+    map = device->zoneMap;
+    bigEndian = device->drive_info.drive_type != ATA_DRIVE;
+    buffer = lease_Device_Buffer(device, ZONE_MAP_REPORT_BUFFER_SIZE);
+    if (!buffer)
+    {
+        return MEMORY_FAILURE;
+    }
+    while (ret == SUCCESS && (maxZones == 0 || zonesReported < maxZones))
+    {
+        uint32_t descriptorCount = 0, zoneListCount = 0;
+        uint64_t lastZoneEnd = 0;
+        ret = read_Zone_Map_Report(device, reportingOptions, true, zoneLocator, maxZones == 0 ? 0 : maxZones - zonesReported, buffer, &descriptorCount, &zoneListCount, &map->maxLBA);
+        if (ret != SUCCESS || descriptorCount == 0)
+        {
+            break;
+        }
+        if (maxZones > 0)
+        {
+            descriptorCount = M_Min(descriptorCount, maxZones - zonesReported);
+        }
+        for (uint32_t descriptorIter = 0; descriptorIter < descriptorCount; ++descriptorIter)
+        {
+            const uint8_t *descriptor = &buffer[(descriptorIter + 1) * ZONE_DESCRIPTOR_LENGTH];
+            uint64_t zoneStart = get_Zone_Report_Field_64(&descriptor[16], bigEndian);
+            uint32_t zoneIndex = 0;
+            if (SUCCESS != get_Zone_Map_Index(device, zoneStart, &zoneIndex) || map->zoneStart[zoneIndex] != zoneStart)
+            {
+                //The zone layout no longer matches the map (ex: realms changed), so the whole list has to be read again
+                safe_Return_Device_Buffer(device, buffer);
+                return build_Zone_Map(device);
+            }
+            map->zoneCondition[zoneIndex] = M_Nibble1(descriptor[1]);
+            map->zoneFlags[zoneIndex] = descriptor[1] & (ZONE_FLAG_RESET | ZONE_FLAG_NON_SEQ);
+            map->writePointer[zoneIndex] = get_Zone_Report_Field_64(&descriptor[24], bigEndian);
+            lastZoneEnd = zoneStart + map->zoneLength[zoneIndex];
+        }
+        zonesReported += descriptorCount;
+        //With the partial bit set, the zone list length only covers what was returned, so only a full report means more zones may match
+        if (descriptorCount < (ZONE_MAP_REPORT_BUFFER_SIZE / ZONE_DESCRIPTOR_LENGTH) - 1 || lastZoneEnd <= zoneLocator || lastZoneEnd > map->maxLBA)
+        {
+            break;
+        }
+        zoneLocator = lastZoneEnd;
+    }
+    safe_Return_Device_Buffer(device, buffer);
+    return ret;
+}
+
+int get_Zone_Map_Index(tDevice *device, uint64_t lba, uint32_t *zoneIndex)
+{
+    deviceZoneMap *map = NULL;
+    uint32_t low = 0, high = 0;
+    if (!device || !zoneIndex)
+    {
+        return BAD_PARAMETER;
+    }
+    map = device->zoneMap;
+    if (!map || map->zoneCount == 0)
+    {
+        return NOT_SUPPORTED;
+    }
+    //find the first zone starting after the LBA. The zone before it is the one that can hold the LBA.
+    high = map->zoneCount;
+    while (low < high)
+    {
+        uint32_t middle = low + ((high - low) / 2);
+        if (map->zoneStart[middle] <= lba)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low == 0 || lba - map->zoneStart[low - 1] >= map->zoneLength[low - 1])
+    {
+        return BAD_PARAMETER;
+    }
+    *zoneIndex = low - 1;
+    return SUCCESS;
+}
+
+void free_Zone_Map(tDevice *device)
+{
+    if (!device || !device->zoneMap)
+    {
+        return;
+    }
+    safe_Free(device->zoneMap->zoneStart);
+    safe_Free(device->zoneMap->zoneLength);
+    safe_Free(device->zoneMap->writePointer);
+    safe_Free(device->zoneMap->zoneType);
+    safe_Free(device->zoneMap->zoneCondition);
+    safe_Free(device->zoneMap->zoneFlags);
+    safe_Free(device->zoneMap);
 }
\ No newline at end of file
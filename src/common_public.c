@@ -10,8 +10,14 @@
 // ******************************************************************************************
 // 
 #include "common_public.h"
+#include <stddef.h>
 
 #include "platform_helper.h"
+#if defined (_WIN32) && !defined (UEFI_C_SOURCE)
+#include <windows.h>
+#elif !defined (UEFI_C_SOURCE)
+#include <pthread.h>
+#endif
 
 #if defined (ENABLE_CSMI)
 #include "csmi_helper_func.h"
@@ -1904,65 +1910,173 @@ uint64_t align_LBA(tDevice *device, uint64_t LBA)
 }
 
 
+//Keeps the non-CSMI handle when a drive is seen through both CSMI and the native OS driver (Windows only, like before).
+static eDuplicateDeviceKeep remove_Duplicate_Devices_Flag_Policy(tDevice *first, tDevice *second, void *policyData)
+{
+    eDuplicateDeviceKeep keep = DUPLICATE_KEEP_BOTH;
+#if defined (_WIN32)
+    removeDuplicateDriveType *rmvDevFlag = (removeDuplicateDriveType*)policyData;
+    /* We are supporting csmi only - for now */
+    if (rmvDevFlag && rmvDevFlag->csmi != 0)
+    {
+        if (is_CSMI_Device(second))
+        {
+            keep = DUPLICATE_KEEP_FIRST;
+        }
+        else if (is_CSMI_Device(first))
+        {
+            keep = DUPLICATE_KEEP_SECOND;
+        }
+    }
+#endif
+    return keep;
+}
+
 int remove_Duplicate_Devices(tDevice *deviceList, volatile uint32_t * numberOfDevices, removeDuplicateDriveType rmvDevFlag)
 {
-    volatile uint32_t i, j;
-    bool sameSlNo = false;
-    int ret = UNKNOWN;
+    return remove_Duplicate_Devices_By_Policy(deviceList, numberOfDevices, remove_Duplicate_Devices_Flag_Policy, &rmvDevFlag);
+}
 
+eDuplicateDeviceKeep prefer_NVMe_Over_SCSI_Duplicate_Policy(tDevice *first, tDevice *second, void *policyData)
+{
+    if (first->drive_info.drive_type == NVME_DRIVE && second->drive_info.drive_type == SCSI_DRIVE)
+    {
+        return DUPLICATE_KEEP_FIRST;
+    }
+    if (first->drive_info.drive_type == SCSI_DRIVE && second->drive_info.drive_type == NVME_DRIVE)
+    {
+        return DUPLICATE_KEEP_SECOND;
+    }
+    return DUPLICATE_KEEP_BOTH;
+}
 
-    /*
-    Go through all the devices in the list. 
-    */
-    for (i = 0; i < *numberOfDevices - 1; i++)
+static uint32_t hash_Device_Serial_Number(const char *serialNumber)
+{
+    //FNV-1a
+    uint32_t hash = UINT32_C(2166136261);
+    while (*serialNumber)
     {
-        /*
-        Go compare it to all the rest of the drives i + 1. 
-        */
-        for (j = i + 1; j < *numberOfDevices; j++)
+        hash ^= (uint8_t)*serialNumber;
+        hash *= UINT32_C(16777619);
+        ++serialNumber;
+    }
+    return hash;
+}
 
-        {
-#ifdef _DEBUG
-            printf("%s --> For drive i : %d and j : %d \n", __FUNCTION__, i, j);
-#endif
-            ret = SUCCESS;
-            sameSlNo = false;
+//Same serial number, and the same WWN when both devices reported one. Some paths (USB, some RAID drivers) do not report a WWN.
+static bool is_Same_Device_Identity(tDevice *first, tDevice *second)
+{
+    if (strcmp(first->drive_info.serialNumber, second->drive_info.serialNumber) != 0)
+    {
+        return false;
+    }
+    if (first->drive_info.worldWideName != 0 && second->drive_info.worldWideName != 0 && first->drive_info.worldWideName != second->drive_info.worldWideName)
+    {
+        return false;
+    }
+    return true;
+}
 
-            if ( ((deviceList + i) && strlen((deviceList + i)->drive_info.serialNumber) > 0) &&
-                 ((deviceList + j) && strlen((deviceList + j)->drive_info.serialNumber) > 0) )
-            {
-                 sameSlNo = (strncmp((deviceList + i)->drive_info.serialNumber,
-                     (deviceList + j)->drive_info.serialNumber,
-                     strlen((deviceList + i)->drive_info.serialNumber)) == 0);
-            }
+int remove_Duplicate_Devices_By_Policy(tDevice *deviceList, volatile uint32_t * numberOfDevices, duplicateDevicePolicy policy, void *policyData)
+{
+    int ret = SUCCESS;
+    uint32_t deviceCount = 0;
+    uint32_t slotCount = 1;
+    uint32_t *slots = NULL;//index into deviceList + 1, 0 = empty slot
+    bool *removeDevice = NULL;
+    uint32_t keptCount = 0;
+
+    if (!deviceList || !numberOfDevices || !policy)
+    {
+        return BAD_PARAMETER;
+    }
+    deviceCount = *numberOfDevices;
+    if (deviceCount < 2)
+    {
+        return SUCCESS;
+    }
+    //power of 2 with at least twice as many slots as devices
+    while (slotCount < deviceCount * 2)
+    {
+        slotCount <<= 1;
+    }
+    slots = (uint32_t*)calloc(slotCount, sizeof(uint32_t));
+    removeDevice = (bool*)calloc(deviceCount, sizeof(bool));
+    if (!slots || !removeDevice)
+    {
+        safe_Free(slots);
+        safe_Free(removeDevice);
+        return MEMORY_FAILURE;
+    }
 
-            if (sameSlNo)
+    /*
+    One pass over the list. Each device with a serial number is looked up in the hash of devices kept so far.
+    When a match is found the policy decides which one stays.
+    */
+    for (uint32_t deviceIter = 0; deviceIter < deviceCount; ++deviceIter)
+    {
+        tDevice *device = deviceList + deviceIter;
+        uint32_t slot = 0;
+        if (strlen(device->drive_info.serialNumber) == 0)
+        {
+            continue;
+        }
+        slot = hash_Device_Serial_Number(device->drive_info.serialNumber) & (slotCount - 1);
+        while (slots[slot] != 0)
+        {
+            tDevice *kept = deviceList + (slots[slot] - 1);
+            if (is_Same_Device_Identity(kept, device))
             {
+                eDuplicateDeviceKeep keep = policy(kept, device, policyData);
 #ifdef _DEBUG
-                printf("We have same serial no \n");
+                printf("%s --> drive %" PRIu32 " has the same serial number as drive %" PRIu32 "\n", __FUNCTION__, deviceIter, slots[slot] - 1);
 #endif
-#if defined (_WIN32)
-                /* We are supporting csmi only - for now */
-                if (rmvDevFlag.csmi != 0)
+                if (keep == DUPLICATE_KEEP_FIRST)
                 {
-                    if (is_CSMI_Device(deviceList + i))
-                    {
-                        ret |= remove_Device(deviceList, i, numberOfDevices);
-                        i--;
-                        j--;
-                    }
-
-                    if (is_CSMI_Device(deviceList + j))
-                    {
-                        ret |= remove_Device(deviceList, j, numberOfDevices);
-                        j--;
-                    }
+                    removeDevice[deviceIter] = true;
+                    break;
                 }
+                else if (keep == DUPLICATE_KEEP_SECOND)
+                {
+                    removeDevice[slots[slot] - 1] = true;
+                    slots[slot] = deviceIter + 1;
+                    break;
+                }
+            }
+            slot = (slot + 1) & (slotCount - 1);
+        }
+        if (slots[slot] == 0)
+        {
+            //no duplicate removed, so this one is kept and others may match against it
+            slots[slot] = deviceIter + 1;
+        }
+    }
 
+    //compact the list in one sweep so each kept device is copied at most once
+    for (uint32_t deviceIter = 0; deviceIter < deviceCount; ++deviceIter)
+    {
+        if (removeDevice[deviceIter])
+        {
+#ifdef _DEBUG
+            printf("Removing Drive with index : %" PRIu32 " \n", deviceIter);
 #endif
-            }
+            //close the removed handle so its OS handle and everything allocated with it (CSMI data, buffer pool, log cache, etc) is released before the entry is overwritten
+            close_Device(deviceList + deviceIter);
+            continue;
+        }
+        if (keptCount != deviceIter)
+        {
+            memcpy((deviceList + keptCount), (deviceList + deviceIter), sizeof(tDevice));
         }
+        ++keptCount;
+    }
+    if (keptCount < deviceCount)
+    {
+        memset((deviceList + keptCount), 0, sizeof(tDevice) * (deviceCount - keptCount));
     }
+    *numberOfDevices = keptCount;
+    safe_Free(slots);
+    safe_Free(removeDevice);
     return ret;
 }
 
@@ -2028,7 +2142,6 @@ bool is_CSMI_Device(tDevice *device)
 
 #if defined (_DEBUG)
 //This function is more for debugging than anything else!
-#include <stddef.h>
 void print_tDevice_Size()
 {
     printf("==Device struct information==\n");
@@ -2041,11 +2154,34 @@ void print_tDevice_Size()
     printf("\tissue_io_func = %zu\n", sizeof(issue_io_func));
     printf("\teDiscoveryOptions = %zu\n", sizeof(eDiscoveryOptions));
     printf("\teVerbosityLevels = %zu\n", sizeof(eVerbosityLevels));
+    printf("\tasyncIOQueue* asyncIO = %zu\n", sizeof(asyncIOQueue*));
+    printf("\tuint64_t commandHeapAllocations = %zu\n", sizeof(uint64_t));
+    printf("\tdeviceBufferPool* bufferPool = %zu\n", sizeof(deviceBufferPool*));
+    printf("\tdeviceLogCache* logCache = %zu\n", sizeof(deviceLogCache*));
+    printf("\tdeviceZoneMap* zoneMap = %zu\n", sizeof(deviceZoneMap*));
+    printf("\tdeviceSupportedOpCodes* supportedOpCodes = %zu\n", sizeof(deviceSupportedOpCodes*));
+    printf("\teDriveInfoTier driveInfoTier = %zu\n", sizeof(eDriveInfoTier));
     printf("\n--Important offsets--\n");
     printf("tDevice = 0\n");
     printf("\tversionBlock = %zu\n", offsetof(tDevice, sanity));
+    printf("\tdFlags = %zu\n", offsetof(tDevice, dFlags));
+    printf("\tdeviceVerbosity = %zu\n", offsetof(tDevice, deviceVerbosity));
+    printf("\traid_device = %zu\n", offsetof(tDevice, raid_device));
+    printf("\tissue_io = %zu\n", offsetof(tDevice, issue_io));
+    printf("\tissue_nvme_io = %zu\n", offsetof(tDevice, issue_nvme_io));
+    printf("\tbufferPool = %zu\n", offsetof(tDevice, bufferPool));
+    printf("\tasyncIO = %zu\n", offsetof(tDevice, asyncIO));
+    printf("\tlogCache = %zu\n", offsetof(tDevice, logCache));
+    printf("\tzoneMap = %zu\n", offsetof(tDevice, zoneMap));
+    printf("\tsupportedOpCodes = %zu\n", offsetof(tDevice, supportedOpCodes));
+    printf("\tcommandHeapAllocations = %zu\n", offsetof(tDevice, commandHeapAllocations));
+    printf("\tdriveInfoTier = %zu\n", offsetof(tDevice, driveInfoTier));
     printf("\tos_info = %zu\n", offsetof(tDevice, os_info));
+    printf("\t\tname = %zu\n", offsetof(tDevice, os_info.name));
     printf("\tdrive_info = %zu\n", offsetof(tDevice, drive_info));
+    printf("\t\tpassThroughHacks = %zu\n", offsetof(tDevice, drive_info.passThroughHacks));
+    printf("\t\tlastCommandSenseData = %zu\n", offsetof(tDevice, drive_info.lastCommandSenseData));
+    printf("\t\tserialNumber (start of identification data) = %zu\n", offsetof(tDevice, drive_info.serialNumber));
     printf("\t\tIdentifyData = %zu\n", offsetof(tDevice, drive_info.IdentifyData));
     printf("\t\tATA Identify = %zu\n", offsetof(tDevice, drive_info.IdentifyData.ata));
     #if !defined (DISABLE_NVME_PASSTHROUGH)
@@ -2053,1929 +2189,2740 @@ void print_tDevice_Size()
     printf("\t\tNVMe Namespace ID = %zu\n", offsetof(tDevice, drive_info.IdentifyData.nvme.ns));
     #endif
     printf("\t\tscsiVpdData = %zu\n", offsetof(tDevice, drive_info.scsiVpdData));
-    printf("\t\tlastCommandSenseData = %zu\n", offsetof(tDevice, drive_info.lastCommandSenseData));
-    printf("\traid_device = %zu\n", offsetof(tDevice, raid_device));
-    printf("\tissue_io = %zu\n", offsetof(tDevice, issue_io));
-    printf("\tissue_nvme_io = %zu\n", offsetof(tDevice, issue_nvme_io));
-    printf("\tdFlags = %zu\n", offsetof(tDevice, dFlags));
-    printf("\tdeviceVerbosity = %zu\n", offsetof(tDevice, deviceVerbosity));
+    printf("\t\tsoftSATFlags = %zu\n", offsetof(tDevice, drive_info.softSATFlags));
     printf("\n");
 }
 #endif //_DEBUG
 
-bool is_Removable_Media(tDevice *device)
+typedef struct _deviceBufferPoolEntry
 {
-    bool result = false;
-    uint8_t scsiDevType;
+    uint8_t *buffer;
+    uint32_t size;
+    bool leased;
+}deviceBufferPoolEntry;
 
-    if(device->drive_info.interface_type == IDE_INTERFACE) 
+struct _deviceBufferPool
+{
+    size_t alignment;
+    uint32_t maxKeptSize;//largest buffer size requested with start_Device_Buffer_Pool
+    deviceBufferPoolEntry entries[DEVICE_BUFFER_POOL_MAX_BUFFERS];
+};
+
+static int create_Device_Buffer_Pool(tDevice *device)
+{
+    size_t pageSize = get_System_Pagesize();
+    if (device->bufferPool)
     {
-        if(device->drive_info.drive_type == UNKNOWN_DRIVE || 
-           device->drive_info.drive_type == FLASH_DRIVE ||
-           device->drive_info.drive_type == ATAPI_DRIVE || 
-           device->drive_info.media_type == MEDIA_OPTICAL || 
-           device->drive_info.media_type == MEDIA_SSM_FLASH || 
-           device->drive_info.media_type == MEDIA_TAPE || 
-           device->drive_info.media_type == MEDIA_UNKNOWN ||
-           (device->drive_info.IdentifyData.ata.Word000 & BIT7) )
+        return SUCCESS;
+    }
+    device->bufferPool = (deviceBufferPool*)calloc(1, sizeof(deviceBufferPool));
+    if (!device->bufferPool)
+    {
+        return MEMORY_FAILURE;
+    }
+    //page alignment is what OS direct IO paths generally need. Use the device requirement if that is larger.
+    device->bufferPool->alignment = M_Max(pageSize, (size_t)device->os_info.minimumAlignment);
+    if (device->bufferPool->alignment == 0)
+    {
+        device->bufferPool->alignment = 4096;
+    }
+    return SUCCESS;
+}
+
+//Pooled buffers are rounded up to the pool alignment so that small requests can reuse them for larger ones later.
+static uint32_t device_Buffer_Pool_Round_Size(deviceBufferPool *pool, uint32_t size)
+{
+    uint64_t rounded = (((uint64_t)size + pool->alignment - 1) / pool->alignment) * pool->alignment;
+    return rounded > UINT32_MAX ? size : (uint32_t)rounded;
+}
+
+//Largest buffer the pool keeps. This is the library's normal transfer length (get_Sector_Count_For_Read_Write) unless start_Device_Buffer_Pool asked for larger buffers.
+//Larger one time requests (bounce buffers, large verifies, etc) get their own allocation so they are not pinned until close_Device.
+static uint32_t device_Buffer_Pool_Max_Kept_Size(tDevice *device)
+{
+    uint32_t maxKeptSize = DATA_64K;
+    if (device->drive_info.deviceBlockSize > 0)
+    {
+        maxKeptSize = get_Sector_Count_For_Read_Write(device) * device->drive_info.deviceBlockSize;
+    }
+    maxKeptSize = device_Buffer_Pool_Round_Size(device->bufferPool, maxKeptSize);
+    return M_Max(maxKeptSize, device->bufferPool->maxKeptSize);
+}
+
+int start_Device_Buffer_Pool(tDevice *device, uint32_t bufferCount, uint32_t bufferSize)
+{
+    int ret = SUCCESS;
+    if (!device)
+    {
+        return BAD_PARAMETER;
+    }
+    if (bufferSize == 0)
+    {
+        bufferSize = get_Sector_Count_For_Read_Write(device) * device->drive_info.deviceBlockSize;
+    }
+    if (SUCCESS != create_Device_Buffer_Pool(device))
+    {
+        return MEMORY_FAILURE;
+    }
+    bufferCount = M_Min(bufferCount, DEVICE_BUFFER_POOL_MAX_BUFFERS);
+    bufferSize = device_Buffer_Pool_Round_Size(device->bufferPool, bufferSize);
+    device->bufferPool->maxKeptSize = M_Max(device->bufferPool->maxKeptSize, bufferSize);
+    for (uint32_t entryIter = 0; entryIter < DEVICE_BUFFER_POOL_MAX_BUFFERS && bufferCount > 0; ++entryIter)
+    {
+        deviceBufferPoolEntry *entry = &device->bufferPool->entries[entryIter];
+        if (entry->leased || entry->size >= bufferSize)
         {
-            result = true;
+            if (entry->buffer)
+            {
+                --bufferCount;
+            }
+            continue;
+        }
+        safe_Free_aligned(entry->buffer);
+        entry->size = 0;
+        entry->buffer = (uint8_t*)malloc_aligned(bufferSize, device->bufferPool->alignment);
+        if (!entry->buffer)
+        {
+            ret = MEMORY_FAILURE;
+            break;
         }
+        entry->size = bufferSize;
+        --bufferCount;
     }
-    else if(device->drive_info.interface_type == SCSI_INTERFACE) 
+    return ret;
+}
+
+void stop_Device_Buffer_Pool(tDevice *device)
+{
+    if (!device || !device->bufferPool)
     {
-        scsiDevType = device->drive_info.scsiVpdData.inquiryData[0] & 0x1F;
+        return;
+    }
+    for (uint32_t entryIter = 0; entryIter < DEVICE_BUFFER_POOL_MAX_BUFFERS; ++entryIter)
+    {
+        //leased buffers now belong to whoever holds them. return_Device_Buffer will free them since they are no longer in a pool.
+        if (!device->bufferPool->entries[entryIter].leased)
+        {
+            safe_Free_aligned(device->bufferPool->entries[entryIter].buffer);
+        }
+    }
+    safe_Free(device->bufferPool);
+}
 
-        if (scsiDevType == PERIPHERAL_DIRECT_ACCESS_BLOCK_DEVICE ||
-            scsiDevType == PERIPHERAL_HOST_MANAGED_ZONED_BLOCK_DEVICE ||
-            scsiDevType == PERIPHERAL_SEQUENTIAL_ACCESS_BLOCK_DEVICE ||
-            scsiDevType == PERIPHERAL_STORAGE_ARRAY_CONTROLLER_DEVICE)
+uint8_t* lease_Device_Buffer(tDevice *device, uint32_t size)
+{
+    deviceBufferPoolEntry *bestFit = NULL;
+    deviceBufferPoolEntry *reuse = NULL;
+    if (!device)
+    {
+        return NULL;
+    }
+    if (size == 0 || SUCCESS != create_Device_Buffer_Pool(device))
+    {
+        device->commandHeapAllocations++;
+        return (uint8_t*)calloc_aligned(size, sizeof(uint8_t), device->os_info.minimumAlignment);
+    }
+    if (size > device_Buffer_Pool_Max_Kept_Size(device))
+    {
+        //too large to keep in the pool. return_Device_Buffer frees it.
+        device->commandHeapAllocations++;
+        return (uint8_t*)calloc_aligned(size, sizeof(uint8_t), device->bufferPool->alignment);
+    }
+    for (uint32_t entryIter = 0; entryIter < DEVICE_BUFFER_POOL_MAX_BUFFERS; ++entryIter)
+    {
+        deviceBufferPoolEntry *entry = &device->bufferPool->entries[entryIter];
+        if (entry->leased)
         {
-            if (device->drive_info.scsiVpdData.inquiryData[1] & BIT7)
+            continue;
+        }
+        if (entry->buffer && entry->size >= size)
+        {
+            if (!bestFit || entry->size < bestFit->size)
             {
-                result = true;
+                bestFit = entry;
             }
-            else
+        }
+        else if (!reuse || !entry->buffer || (reuse->buffer && entry->size > reuse->size))
+        {
+            //prefer an empty entry, then the largest free buffer that is too small, to grow
+            reuse = entry;
+        }
+    }
+    if (!bestFit && reuse)
+    {
+        uint32_t newSize = device_Buffer_Pool_Round_Size(device->bufferPool, size);
+        safe_Free_aligned(reuse->buffer);
+        reuse->size = 0;
+        reuse->buffer = (uint8_t*)malloc_aligned(newSize, device->bufferPool->alignment);
+        device->commandHeapAllocations++;
+        if (reuse->buffer)
+        {
+            reuse->size = newSize;
+            bestFit = reuse;
+        }
+    }
+    if (!bestFit)
+    {
+        //every pooled buffer is in use
+        device->commandHeapAllocations++;
+        return (uint8_t*)calloc_aligned(size, sizeof(uint8_t), device->bufferPool->alignment);
+    }
+    bestFit->leased = true;
+    memset(bestFit->buffer, 0, size);
+    return bestFit->buffer;
+}
+
+void return_Device_Buffer(tDevice *device, uint8_t *buffer)
+{
+    if (!buffer)
+    {
+        return;
+    }
+    if (device && device->bufferPool)
+    {
+        for (uint32_t entryIter = 0; entryIter < DEVICE_BUFFER_POOL_MAX_BUFFERS; ++entryIter)
+        {
+            deviceBufferPoolEntry *entry = &device->bufferPool->entries[entryIter];
+            if (entry->buffer == buffer)
             {
-                result = false;
+                entry->leased = false;
+                if (entry->size > device_Buffer_Pool_Max_Kept_Size(device))
+                {
+                    //grew before the normal transfer length was known (ex: block size filled in later). Do not keep it.
+                    safe_Free_aligned(entry->buffer);
+                    entry->size = 0;
+                }
+                return;
             }
         }
-        else
+    }
+    free_aligned(buffer);
+}
+
+bool is_Device_Pool_Buffer(tDevice *device, const uint8_t *buffer, uint32_t length)
+{
+    if (!device || !device->bufferPool || !buffer)
+    {
+        return false;
+    }
+    for (uint32_t entryIter = 0; entryIter < DEVICE_BUFFER_POOL_MAX_BUFFERS; ++entryIter)
+    {
+        deviceBufferPoolEntry *entry = &device->bufferPool->entries[entryIter];
+        if (entry->buffer && buffer >= entry->buffer && (uint64_t)(buffer - entry->buffer) + length <= entry->size)
         {
-            result = true;
+            return true;
         }
-        
+    }
+    return false;
+}
+
+typedef struct _deviceLogCacheEntry
+{
+    eDeviceLogCacheSource source;
+    uint32_t logAddress;
+    uint32_t subAddress;
+    uint32_t dataSize;//0 means the entry is empty
+    uint32_t bufferSize;
+    uint8_t *data;
+    seatimer_t age;//started when the data was stored
+}deviceLogCacheEntry;
 
+struct _deviceLogCache
+{
+    uint32_t ttlMilliseconds;
+    uint32_t nextReplacement;
+    deviceLogCacheEntry entries[DEVICE_LOG_CACHE_MAX_ENTRIES];
+};
+
+int set_Device_Log_Cache_TTL(tDevice *device, uint32_t ttlMilliseconds)
+{
+    if (!device)
+    {
+        return BAD_PARAMETER;
     }
-    if (device->deviceVerbosity > VERBOSITY_COMMAND_NAMES )
+    if (ttlMilliseconds == 0)
     {
-        printf("Calling from file : %s function : %s line : %d \n", __FILE__, __FUNCTION__, __LINE__);
-        if (result)
+        stop_Device_Log_Cache(device);
+        return SUCCESS;
+    }
+    if (!device->logCache)
+    {
+        device->logCache = (deviceLogCache*)calloc(1, sizeof(deviceLogCache));
+        if (!device->logCache)
         {
-            printf("This is a Removable Media");
+            return MEMORY_FAILURE;
         }
-        else
+    }
+    device->logCache->ttlMilliseconds = ttlMilliseconds;
+    return SUCCESS;
+}
+
+void invalidate_Device_Log_Cache(tDevice *device)
+{
+    if (!device || !device->logCache)
+    {
+        return;
+    }
+    for (uint32_t entryIter = 0; entryIter < DEVICE_LOG_CACHE_MAX_ENTRIES; ++entryIter)
+    {
+        //keep the buffer around since the same log will most likely be stored here again
+        device->logCache->entries[entryIter].dataSize = 0;
+    }
+}
+
+void stop_Device_Log_Cache(tDevice *device)
+{
+    if (!device || !device->logCache)
+    {
+        return;
+    }
+    for (uint32_t entryIter = 0; entryIter < DEVICE_LOG_CACHE_MAX_ENTRIES; ++entryIter)
+    {
+        safe_Free(device->logCache->entries[entryIter].data);
+    }
+    safe_Free(device->logCache);
+}
+
+static deviceLogCacheEntry* find_Device_Log_Cache_Entry(deviceLogCache *cache, eDeviceLogCacheSource source, uint32_t logAddress, uint32_t subAddress)
+{
+    for (uint32_t entryIter = 0; entryIter < DEVICE_LOG_CACHE_MAX_ENTRIES; ++entryIter)
+    {
+        deviceLogCacheEntry *entry = &cache->entries[entryIter];
+        if (entry->dataSize > 0 && entry->source == source && entry->logAddress == logAddress && entry->subAddress == subAddress)
         {
-            printf("This is not a Removable Media");
+            return entry;
         }
     }
-    return result;
+    return NULL;
 }
-//https://usb-ids.gowdy.us/
-//http://www.linux-usb.org/usb.ids
-bool set_USB_Passthrough_Hacks_By_PID_and_VID(tDevice *device)
+
+bool get_Device_Log_Cache_Entry(tDevice *device, eDeviceLogCacheSource source, uint32_t logAddress, uint32_t subAddress, uint8_t *ptrData, uint32_t dataSize)
 {
-    bool passthroughHacksSet = false;
-    //only change the ATA Passthrough type for USB (for legacy USB bridges)
-    if (device->drive_info.interface_type == USB_INTERFACE)
+    deviceLogCacheEntry *entry = NULL;
+    seatimer_t elapsed;
+    if (!device || !device->logCache || !ptrData || dataSize == 0)
     {
-        //Most USB bridges are SAT so they'll probably fall into the default cases and issue an identify command for SAT
-        switch (device->drive_info.adapter_info.vendorID)
-        {
-        case USB_Vendor_Seagate://0477
-            switch (device->drive_info.adapter_info.productID)
-            {
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_Seagate_RSS://0BC2
-            switch (device->drive_info.adapter_info.productID)
+        return false;
+    }
+    entry = find_Device_Log_Cache_Entry(device->logCache, source, logAddress, subAddress);
+    if (!entry || entry->dataSize != dataSize)
+    {
+        return false;
+    }
+    elapsed = entry->age;
+    stop_Timer(&elapsed);
+    if (get_Milli_Seconds(elapsed) > (double)device->logCache->ttlMilliseconds)
+    {
+        entry->dataSize = 0;
+        return false;
+    }
+    memcpy(ptrData, entry->data, dataSize);
+    return true;
+}
+
+void set_Device_Log_Cache_Entry(tDevice *device, eDeviceLogCacheSource source, uint32_t logAddress, uint32_t subAddress, const uint8_t *ptrData, uint32_t dataSize)
+{
+    deviceLogCacheEntry *entry = NULL;
+    if (!device || !device->logCache || !ptrData || dataSize == 0)
+    {
+        return;
+    }
+    entry = find_Device_Log_Cache_Entry(device->logCache, source, logAddress, subAddress);
+    if (!entry)
+    {
+        //use an empty slot if there is one, otherwise replace entries in the order they were filled
+        for (uint32_t entryIter = 0; entryIter < DEVICE_LOG_CACHE_MAX_ENTRIES && !entry; ++entryIter)
+        {
+            if (device->logCache->entries[entryIter].dataSize == 0)
             {
-            case 0x0888://0BC2 VID
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_NEC;
-                passthroughHacksSet = true;
-                break;
-            case 0x0500://ST3750640A
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 5;
-                device->drive_info.passThroughHacks.scsiHacks.preSCSI2InqData = true;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDOffset = 8;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDLength = 24;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 122880;
-                break;
-            case 0x0501://
-                //revision 0002h
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_CYPRESS;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 6;
-                device->drive_info.passThroughHacks.scsiHacks.preSCSI2InqData = true;
-                //device->drive_info.passThroughHacks.scsiHacks.scsiInq
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;//TODO: Cypress passthrough has a bit for UDMA mode, but didn't appear to work in testing.
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x0502:
-                //revision 0200h
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_TI;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.noMultipleModeCommands = true;//mutliple mode commands don't work in passthrough.
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x0503://Seagate External Drive
-                //revision 0240h
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_CYPRESS;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 6;
-                device->drive_info.passThroughHacks.scsiHacks.preSCSI2InqData = true;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.vendorIDOffset = 8;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.vendorIDLength = 8;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDOffset = 16;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDLength = 14;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;//TODO: Cypress passthrough has a bit for UDMA mode, but didn't appear to work in testing.
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x1000://FreeAgentGoSmall
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 9;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly = true;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x2100://FreeAgent Go
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly = true;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x2101://FreeAgent Go
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x2120://FreeAgent Go
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x2300://Portable
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 11;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x2320://Expansion
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 11;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0x2321://Expansion
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 10;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0x2322://Expansion (Xbox drive uses this chip)
-                //NOTE: Need to rerun a full test someday as we don't have full confirmation on supported read commands...just assumed same as above chip for now.
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0x2330://Portable
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 10;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 512;
-                break;
-            case 0x2332://Portable
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 6;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 8192;
-                break;
-            case 0x2400://Backup
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 10;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x2700://BlackArmorDAS25
-                passthroughHacksSet = true;
-                //This particular bridge has lots of limitations
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 12;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly = true;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 131072;
-                break;
-            case 0x3000://???
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 16;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly = true;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x3001://FreeAgent
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly = true;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x3010://FreeAgent Pro
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 16;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 122880;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 122880;
-                break;
-            case 0x3300://Desktop
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 17;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x3320://Expansion Desk
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 524288;
-                break;
-            case 0x3330://External
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 11;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 512;
-                break;
-            case 0x3332://External
-                //rev 0016h
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 31;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 1024;
-                break;
-            case 0x3340://Expansion+ Desk
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 11;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0x5020://USB 2.0 Cable
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 16;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 524288;
-                break;
-            case 0x5021://FreeAgent GoFlex
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x5030://???
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 16;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 524288;
-                break;
-            case 0x5031://Freeagent GoFlex. 
-                passthroughHacksSet = true;
-                //This particular bridge has lots of limitations
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly = true;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseDMAInsteadOfUDMA = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65024;
-                break;
-            case 0x5060://FreeAgent
-                //rev 155h
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x5070://FA GoFlex Desk
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                //device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x5071://GoFlex Desk
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 16;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x50A5://GoFlex Desk
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 524288;
-                break;
-            case 0x50A7://GoFlex Desk
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 11;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 512;
-                break;
-            case 0x5130://GoFlex Cable
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 12;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x5170://USB 3.0 Cable
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 10;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 524288;
-                break;
-            case 0x6126://D3 Station
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 10;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x617A: //GoFlex Slim Mac
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.turfValue = 2;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 524288;
-                break;
-            case 0x61B5://M3 Portable
-                //rev 1402h
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.turfValue = 11;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0xA003://GoFlex Slim
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.turfValue = 12;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 209920;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 512;
-                break;
-            case 0xA013://Backup+ RD
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;//some testing shows 524288
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;//some testing shows 524288
-                break;
-            case 0xA014://Slim BK
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.turfValue = 3;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0xA0A4://GoFlex Desk
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                //NOTE: TPSIU worked for identify but not other commands when tested.
-                break;
-            case 0xA313://Wireless
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 524288;
-                break;
-            case 0xA314://Wireless Plus
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.turfValue = 12;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0xAB00://Slim BK
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 11;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0xAB01://BUP Fast SSD
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 8;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0xAB02://Fast
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                //Hangs if sent a SCSI read with length set to 0.
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0xAB10://BUP Slim SL
-            //rev 938h
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 82944;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 8192;
-                break;
-            case 0xAB20://Backup+ SL
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 10;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0xAB21://Backup+ BL
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 512;
-                break;
-            case 0xAB24://BUP Slim
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                //Hangs if sent a SCSI read with length set to 0.
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0xAB2A://Fast HDD
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                //device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;//Not sure if this actually worked when the test tool pumped this result out. Off for now.
-                //device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;//This only worked for identify
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                //This device has 2 HDDs in a RAID inside it.
-                //There is no known way to address each one separately.
-                //Also, for whatever reason, it is not possible to read any logs from the drive you can get identify data from.
-                //This may be a pre-production unit that was tested and other shipping products may work differently. - TJE
-                break;
-            case 0xAB31://Backup+  Desk
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 8192;
-                break;
+                entry = &device->logCache->entries[entryIter];
+            }
+        }
+        if (!entry)
+        {
+            entry = &device->logCache->entries[device->logCache->nextReplacement];
+            device->logCache->nextReplacement = (device->logCache->nextReplacement + 1) % DEVICE_LOG_CACHE_MAX_ENTRIES;
+        }
+    }
+    if (entry->bufferSize < dataSize)
+    {
+        uint8_t *data = (uint8_t*)realloc(entry->data, dataSize);
+        entry->dataSize = 0;
+        if (!data)
+        {
+            return;
+        }
+        entry->data = data;
+        entry->bufferSize = dataSize;
+    }
+    entry->source = source;
+    entry->logAddress = logAddress;
+    entry->subAddress = subAddress;
+    entry->dataSize = dataSize;
+    memcpy(entry->data, ptrData, dataSize);
+    memset(&entry->age, 0, sizeof(seatimer_t));
+    start_Timer(&entry->age);
+}
+
+//Kept outside of driveInfo so that copies of driveInfo (ex: the discovery cache) never carry these pointers
+struct _deviceSupportedOpCodes
+{
+    uint32_t dataLength[2];
+    uint8_t *data[2];//indexed by RCTD
+};
+
+int get_Memoized_Supported_Op_Codes(tDevice *device, bool rctd, build_Supported_Op_Codes_Func build, const uint8_t **pdata, uint32_t *dataLength)
+{
+    uint8_t rctdIndex = rctd ? 1 : 0;
+    if (!device || !build || !pdata || !dataLength)
+    {
+        return BAD_PARAMETER;
+    }
+    if (!device->supportedOpCodes)
+    {
+        device->supportedOpCodes = (deviceSupportedOpCodes*)calloc(1, sizeof(deviceSupportedOpCodes));
+        if (!device->supportedOpCodes)
+        {
+            return MEMORY_FAILURE;
+        }
+    }
+    if (!device->supportedOpCodes->data[rctdIndex])
+    {
+        uint8_t *opCodes = NULL;
+        uint32_t opCodesLength = 0;
+        int ret = build(device, rctd, &opCodes, &opCodesLength);
+        if (ret != SUCCESS)
+        {
+            safe_Free(opCodes);
+            return ret;
+        }
+        if (opCodesLength > 0)
+        {
+            //builders allocate for the worst case. Only keep what was used.
+            uint8_t *trimmed = (uint8_t*)realloc(opCodes, opCodesLength);
+            if (trimmed)
+            {
+                opCodes = trimmed;
+            }
+        }
+        device->supportedOpCodes->data[rctdIndex] = opCodes;
+        device->supportedOpCodes->dataLength[rctdIndex] = opCodesLength;
+    }
+    *pdata = device->supportedOpCodes->data[rctdIndex];
+    *dataLength = device->supportedOpCodes->dataLength[rctdIndex];
+    return SUCCESS;
+}
+
+void free_Memoized_Supported_Op_Codes(tDevice *device)
+{
+    if (!device || !device->supportedOpCodes)
+    {
+        return;
+    }
+    for (uint8_t rctdIndex = 0; rctdIndex < 2; ++rctdIndex)
+    {
+        safe_Free(device->supportedOpCodes->data[rctdIndex]);
+    }
+    safe_Free(device->supportedOpCodes);
+}
+
+bool is_Removable_Media(tDevice *device)
+{
+    bool result = false;
+    uint8_t scsiDevType;
+
+    if(device->drive_info.interface_type == IDE_INTERFACE) 
+    {
+        if(device->drive_info.drive_type == UNKNOWN_DRIVE || 
+           device->drive_info.drive_type == FLASH_DRIVE ||
+           device->drive_info.drive_type == ATAPI_DRIVE || 
+           device->drive_info.media_type == MEDIA_OPTICAL || 
+           device->drive_info.media_type == MEDIA_SSM_FLASH || 
+           device->drive_info.media_type == MEDIA_TAPE || 
+           device->drive_info.media_type == MEDIA_UNKNOWN ||
+           (device->drive_info.IdentifyData.ata.Word000 & BIT7) )
+        {
+            result = true;
+        }
+    }
+    else if(device->drive_info.interface_type == SCSI_INTERFACE) 
+    {
+        scsiDevType = device->drive_info.scsiVpdData.inquiryData[0] & 0x1F;
+
+        if (scsiDevType == PERIPHERAL_DIRECT_ACCESS_BLOCK_DEVICE ||
+            scsiDevType == PERIPHERAL_HOST_MANAGED_ZONED_BLOCK_DEVICE ||
+            scsiDevType == PERIPHERAL_SEQUENTIAL_ACCESS_BLOCK_DEVICE ||
+            scsiDevType == PERIPHERAL_STORAGE_ARRAY_CONTROLLER_DEVICE)
+        {
+            if (device->drive_info.scsiVpdData.inquiryData[1] & BIT7)
+            {
+                result = true;
+            }
+            else
+            {
+                result = false;
+            }
+        }
+        else
+        {
+            result = true;
+        }
+        
+
+    }
+    if (device->deviceVerbosity > VERBOSITY_COMMAND_NAMES )
+    {
+        printf("Calling from file : %s function : %s line : %d \n", __FILE__, __FUNCTION__, __LINE__);
+        if (result)
+        {
+            printf("This is a Removable Media");
+        }
+        else
+        {
+            printf("This is not a Removable Media");
+        }
+    }
+    return result;
+}
+//https://usb-ids.gowdy.us/
+//http://www.linux-usb.org/usb.ids
+//Known USB and IEEE1394 adapters are described by a list of passthroughHacks field settings rather than code.
+//Settings are applied to the device's passThroughHacks in order, so fields already set by the OS layer and not listed are left alone.
+//A record for a specific revision is applied after the record for all revisions of the same adapter.
+typedef struct _passthroughHackSetting
+{
+    uint16_t offset;//offset of the field in passthroughHacks
+    uint8_t size;//size of the field in bytes
+    uint32_t value;
+}passthroughHackSetting;
+
+#define PT_HACK_FIELD_SIZE(field) sizeof(((passthroughHacks*)0)->field)
+#define PT_HACK(field, val) { (uint16_t)offsetof(passthroughHacks, field), (uint8_t)PT_HACK_FIELD_SIZE(field), (uint32_t)(val) }
+#define PT_HACKS_ANY_REVISION UINT32_MAX
+#define PT_HACKS_SETTINGS(settingsArray) (uint16_t)(sizeof(settingsArray) / sizeof(settingsArray[0])), settingsArray
+
+typedef struct _passthroughHacksRecord
+{
+    eAdapterInfoType infoType;
+    uint32_t vendorID;
+    uint32_t productID;
+    uint32_t revision;//PT_HACKS_ANY_REVISION matches all revisions
+    eDriveType driveType;//UNKNOWN_DRIVE leaves the drive type alone
+    eMediaType mediaType;//MEDIA_UNKNOWN leaves the media type alone
+    uint16_t settingCount;
+    const passthroughHackSetting *settings;
+}passthroughHacksRecord;
+
+//USB USB_Vendor_Seagate_RSS - 0BC2
+static const passthroughHackSetting usbHacks_0BC2_0888[] = {//0BC2 VID
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_NEC),
+};
+static const passthroughHackSetting usbHacks_0BC2_0500[] = {//ST3750640A
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 5),
+    PT_HACK(scsiHacks.preSCSI2InqData, true),
+    PT_HACK(scsiHacks.scsiInq.productIDOffset, 8),
+    PT_HACK(scsiHacks.scsiInq.productIDLength, 24),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 122880),
+};
+static const passthroughHackSetting usbHacks_0BC2_0501[] = {
+    //revision 0002h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_CYPRESS),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 6),
+    PT_HACK(scsiHacks.preSCSI2InqData, true),
+    //scsiHacks.scsiInq
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    PT_HACK(ataPTHacks.ata28BitOnly, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),//TODO: Cypress passthrough has a bit for UDMA mode, but didn't appear to work in testing.
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_0502[] = {
+    //revision 0200h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_TI),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    PT_HACK(ataPTHacks.ata28BitOnly, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.noMultipleModeCommands, true),//mutliple mode commands don't work in passthrough.
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_0503[] = {//Seagate External Drive
+    //revision 0240h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_CYPRESS),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 6),
+    PT_HACK(scsiHacks.preSCSI2InqData, true),
+    PT_HACK(scsiHacks.scsiInq.vendorIDOffset, 8),
+    PT_HACK(scsiHacks.scsiInq.vendorIDLength, 8),
+    PT_HACK(scsiHacks.scsiInq.productIDOffset, 16),
+    PT_HACK(scsiHacks.scsiInq.productIDLength, 14),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    PT_HACK(ataPTHacks.ata28BitOnly, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),//TODO: Cypress passthrough has a bit for UDMA mode, but didn't appear to work in testing.
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_1000[] = {//FreeAgentGoSmall
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 9),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    PT_HACK(ataPTHacks.ata28BitOnly, true),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_2100[] = {//FreeAgent Go. Also used for FreeAgent (3001h).
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    PT_HACK(ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly, true),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_2101[] = {//FreeAgent Go
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_2120[] = {//FreeAgent Go
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_2300[] = {//Portable
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 11),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_2320[] = {//Expansion. Also used for Slim BK (AB00h).
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 11),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_2321[] = {//Expansion
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 10),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_2322[] = {//Expansion (Xbox drive uses this chip)
+    //NOTE: Need to rerun a full test someday as we don't have full confirmation on supported read commands...just assumed same as above chip for now.
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_2330[] = {//Portable
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 10),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.singleSectorPIOOnly, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 512),
+};
+static const passthroughHackSetting usbHacks_0BC2_2332[] = {//Portable
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 6),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 8192),
+};
+static const passthroughHackSetting usbHacks_0BC2_2400[] = {//Backup
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 10),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_2700[] = {//BlackArmorDAS25
+    //This particular bridge has lots of limitations
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 12),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    PT_HACK(ataPTHacks.ata28BitOnly, true),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 131072),
+};
+static const passthroughHackSetting usbHacks_0BC2_3000[] = {//???
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 16),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    PT_HACK(ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly, true),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_3010[] = {//FreeAgent Pro
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 16),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 122880),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 122880),
+};
+static const passthroughHackSetting usbHacks_0BC2_3300[] = {//Desktop
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 17),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_3320[] = {//Expansion Desk
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 524288),
+};
+static const passthroughHackSetting usbHacks_0BC2_3330[] = {//External
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 11),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.singleSectorPIOOnly, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 512),
+};
+static const passthroughHackSetting usbHacks_0BC2_3332[] = {//External
+    //rev 0016h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 31),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 1024),
+};
+static const passthroughHackSetting usbHacks_0BC2_3340[] = {//Expansion+ Desk
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 11),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_5020[] = {//USB 2.0 Cable
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 16),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 524288),
+};
+static const passthroughHackSetting usbHacks_0BC2_5021[] = {//FreeAgent GoFlex
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_5030[] = {//???
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 16),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 524288),
+};
+static const passthroughHackSetting usbHacks_0BC2_5031[] = {//Freeagent GoFlex. 
+    //This particular bridge has lots of limitations
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    PT_HACK(ataPTHacks.ata28BitOnly, true),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.alwaysUseDMAInsteadOfUDMA, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65024),
+};
+static const passthroughHackSetting usbHacks_0BC2_5060[] = {//FreeAgent
+    //rev 155h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_5070[] = {//FA GoFlex Desk
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    //PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_5071[] = {//GoFlex Desk
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 16),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_50A5[] = {//GoFlex Desk
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 524288),
+};
+static const passthroughHackSetting usbHacks_0BC2_50A7[] = {//GoFlex Desk
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 11),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.singleSectorPIOOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 512),
+};
+static const passthroughHackSetting usbHacks_0BC2_5130[] = {//GoFlex Cable
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 12),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_5170[] = {//USB 3.0 Cable
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 10),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 524288),
+};
+static const passthroughHackSetting usbHacks_0BC2_6126[] = {//D3 Station
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 10),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_617A[] = {//GoFlex Slim Mac
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(turfValue, 2),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 524288),
+};
+static const passthroughHackSetting usbHacks_0BC2_61B5[] = {//M3 Portable
+    //rev 1402h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(turfValue, 11),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_A003[] = {//GoFlex Slim
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(turfValue, 12),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 209920),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.singleSectorPIOOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 512),
+};
+static const passthroughHackSetting usbHacks_0BC2_A013[] = {//Backup+ RD
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),//some testing shows 524288
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),//some testing shows 524288
+};
+static const passthroughHackSetting usbHacks_0BC2_A014[] = {//Slim BK
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(turfValue, 3),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0BC2_A0A4[] = {//GoFlex Desk
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(turfValue, 33),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+    //NOTE: TPSIU worked for identify but not other commands when tested.
+};
+static const passthroughHackSetting usbHacks_0BC2_A313[] = {//Wireless
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 524288),
+};
+static const passthroughHackSetting usbHacks_0BC2_A314[] = {//Wireless Plus
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(turfValue, 12),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_AB01[] = {//BUP Fast SSD
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 8),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_AB02[] = {//Fast
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    //Hangs if sent a SCSI read with length set to 0.
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_AB10[] = {//BUP Slim SL
+    //rev 938h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 82944),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.singleSectorPIOOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 8192),
+};
+static const passthroughHackSetting usbHacks_0BC2_AB20[] = {//Backup+ SL
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 10),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_AB21[] = {//Backup+ BL
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.singleSectorPIOOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 512),
+};
+static const passthroughHackSetting usbHacks_0BC2_AB24[] = {//BUP Slim
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    //Hangs if sent a SCSI read with length set to 0.
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_0BC2_AB2A[] = {//Fast HDD
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    //PT_HACK(ataPTHacks.returnResponseInfoSupported, true),//Not sure if this actually worked when the test tool pumped this result out. Off for now.
+    //PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),//This only worked for identify
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+    //This device has 2 HDDs in a RAID inside it.
+    //There is no known way to address each one separately.
+    //Also, for whatever reason, it is not possible to read any logs from the drive you can get identify data from.
+    //This may be a pre-production unit that was tested and other shipping products may work differently. - TJE
+};
+static const passthroughHackSetting usbHacks_0BC2_AB31[] = {//Backup+  Desk
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.singleSectorPIOOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 8192),
+};
+static const passthroughHackSetting usbHacks_0BC2_AA17[] = {//FireCuda Gaming SSD
+    //NOTE: Recommend a retest for this device to double check the hacks. Most are setup based on other ASMedia bridge chip tests.
+    PT_HACK(passthroughType, NVME_PASSTHROUGH_ASMEDIA),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(ataPTHacks.a1NeverSupported, true),//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+};
+
+//USB USB_Vendor_LaCie - 059F
+static const passthroughHackSetting usbHacks_059F_1064[] = {//RuggedKey
+    //One other note: For some reason, the MaxLBA that is reported is DIFFERENT between read capacty 10 and read capacity 16
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+};
+static const passthroughHackSetting usbHacks_059F_1065[] = {
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_059F_1072[] = {//Fuel
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_059F_1091[] = {//Rugged USB-C
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 11),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_059F_10CD[] = {//Rugged SSD
+    PT_HACK(passthroughType, NVME_PASSTHROUGH_JMICRON),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(ataPTHacks.a1NeverSupported, true),//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.securityProtocolWithInc512, false),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //NOTE: Add max passthrough transfer length hack set to 65536
+};
+
+//USB USB_Vendor_Maxtor - 0D49
+static const passthroughHackSetting usbHacks_0D49_5020[] = {//5000DV
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.preSCSI2InqData, true),
+    PT_HACK(scsiHacks.scsiInq.vendorIDOffset, 8),
+    PT_HACK(scsiHacks.scsiInq.vendorIDLength, 8),
+    PT_HACK(scsiHacks.scsiInq.productIDOffset, 16),
+    PT_HACK(scsiHacks.scsiInq.productIDLength, 16),
+    PT_HACK(scsiHacks.scsiInq.productRevOffset, 32),
+    PT_HACK(scsiHacks.scsiInq.productRevLength, 3),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    //PT_HACK(scsiHacks.maxTransferLength, 65536),//Unable to get a good test result on this, so this is currently commented out. - TJE
+};
+static const passthroughHackSetting usbHacks_0D49_7310[] = {//OneTouch
+    //rev 0122h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 10),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0D49_7410[] = {//Basics Desktop
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0D49_7550[] = {//BlackArmor
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.singleSectorPIOOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+
+//USB USB_Vendor_Oxford - 0928
+static const passthroughHackSetting usbHacks_0928_0008[] = {//NOTE: This should be retested for full hacks to improve performance.
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+};
+
+//USB USB_Vendor_4G_Systems_GmbH - 1955
+static const passthroughHackSetting usbHacks_1955_0102[] = {//Generic Frys
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 17),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+
+//USB USB_Vendor_Initio - 13FD
+static const passthroughHackSetting usbHacks_13FD_1340[] = {//Seen in ThermalTake BlackX
+    //Results are for revision 0210h
+    //NOTE: This device doesn't allow for large LBAs, so it is limited on the SCSI read/write commands to a 32bit LBA.
+    //      Using a 12TB drive, this reports 483.72GB....so may need an additional hack at some point to force passthrough read/write commands on a device like this.
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 12),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.dmaNotSupported, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_13FD_1340_Rev0202[] = {//revision 0202h only
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+};
+
+//USB USB_Vendor_ASMedia - 174C
+static const passthroughHackSetting usbHacks_174C_2362[] = {//USB to NVMe adapter
+    //Tested 3 adapters. All report the exact same USB level information, but do in fact work differently (slightly)
+    //The  difference seems to be only noticable in Inquiry Data
+    //1. PID: "ASM236X NVME" could use mode sense 6 and read 6 commands
+    //2. PID: "USB3.1 TO NVME" could NOT do these commands. So setting the lowest common set of rules.
+    //If there are other ASMedia chips that vary in capabilities, then may need to adjust what is done in here, or add a hack to check INQ data to finish setting up remaining hacks
+    PT_HACK(passthroughType, NVME_PASSTHROUGH_ASMEDIA_BASIC),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(ataPTHacks.a1NeverSupported, true),//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
+    //device->drive_info.drive_type = NVME_DRIVE; //Uncomment this line when it is possible to issue NVMe passthrough commands behind ASMedia chips.
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    PT_HACK(nvmePTHacks.limitedPassthroughCapabilities, true),
+    PT_HACK(nvmePTHacks.limitedCommandsSupported.getLogPage, true),
+    PT_HACK(nvmePTHacks.limitedCommandsSupported.identifyGeneric, true),
+};
+static const passthroughHackSetting usbHacks_174C_5106[] = {//Seen in ThermalTake BlackX 5G
+    //Results are for revision 0001h
+    //Does not seem to handle drives with a 4k logical sector size well.
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.maxTransferLength, 122880),//This seems to vary with each time this device is tested
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 36864),//This seems to vary with each time this device is tested.
+};
+static const passthroughHackSetting usbHacks_174C_55AA[] = {//ASMT 2105
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+
+//USB USB_Vendor_JMicron - 152D
+static const passthroughHackSetting usbHacks_152D_0551[] = {//USB 3.0 to SATA/PATA adapter
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 512512),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),
+};
+static const passthroughHackSetting usbHacks_152D_0562[] = {//USB to NVMe adapter. Also used for 0583h.
+    //Rev 204h (0562h), Rev 205h (0583h)
+    PT_HACK(passthroughType, NVME_PASSTHROUGH_JMICRON),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(ataPTHacks.a1NeverSupported, true),//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.securityProtocolWithInc512, false),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+    //NOTE: Add max passthrough transfer length hack set to 65536
+};
+static const passthroughHackSetting usbHacks_152D_2338[] = {//Sabrent USB 2.0 to SATA/PATA. Only tested SATA.
+    //NOTE: Some versions of this chip will NOT do SAT passthrough.
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 122880),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 122880),
+};
+static const passthroughHackSetting usbHacks_152D_2339[] = {//MiniD2 - NOTE: This has custom firmware. If other things use this chip, additional product verification will be necessary.
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 13),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),
+};
+
+//USB USB_Vendor_Samsung - 04E8
+static const passthroughHackSetting usbHacks_04E8_1F05[] = {//S2 Portable
+    //based on revision 0000h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.returnResponseIgnoreExtendBit, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 65536),//Bytes
+    //set SCSI hacks
+    PT_HACK(scsiHacks.maxTransferLength, 65536),//bytes
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, false),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, false),
+    PT_HACK(scsiHacks.readWrite.rw16, false),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.preSCSI2InqData, true),
+    PT_HACK(scsiHacks.scsiInq.vendorIDOffset, 8),
+    PT_HACK(scsiHacks.scsiInq.vendorIDLength, 8),
+    PT_HACK(scsiHacks.scsiInq.productIDOffset, 16),
+    PT_HACK(scsiHacks.scsiInq.productIDLength, 11),
+    //Serial number is not reported in inquiry data or any other known location
+};
+static const passthroughHackSetting usbHacks_04E8_5F12[] = {//Story Station
+    //hacks based on revision 1302h. Not sure if revision level filter is needed right now
+    //Set ATA passthrough hacks
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.returnResponseIgnoreExtendBit, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 130560),//Bytes
+    //set SCSI hacks
+    PT_HACK(scsiHacks.maxTransferLength, 524288),//bytes
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, false),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.securityProtocolWithInc512, true),
+};
+static const passthroughHackSetting usbHacks_04E8_6093[] = {//S2 portable 3
+    //based on revision 0100h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 524288),//Bytes
+    //set SCSI hacks
+    PT_HACK(scsiHacks.maxTransferLength, 524288),//bytes
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, false),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, false),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.noModePages, true),
+};
+static const passthroughHackSetting usbHacks_04E8_61C3[] = {//P3 Portable
+    //based on revision 0E00h
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    //PT_HACK(ataPTHacks.useA1SATPassthroughWheneverPossible, true),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.returnResponseIgnoreExtendBit, true),
+    PT_HACK(ataPTHacks.alwaysUseTPSIUForSATPassthrough, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 523776),//Bytes
+    //set SCSI hacks
+    PT_HACK(scsiHacks.maxTransferLength, 524288),//bytes
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 16),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, false),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+};
+
+//USB USB_Vendor_Silicon_Motion - 090C
+static const passthroughHackSetting usbHacks_090C_1000[] = {//USB DISK - Rev1100
+    //Don't set a passthrough type! This is a USB flash memory, that responds to one of the legacy command requests and it will break it!
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    //this device also supports the device identification VPD page even though the list of pages doesn't work.
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.unitSNAvailable, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+};
+
+//USB USB_Vendor_ChipsBank - 1E3D
+static const passthroughHackSetting usbHacks_1E3D_2093[] = {//v3.1.0.4
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 10),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.securityProtocolWithInc512, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+};
+
+//USB USB_Vendor_Alcor_Micro_Corp - 058F
+static const passthroughHackSetting usbHacks_058F_6387[] = {//flash drive - Rev 0103
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_UNKNOWN),
+};
+
+//USB USB_Vendor_Integrated_Techonology_Express_Inc - 048D
+static const passthroughHackSetting usbHacks_048D_1172[] = {//flash drive
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_UNKNOWN),
+};
+
+//USB USB_Vendor_SanDisk_Corp - 0781
+static const passthroughHackSetting usbHacks_0781_5575[] = {//Cruzer Glide
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 16),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+};
+static const passthroughHackSetting usbHacks_0781_5580[] = {//Extreme
+    //Leaving this as flash since it is a flash drive/thumb drive, but this is an odd one that seems to do SAT commands.
+    PT_HACK(passthroughType, ATA_PASSTHROUGH_SAT),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 15),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.reportAllOpCodes, true),
+    PT_HACK(scsiHacks.reportSingleOpCodes, true),
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.maxTransferLength, 1048576),
+    PT_HACK(ataPTHacks.returnResponseInfoSupported, true),
+    PT_HACK(ataPTHacks.returnResponseInfoNeedsTDIR, true),
+    PT_HACK(ataPTHacks.returnResponseIgnoreExtendBit, true),
+    PT_HACK(ataPTHacks.alwaysCheckConditionAvailable, true),
+    PT_HACK(ataPTHacks.alwaysUseDMAInsteadOfUDMA, true),
+    PT_HACK(ataPTHacks.maxTransferLength, 1048576),
+};
+static const passthroughHackSetting usbHacks_0781_5583[] = {//Ultra Fit
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 14),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.readWrite.rw12, true),
+    PT_HACK(scsiHacks.readWrite.rw16, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),
+};
+
+//USB USB_Vendor_Kingston - 13FE
+static const passthroughHackSetting usbHacks_13FE_3600[] = {//Patriot Memory PMA
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 4),
+    PT_HACK(scsiHacks.preSCSI2InqData, true),
+    //vendor ID is all spaces, so skipping it
+    PT_HACK(scsiHacks.scsiInq.productIDOffset, 16),
+    PT_HACK(scsiHacks.scsiInq.productIDLength, 16),
+    //Guessing that the "PMA" value is a revision number of some kind.
+    PT_HACK(scsiHacks.scsiInq.productRevOffset, 32),
+    PT_HACK(scsiHacks.scsiInq.productRevLength, 3),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.securityProtocolSupported, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+};
+
+//USB USB_Vendor_Phison - 0D7D
+static const passthroughHackSetting usbHacks_0D7D_1300[] = {//USB DISK 2.0
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 33),
+    PT_HACK(scsiHacks.preSCSI2InqData, true),
+    //vendor ID is all spaces, so skipping it
+    PT_HACK(scsiHacks.scsiInq.productIDOffset, 16),
+    PT_HACK(scsiHacks.scsiInq.productIDLength, 16),
+    //Guessing that the "PMA" value is a revision number of some kind.
+    PT_HACK(scsiHacks.scsiInq.productRevOffset, 32),
+    PT_HACK(scsiHacks.scsiInq.productRevLength, 3),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noVPDPages, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModeSubPages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 65536),
+};
+
+//USB USB_Vendor_Symwave - 1CA1
+static const passthroughHackSetting usbHacks_1CA1_18AE[] = {//rev 0852
+    //This is a USB to SAS adapter. Not everything works as it is targetted at read/write and other basic informatio only.
+    //If sent commands it doesn't understand, this struggles.
+    //Very basic information is set here in order to keep this simple. The main reason is because most capabilties will depend on the
+    //Attached SAS device more than the USB adapter itself.
+    //The exception to that rule is transfer size. Disabling ATA passthrough test also helps
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),//This disabled ATA passthrough which this devices doesn't support anyways
+    PT_HACK(scsiHacks.maxTransferLength, 1048576),
+    PT_HACK(testUnitReadyAfterAnyCommandFailure, true),//This may not actually help this device. This hack is usually used to clear error conditions by sending a well known, easy command to clear previous SAT translation issues, but in this case, this may not be helpful
+    PT_HACK(turfValue, 17),
+};
+
+//IEEE1394 IEEE1394_Vendor_Maxtor - 0010B9
+static const passthroughHackSetting ieee1394Hacks_0010B9_005000[] = {//5000DV
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    //PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 6),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    //PT_HACK(scsiHacks.maxTransferLength, 65536),//Unable to get a good test result on this, so this is currently commented out. - TJE
+};
+
+//IEEE1394 0x000BC2 - This vendor ID doesn't make sense for the product that was tested!!!
+static const passthroughHackSetting ieee1394Hacks_000BC2_000000[] = {//Seagate external drive with USB and 1394. USB mode has passthrough, but that doesn't work in 1394. Likely 2 different chips
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    //PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 5),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw6, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),//Unable to get a good test result on this, so this is currently commented out. - TJE
+};
+
+//IEEE1394 0x000500 - This vendor ID doesn't make sense for the product that was tested!!!
+static const passthroughHackSetting ieee1394Hacks_000500_000001[] = {//Seagate external drive with USB and 1394. USB mode has passthrough, but that doesn't work in 1394. Likely 2 different chips
+    PT_HACK(passthroughType, PASSTHROUGH_NONE),
+    //PT_HACK(testUnitReadyAfterAnyCommandFailure, true),
+    PT_HACK(turfValue, 4),
+    PT_HACK(scsiHacks.readWrite.available, true),
+    PT_HACK(scsiHacks.readWrite.rw10, true),
+    PT_HACK(scsiHacks.noLogPages, true),
+    PT_HACK(scsiHacks.noModePages, true),
+    PT_HACK(scsiHacks.noReportSupportedOperations, true),
+    PT_HACK(scsiHacks.maxTransferLength, 524288),//Unable to get a good test result on this, so this is currently commented out. - TJE
+};
+
+static const passthroughHacksRecord passthroughHacksTable[] = {
+        //USB_Vendor_Seagate_RSS - 0BC2
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x0888, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_0888) },//0BC2 VID
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x0500, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_0500) },//ST3750640A
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x0501, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_0501) },
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x0502, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_0502) },
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x0503, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_0503) },//Seagate External Drive
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x1000, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_1000) },//FreeAgentGoSmall
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2100, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2100) },//FreeAgent Go
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2101, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2101) },//FreeAgent Go
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2120, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2120) },//FreeAgent Go
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2300, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2300) },//Portable
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2320, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2320) },//Expansion
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2321, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2321) },//Expansion
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2322, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2322) },//Expansion (Xbox drive uses this chip)
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2330, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2330) },//Portable
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2332, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2332) },//Portable
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2400, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2400) },//Backup
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x2700, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2700) },//BlackArmorDAS25
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x3000, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_3000) },//???
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x3001, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2100) },//FreeAgent
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x3010, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_3010) },//FreeAgent Pro
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x3300, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_3300) },//Desktop
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x3320, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_3320) },//Expansion Desk
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x3330, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_3330) },//External
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x3332, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_3332) },//External
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x3340, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_3340) },//Expansion+ Desk
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5020, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5020) },//USB 2.0 Cable
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5021, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5021) },//FreeAgent GoFlex
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5030, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5030) },//???
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5031, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5031) },//Freeagent GoFlex. 
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5060, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5060) },//FreeAgent
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5070, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5070) },//FA GoFlex Desk
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5071, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5071) },//GoFlex Desk
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x50A5, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_50A5) },//GoFlex Desk
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x50A7, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_50A7) },//GoFlex Desk
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5130, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5130) },//GoFlex Cable
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x5170, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_5170) },//USB 3.0 Cable
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x6126, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_6126) },//D3 Station
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x617A, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_617A) },//GoFlex Slim Mac
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0x61B5, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_61B5) },//M3 Portable
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xA003, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_A003) },//GoFlex Slim
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xA013, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_A013) },//Backup+ RD
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xA014, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_A014) },//Slim BK
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xA0A4, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_A0A4) },//GoFlex Desk
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xA313, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_A313) },//Wireless
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xA314, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_A314) },//Wireless Plus
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB00, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_2320) },//Slim BK
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB01, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AB01) },//BUP Fast SSD
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB02, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AB02) },//Fast
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB10, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AB10) },//BUP Slim SL
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB20, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AB20) },//Backup+ SL
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB21, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AB21) },//Backup+ BL
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB24, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AB24) },//BUP Slim
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB2A, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AB2A) },//Fast HDD
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAB31, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AB31) },//Backup+  Desk
+        { ADAPTER_INFO_USB, USB_Vendor_Seagate_RSS, 0xAA17, PT_HACKS_ANY_REVISION, NVME_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0BC2_AA17) },//FireCuda Gaming SSD
+        //USB_Vendor_LaCie - 059F
+        { ADAPTER_INFO_USB, USB_Vendor_LaCie, 0x1064, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_059F_1064) },//RuggedKey
+        { ADAPTER_INFO_USB, USB_Vendor_LaCie, 0x1065, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_059F_1065) },
+        { ADAPTER_INFO_USB, USB_Vendor_LaCie, 0x1072, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_059F_1072) },//Fuel
+        { ADAPTER_INFO_USB, USB_Vendor_LaCie, 0x1091, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_059F_1091) },//Rugged USB-C
+        { ADAPTER_INFO_USB, USB_Vendor_LaCie, 0x10CD, PT_HACKS_ANY_REVISION, NVME_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_059F_10CD) },//Rugged SSD
+        //USB_Vendor_Maxtor - 0D49
+        { ADAPTER_INFO_USB, USB_Vendor_Maxtor, 0x5020, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0D49_5020) },//5000DV
+        { ADAPTER_INFO_USB, USB_Vendor_Maxtor, 0x7310, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0D49_7310) },//OneTouch
+        { ADAPTER_INFO_USB, USB_Vendor_Maxtor, 0x7410, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0D49_7410) },//Basics Desktop
+        { ADAPTER_INFO_USB, USB_Vendor_Maxtor, 0x7550, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0D49_7550) },//BlackArmor
+        //USB_Vendor_Oxford - 0928
+        { ADAPTER_INFO_USB, USB_Vendor_Oxford, 0x0008, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_0928_0008) },//NOTE: This should be retested for full hacks to improve performance.
+        //USB_Vendor_4G_Systems_GmbH - 1955
+        { ADAPTER_INFO_USB, USB_Vendor_4G_Systems_GmbH, 0x0102, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_1955_0102) },//Generic Frys
+        //USB_Vendor_Initio - 13FD
+        { ADAPTER_INFO_USB, USB_Vendor_Initio, 0x1340, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_13FD_1340) },//Seen in ThermalTake BlackX
+        { ADAPTER_INFO_USB, USB_Vendor_Initio, 0x1340, 0x0202, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_13FD_1340_Rev0202) },//revision 0202h only
+        //USB_Vendor_ASMedia - 174C
+        { ADAPTER_INFO_USB, USB_Vendor_ASMedia, 0x2362, PT_HACKS_ANY_REVISION, NVME_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_174C_2362) },//USB to NVMe adapter
+        { ADAPTER_INFO_USB, USB_Vendor_ASMedia, 0x5106, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_174C_5106) },//Seen in ThermalTake BlackX 5G
+        { ADAPTER_INFO_USB, USB_Vendor_ASMedia, 0x55AA, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_174C_55AA) },//ASMT 2105
+        //USB_Vendor_JMicron - 152D
+        { ADAPTER_INFO_USB, USB_Vendor_JMicron, 0x0551, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_152D_0551) },//USB 3.0 to SATA/PATA adapter
+        { ADAPTER_INFO_USB, USB_Vendor_JMicron, 0x0562, PT_HACKS_ANY_REVISION, NVME_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_152D_0562) },//USB to NVMe adapter
+        { ADAPTER_INFO_USB, USB_Vendor_JMicron, 0x0583, PT_HACKS_ANY_REVISION, NVME_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_152D_0562) },//USB to NVMe adapter
+        { ADAPTER_INFO_USB, USB_Vendor_JMicron, 0x2338, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_152D_2338) },//Sabrent USB 2.0 to SATA/PATA. Only tested SATA.
+        { ADAPTER_INFO_USB, USB_Vendor_JMicron, 0x2339, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_152D_2339) },//MiniD2 - NOTE: This has custom firmware. If other things use this chip, additional product verification will be necessary.
+        //USB_Vendor_Samsung - 04E8
+        { ADAPTER_INFO_USB, USB_Vendor_Samsung, 0x1F05, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_04E8_1F05) },//S2 Portable
+        { ADAPTER_INFO_USB, USB_Vendor_Samsung, 0x5F12, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_04E8_5F12) },//Story Station
+        { ADAPTER_INFO_USB, USB_Vendor_Samsung, 0x6093, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_04E8_6093) },//S2 portable 3
+        { ADAPTER_INFO_USB, USB_Vendor_Samsung, 0x61C3, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_04E8_61C3) },//P3 Portable
+        //USB_Vendor_Silicon_Motion - 090C
+        { ADAPTER_INFO_USB, USB_Vendor_Silicon_Motion, 0x1000, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_090C_1000) },//USB DISK - Rev1100
+        //USB_Vendor_ChipsBank - 1E3D
+        { ADAPTER_INFO_USB, USB_Vendor_ChipsBank, 0x2093, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_1E3D_2093) },//v3.1.0.4
+        //USB_Vendor_Alcor_Micro_Corp - 058F
+        { ADAPTER_INFO_USB, USB_Vendor_Alcor_Micro_Corp, 0x6387, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_058F_6387) },//flash drive - Rev 0103
+        { ADAPTER_INFO_USB, USB_Vendor_Alcor_Micro_Corp, 0x1234, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_058F_6387) },//flash drive
+        { ADAPTER_INFO_USB, USB_Vendor_Alcor_Micro_Corp, 0x9380, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_058F_6387) },//flash drive
+        { ADAPTER_INFO_USB, USB_Vendor_Alcor_Micro_Corp, 0x9381, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_058F_6387) },//flash drive
+        { ADAPTER_INFO_USB, USB_Vendor_Alcor_Micro_Corp, 0x9382, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_058F_6387) },//flash drive
+        //USB_Vendor_Integrated_Techonology_Express_Inc - 048D
+        { ADAPTER_INFO_USB, USB_Vendor_Integrated_Techonology_Express_Inc, 0x1172, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_048D_1172) },//flash drive
+        { ADAPTER_INFO_USB, USB_Vendor_Integrated_Techonology_Express_Inc, 0x1176, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_048D_1172) },//flash drive - rev 0100
+        //USB_Vendor_SanDisk_Corp - 0781
+        { ADAPTER_INFO_USB, USB_Vendor_SanDisk_Corp, 0x5575, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_0781_5575) },//Cruzer Glide
+        { ADAPTER_INFO_USB, USB_Vendor_SanDisk_Corp, 0x5580, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_0781_5580) },//Extreme
+        { ADAPTER_INFO_USB, USB_Vendor_SanDisk_Corp, 0x5583, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_0781_5583) },//Ultra Fit
+        //USB_Vendor_Kingston - 13FE
+        { ADAPTER_INFO_USB, USB_Vendor_Kingston, 0x3600, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_13FE_3600) },//Patriot Memory PMA
+        //USB_Vendor_Phison - 0D7D
+        { ADAPTER_INFO_USB, USB_Vendor_Phison, 0x1300, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_SSM_FLASH, PT_HACKS_SETTINGS(usbHacks_0D7D_1300) },//USB DISK 2.0
+        //USB_Vendor_Symwave - 1CA1
+        { ADAPTER_INFO_USB, USB_Vendor_Symwave, 0x18AE, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(usbHacks_1CA1_18AE) },//rev 0852
+        //IEEE1394_Vendor_Maxtor - 0010B9
+        { ADAPTER_INFO_IEEE1394, IEEE1394_Vendor_Maxtor, 0x005000, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(ieee1394Hacks_0010B9_005000) },//5000DV
+        //0x000BC2 - This vendor ID doesn't make sense for the product that was tested!!!
+        { ADAPTER_INFO_IEEE1394, 0x000BC2, 0x000000, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(ieee1394Hacks_000BC2_000000) },//Seagate external drive with USB and 1394. USB mode has passthrough, but that doesn't work in 1394. Likely 2 different chips
+        //0x000500 - This vendor ID doesn't make sense for the product that was tested!!!
+        { ADAPTER_INFO_IEEE1394, 0x000500, 0x000001, PT_HACKS_ANY_REVISION, UNKNOWN_DRIVE, MEDIA_UNKNOWN, PT_HACKS_SETTINGS(ieee1394Hacks_000500_000001) },//Seagate external drive with USB and 1394. USB mode has passthrough, but that doesn't work in 1394. Likely 2 different chips
+};
+
+#define PASSTHROUGH_HACKS_TABLE_COUNT (sizeof(passthroughHacksTable) / sizeof(passthroughHacksTable[0]))
+#define PASSTHROUGH_HACKS_HASH_SLOTS 256 //must be a power of 2 and at least twice the table size to keep probes short
+static uint16_t passthroughHacksHashIndex[PASSTHROUGH_HACKS_HASH_SLOTS];//0 = empty slot, otherwise index into passthroughHacksTable + 1
+#if defined (UEFI_C_SOURCE)
+static bool passthroughHacksHashIndexBuilt = false;//UEFI applications are single threaded
+#elif defined (_WIN32)
+static volatile LONG passthroughHacksHashIndexState = 0;//0 = not built, 1 = being built, 2 = built
+#else
+static pthread_once_t passthroughHacksHashIndexOnce = PTHREAD_ONCE_INIT;
+#endif
+
+static uint32_t passthrough_Hacks_Hash(eAdapterInfoType infoType, uint32_t vendorID, uint32_t productID, uint32_t revision)
+{
+    //FNV-1a over the key
+    uint32_t key[4] = { (uint32_t)infoType, vendorID, productID, revision };
+    uint32_t hash = UINT32_C(2166136261);
+    for (uint8_t keyIter = 0; keyIter < 4; ++keyIter)
+    {
+        for (uint8_t byteIter = 0; byteIter < 4; ++byteIter)
+        {
+            hash ^= (key[keyIter] >> (byteIter * 8)) & 0xFF;
+            hash *= UINT32_C(16777619);
+        }
+    }
+    return hash;
+}
+
+static void build_Passthrough_Hacks_Hash_Index(void)
+{
+    memset(passthroughHacksHashIndex, 0, sizeof(passthroughHacksHashIndex));
+    for (uint16_t tableIter = 0; tableIter < PASSTHROUGH_HACKS_TABLE_COUNT; ++tableIter)
+    {
+        const passthroughHacksRecord *record = &passthroughHacksTable[tableIter];
+        uint32_t slot = passthrough_Hacks_Hash(record->infoType, record->vendorID, record->productID, record->revision) & (PASSTHROUGH_HACKS_HASH_SLOTS - 1);
+        while (passthroughHacksHashIndex[slot] != 0)
+        {
+            slot = (slot + 1) & (PASSTHROUGH_HACKS_HASH_SLOTS - 1);
+        }
+        passthroughHacksHashIndex[slot] = tableIter + 1;
+    }
+}
+
+//Builds the hash index exactly once, even when devices are being discovered on several threads at the same time.
+static void init_Passthrough_Hacks_Hash_Index(void)
+{
+#if defined (UEFI_C_SOURCE)
+    if (!passthroughHacksHashIndexBuilt)
+    {
+        build_Passthrough_Hacks_Hash_Index();
+        passthroughHacksHashIndexBuilt = true;
+    }
+#elif defined (_WIN32)
+    //Interlocked functions instead of InitOnceExecuteOnce so that this still works before Vista
+    if (InterlockedCompareExchange(&passthroughHacksHashIndexState, 1, 0) == 0)
+    {
+        build_Passthrough_Hacks_Hash_Index();
+        InterlockedExchange(&passthroughHacksHashIndexState, 2);
+    }
+    else
+    {
+        while (InterlockedCompareExchange(&passthroughHacksHashIndexState, 2, 2) != 2)
+        {
+            Sleep(0);
+        }
+    }
+#else
+    pthread_once(&passthroughHacksHashIndexOnce, build_Passthrough_Hacks_Hash_Index);
+#endif
+}
+
+static const passthroughHacksRecord* find_Passthrough_Hacks_Record(eAdapterInfoType infoType, uint32_t vendorID, uint32_t productID, uint32_t revision)
+{
+    uint32_t slot = 0;
+    init_Passthrough_Hacks_Hash_Index();
+    slot = passthrough_Hacks_Hash(infoType, vendorID, productID, revision) & (PASSTHROUGH_HACKS_HASH_SLOTS - 1);
+    while (passthroughHacksHashIndex[slot] != 0)
+    {
+        const passthroughHacksRecord *record = &passthroughHacksTable[passthroughHacksHashIndex[slot] - 1];
+        if (record->infoType == infoType && record->vendorID == vendorID && record->productID == productID && record->revision == revision)
+        {
+            return record;
+        }
+        slot = (slot + 1) & (PASSTHROUGH_HACKS_HASH_SLOTS - 1);
+    }
+    return NULL;
+}
+
+//Overlay records loaded from a file. These are applied after the built in table so that they can add to or change its settings.
+#define PASSTHROUGH_HACKS_OVERLAY_MAX_SETTINGS 64
+typedef struct _passthroughHacksOverlayRecord
+{
+    passthroughHacksRecord record;
+    passthroughHackSetting settings[PASSTHROUGH_HACKS_OVERLAY_MAX_SETTINGS];
+}passthroughHacksOverlayRecord;
+
+static passthroughHacksOverlayRecord *passthroughHacksOverlay = NULL;
+static uint32_t passthroughHacksOverlayCount = 0;
+//The overlay can be replaced while devices are being discovered on other threads, so it is only read or swapped while holding this lock.
+#if defined (UEFI_C_SOURCE)
+//UEFI applications are single threaded, so no lock is needed
+#elif defined (_WIN32)
+static volatile LONG passthroughHacksOverlayLock = 0;//0 = unlocked, 1 = locked
+#else
+static pthread_mutex_t passthroughHacksOverlayLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static void lock_Passthrough_Hacks_Overlay(void)
+{
+#if defined (UEFI_C_SOURCE)
+    return;
+#elif defined (_WIN32)
+    //Interlocked functions instead of SRW locks so that this still works before Vista. This is only held long enough to copy a few settings.
+    while (InterlockedCompareExchange(&passthroughHacksOverlayLock, 1, 0) != 0)
+    {
+        Sleep(0);
+    }
+#else
+    pthread_mutex_lock(&passthroughHacksOverlayLock);
+#endif
+}
+
+static void unlock_Passthrough_Hacks_Overlay(void)
+{
+#if defined (UEFI_C_SOURCE)
+    return;
+#elif defined (_WIN32)
+    InterlockedExchange(&passthroughHacksOverlayLock, 0);
+#else
+    pthread_mutex_unlock(&passthroughHacksOverlayLock);
+#endif
+}
+
+typedef struct _passthroughHackField
+{
+    const char *name;
+    uint16_t offset;
+    uint8_t size;
+}passthroughHackField;
+
+#define PT_HACK_FIELD(field) { #field, (uint16_t)offsetof(passthroughHacks, field), (uint8_t)PT_HACK_FIELD_SIZE(field) }
+
+static const passthroughHackField passthroughHackFields[] = {
+    PT_HACK_FIELD(passthroughType),
+    PT_HACK_FIELD(testUnitReadyAfterAnyCommandFailure),
+    PT_HACK_FIELD(turfValue),
+    PT_HACK_FIELD(scsiHacks.unitSNAvailable),
+    PT_HACK_FIELD(scsiHacks.readWrite.available),
+    PT_HACK_FIELD(scsiHacks.readWrite.rw6),
+    PT_HACK_FIELD(scsiHacks.readWrite.rw10),
+    PT_HACK_FIELD(scsiHacks.readWrite.rw12),
+    PT_HACK_FIELD(scsiHacks.readWrite.rw16),
+    PT_HACK_FIELD(scsiHacks.noVPDPages),
+    PT_HACK_FIELD(scsiHacks.noModePages),
+    PT_HACK_FIELD(scsiHacks.noLogPages),
+    PT_HACK_FIELD(scsiHacks.noLogSubPages),
+    PT_HACK_FIELD(scsiHacks.mode6bytes),
+    PT_HACK_FIELD(scsiHacks.noModeSubPages),
+    PT_HACK_FIELD(scsiHacks.noReportSupportedOperations),
+    PT_HACK_FIELD(scsiHacks.reportSingleOpCodes),
+    PT_HACK_FIELD(scsiHacks.reportAllOpCodes),
+    PT_HACK_FIELD(scsiHacks.securityProtocolSupported),
+    PT_HACK_FIELD(scsiHacks.securityProtocolWithInc512),
+    PT_HACK_FIELD(scsiHacks.preSCSI2InqData),
+    PT_HACK_FIELD(scsiHacks.scsiInq.productIDOffset),
+    PT_HACK_FIELD(scsiHacks.scsiInq.productIDLength),
+    PT_HACK_FIELD(scsiHacks.scsiInq.productRevOffset),
+    PT_HACK_FIELD(scsiHacks.scsiInq.productRevLength),
+    PT_HACK_FIELD(scsiHacks.scsiInq.vendorIDOffset),
+    PT_HACK_FIELD(scsiHacks.scsiInq.vendorIDLength),
+    PT_HACK_FIELD(scsiHacks.scsiInq.serialNumberOffset),
+    PT_HACK_FIELD(scsiHacks.scsiInq.serialNumberLength),
+    PT_HACK_FIELD(scsiHacks.maxTransferLength),
+    PT_HACK_FIELD(ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly),
+    PT_HACK_FIELD(ataPTHacks.a1NeverSupported),
+    PT_HACK_FIELD(ataPTHacks.a1ExtCommandWhenPossible),
+    PT_HACK_FIELD(ataPTHacks.returnResponseInfoSupported),
+    PT_HACK_FIELD(ataPTHacks.returnResponseInfoNeedsTDIR),
+    PT_HACK_FIELD(ataPTHacks.returnResponseIgnoreExtendBit),
+    PT_HACK_FIELD(ataPTHacks.alwaysUseTPSIUForSATPassthrough),
+    PT_HACK_FIELD(ataPTHacks.alwaysCheckConditionAvailable),
+    PT_HACK_FIELD(ataPTHacks.alwaysUseDMAInsteadOfUDMA),
+    PT_HACK_FIELD(ataPTHacks.dmaNotSupported),
+    PT_HACK_FIELD(ataPTHacks.partialRTFRs),
+    PT_HACK_FIELD(ataPTHacks.noRTFRsPossible),
+    PT_HACK_FIELD(ataPTHacks.multiSectorPIOWithMultipleMode),
+    PT_HACK_FIELD(ataPTHacks.singleSectorPIOOnly),
+    PT_HACK_FIELD(ataPTHacks.ata28BitOnly),
+    PT_HACK_FIELD(ataPTHacks.noMultipleModeCommands),
+    PT_HACK_FIELD(ataPTHacks.maxTransferLength),
+    PT_HACK_FIELD(nvmePTHacks.limitedPassthroughCapabilities),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.identifyGeneric),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.identifyController),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.identifyNamespace),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.getLogPage),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.format),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.getFeatures),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.firmwareDownload),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.firmwareCommit),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.vendorUnique),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.deviceSelfTest),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.sanitize),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.namespaceManagement),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.namespaceAttachment),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.setFeatures),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.miSend),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.miReceive),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.securitySend),
+    PT_HACK_FIELD(nvmePTHacks.limitedCommandsSupported.securityReceive),
+    PT_HACK_FIELD(nvmePTHacks.ioErrorsFailSCSIStatus),
+    PT_HACK_FIELD(nvmePTHacks.maxTransferLength),
+};
+
+#define PASSTHROUGH_HACK_FIELD_COUNT (sizeof(passthroughHackFields) / sizeof(passthroughHackFields[0]))
+
+//parses "field=value". Value may be true, false, or a number (0x prefix for hex). driveType and mediaType set the eDriveType and eMediaType values of the record.
+static bool parse_Passthrough_Hack_Setting(char *token, passthroughHacksOverlayRecord *overlayRecord)
+{
+    char *equals = strchr(token, '=');
+    char *valueString = NULL;
+    char *end = NULL;
+    uint32_t value = 0;
+    if (!equals)
+    {
+        return false;
+    }
+    *equals = '\0';
+    valueString = equals + 1;
+    if (strcmp(valueString, "true") == 0)
+    {
+        value = 1;
+    }
+    else if (strcmp(valueString, "false") == 0)
+    {
+        value = 0;
+    }
+    else
+    {
+        value = (uint32_t)strtoul(valueString, &end, 0);
+        if (end == valueString || *end != '\0')
+        {
+            return false;
+        }
+    }
+    if (strcmp(token, "driveType") == 0)
+    {
+        overlayRecord->record.driveType = (eDriveType)value;
+        return true;
+    }
+    if (strcmp(token, "mediaType") == 0)
+    {
+        overlayRecord->record.mediaType = (eMediaType)value;
+        return true;
+    }
+    if (overlayRecord->record.settingCount >= PASSTHROUGH_HACKS_OVERLAY_MAX_SETTINGS)
+    {
+        return false;
+    }
+    for (uint16_t fieldIter = 0; fieldIter < PASSTHROUGH_HACK_FIELD_COUNT; ++fieldIter)
+    {
+        if (strcmp(token, passthroughHackFields[fieldIter].name) == 0)
+        {
+            passthroughHackSetting *setting = &overlayRecord->settings[overlayRecord->record.settingCount];
+            setting->offset = passthroughHackFields[fieldIter].offset;
+            setting->size = passthroughHackFields[fieldIter].size;
+            setting->value = value;
+            ++overlayRecord->record.settingCount;
+            return true;
+        }
+    }
+    return false;
+}
+
+//Line format: infoType(eAdapterInfoType, decimal) vendorID(hex) productID(hex) revision(hex or * for all) field=value field=value ...
+static bool parse_Passthrough_Hacks_Overlay_Line(char *line, passthroughHacksOverlayRecord *overlayRecord)
+{
+    char *token = NULL;
+    char *end = NULL;
+    memset(overlayRecord, 0, sizeof(passthroughHacksOverlayRecord));
+    overlayRecord->record.driveType = UNKNOWN_DRIVE;
+    overlayRecord->record.mediaType = MEDIA_UNKNOWN;
+    token = strtok(line, " \t\r\n");
+    if (!token)
+    {
+        return false;
+    }
+    overlayRecord->record.infoType = (eAdapterInfoType)strtoul(token, &end, 10);
+    if ((token = strtok(NULL, " \t\r\n")) == NULL)
+    {
+        return false;
+    }
+    overlayRecord->record.vendorID = (uint32_t)strtoul(token, &end, 16);
+    if ((token = strtok(NULL, " \t\r\n")) == NULL)
+    {
+        return false;
+    }
+    overlayRecord->record.productID = (uint32_t)strtoul(token, &end, 16);
+    if ((token = strtok(NULL, " \t\r\n")) == NULL)
+    {
+        return false;
+    }
+    if (strcmp(token, "*") == 0)
+    {
+        overlayRecord->record.revision = PT_HACKS_ANY_REVISION;
+    }
+    else
+    {
+        overlayRecord->record.revision = (uint32_t)strtoul(token, &end, 16);
+    }
+    while ((token = strtok(NULL, " \t\r\n")) != NULL)
+    {
+        if (!parse_Passthrough_Hack_Setting(token, overlayRecord))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-            case 0xAA17://FireCuda Gaming SSD
-                //NOTE: Recommend a retest for this device to double check the hacks. Most are setup based on other ASMedia bridge chip tests.
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = NVME_PASSTHROUGH_ASMEDIA;
-                device->drive_info.drive_type = NVME_DRIVE;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.ataPTHacks.a1NeverSupported = true;//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                break;
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_LaCie://059F
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x1064://RuggedKey
-                //One other note: For some reason, the MaxLBA that is reported is DIFFERENT between read capacty 10 and read capacity 16
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                break;
-            case 0x1065://
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x1072://Fuel
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0x1091://Rugged USB-C
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 11;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0x10CD://Rugged SSD
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = NVME_PASSTHROUGH_JMICRON;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.ataPTHacks.a1NeverSupported = true;//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
-                device->drive_info.drive_type = NVME_DRIVE;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolWithInc512 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //NOTE: Add max passthrough transfer length hack set to 65536
-                break;
-            default:
-                break;
-            }
-        case USB_Vendor_Maxtor://0D49
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x5020://5000DV
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.preSCSI2InqData = true;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.vendorIDOffset = 8;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.vendorIDLength = 8;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDOffset = 16;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDLength = 16;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productRevOffset = 32;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productRevLength = 3;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                //device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536; //Unable to get a good test result on this, so this is currently commented out. - TJE
-                break;
-            case 0x7310://OneTouch
-                //rev 0122h
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 10;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x7410://Basics Desktop
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            case 0x7550://BlackArmor
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_Oxford://0928
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x0008://NOTE: This should be retested for full hacks to improve performance.
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                passthroughHacksSet = true;
-                break;
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_4G_Systems_GmbH://1955
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x0102://Generic Frys
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 17;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_Initio://13FD
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x1340://Seen in ThermalTake BlackX
-                //Results are for revision 0210h
-                //NOTE: This device doesn't allow for large LBAs, so it is limited on the SCSI read/write commands to a 32bit LBA.
-                //      Using a 12TB drive, this reports 483.72GB....so may need an additional hack at some point to force passthrough read/write commands on a device like this.
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 12;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                if (device->drive_info.adapter_info.revision == 0x0202)
-                {
-                    device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                    device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                    device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                }
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.dmaNotSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_ASMedia://174C
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x2362://USB to NVMe adapter
-                //Tested 3 adapters. All report the exact same USB level information, but do in fact work differently (slightly)
-                //The  difference seems to be only noticable in Inquiry Data
-                //1. PID: "ASM236X NVME" could use mode sense 6 and read 6 commands
-                //2. PID: "USB3.1 TO NVME" could NOT do these commands. So setting the lowest common set of rules.
-                //If there are other ASMedia chips that vary in capabilities, then may need to adjust what is done in here, or add a hack to check INQ data to finish setting up remaining hacks
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = NVME_PASSTHROUGH_ASMEDIA_BASIC;
-                device->drive_info.drive_type = NVME_DRIVE;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.ataPTHacks.a1NeverSupported = true;//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
-                //device->drive_info.drive_type = NVME_DRIVE; //Uncomment this line when it is possible to issue NVMe passthrough commands behind ASMedia chips.
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                device->drive_info.passThroughHacks.nvmePTHacks.limitedPassthroughCapabilities = true;
-                device->drive_info.passThroughHacks.nvmePTHacks.limitedCommandsSupported.getLogPage = true;
-                device->drive_info.passThroughHacks.nvmePTHacks.limitedCommandsSupported.identifyGeneric = true;
-                break;
-            case 0x5106://Seen in ThermalTake BlackX 5G
-                //Results are for revision 0001h
-                //Does not seem to handle drives with a 4k logical sector size well.
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 122880;//This seems to vary with each time this device is tested
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 36864;//This seems to vary with each time this device is tested.
-                break;
-            case 0x55AA://ASMT 2105
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_JMicron://152D
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x0551://USB 3.0 to SATA/PATA adapter
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 512512;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;
-                break;
-            case 0x0562://USB to NVMe adapter
-                //Rev 204h
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = NVME_PASSTHROUGH_JMICRON;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.ataPTHacks.a1NeverSupported = true;//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
-                device->drive_info.drive_type = NVME_DRIVE;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolWithInc512 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //NOTE: Add max passthrough transfer length hack set to 65536
-                break;
-            case 0x0583://USB to NVMe adapter
-                //Rev 205h
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = NVME_PASSTHROUGH_JMICRON;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.ataPTHacks.a1NeverSupported = true;//set this so in the case an ATA passthrough command is attempted, it won't try this opcode since it can cause performance problems or crash the bridge
-                device->drive_info.drive_type = NVME_DRIVE;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolWithInc512 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                //NOTE: Add max passthrough transfer length hack set to 65536
-                break;
-            case 0x2338://Sabrent USB 2.0 to SATA/PATA. Only tested SATA.
-                //NOTE: Some versions of this chip will NOT do SAT passthrough.
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 122880;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 122880;
-                break;
-            case 0x2339://MiniD2 - NOTE: This has custom firmware. If other things use this chip, additional product verification will be necessary.
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 13;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;
-                break;
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_Samsung://04E8
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x1F05://S2 Portable
-                //based on revision 0000h
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseIgnoreExtendBit = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 65536;//Bytes
-                //set SCSI hacks
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;//bytes
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = false;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.preSCSI2InqData = true;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.vendorIDOffset = 8;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.vendorIDLength = 8;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDOffset = 16;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDLength = 11;
-                //Serial number is not reported in inquiry data or any other known location
-                break;
-            case 0x5F12://Story Station
-                passthroughHacksSet = true;
-                //hacks based on revision 1302h. Not sure if revision level filter is needed right now
-                //Set ATA passthrough hacks
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseIgnoreExtendBit = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 130560;//Bytes
-                //set SCSI hacks
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;//bytes
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolWithInc512 = true;
-                break;
-            case 0x6093://S2 portable 3
-                passthroughHacksSet = true;
-                //based on revision 0100h
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 524288;//Bytes
-                //set SCSI hacks
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;//bytes
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                break;
-            case 0x61C3://P3 Portable
-                passthroughHacksSet = true;
-                //based on revision 0E00h
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                //device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseIgnoreExtendBit = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 523776;//Bytes
-                //set SCSI hacks
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;//bytes
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 16;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = false;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                break;
-            default: //unknown
-                break;
-            }
-            break;
-        case USB_Vendor_Silicon_Motion://090C
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x1000://USB DISK - Rev1100
-                //Don't set a passthrough type! This is a USB flash memory, that responds to one of the legacy command requests and it will break it!
-                device->drive_info.media_type = MEDIA_SSM_FLASH;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                passthroughHacksSet = true;
-                //this device also supports the device identification VPD page even though the list of pages doesn't work.
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                break;
-            default:
-                break;
-            }
-            break;
-        case USB_Vendor_ChipsBank://1E3D
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x2093://v3.1.0.4
-                device->drive_info.media_type = MEDIA_SSM_FLASH;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 10;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolWithInc512 = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                break;
-            default:
-                break;
-            }
-            break;
-        case USB_Vendor_Alcor_Micro_Corp://058F
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x6387://flash drive - Rev 0103
-            case 0x1234://flash drive
-            case 0x9380://flash drive
-            case 0x9381://flash drive
-            case 0x9382://flash drive
-                device->drive_info.media_type = MEDIA_SSM_FLASH;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_UNKNOWN;
-                passthroughHacksSet = true;
-                break;
-            default:
-                break;
-            }
-            break;
-        case USB_Vendor_Integrated_Techonology_Express_Inc://048D
-            switch (device->drive_info.adapter_info.productID)
+int set_Passthrough_Hacks_Overlay_File(const char *path)
+{
+    int ret = SUCCESS;
+    FILE *overlayFile = NULL;
+    char line[1024] = { 0 };
+    passthroughHacksOverlayRecord *overlay = NULL;
+    uint32_t overlayCount = 0;
+    passthroughHacksOverlayRecord *oldOverlay = NULL;
+    if (path)
+    {
+        overlayFile = fopen(path, "r");
+        if (!overlayFile)
+        {
+            return FILE_OPEN_ERROR;
+        }
+        //load into a new array so that lookups on other threads keep using the old overlay until it is swapped below
+        while (fgets(line, sizeof(line), overlayFile))
+        {
+            passthroughHacksOverlayRecord *temp = NULL;
+            size_t firstChar = strspn(line, " \t");
+            if (line[firstChar] == '#' || line[firstChar] == '\n' || line[firstChar] == '\r' || line[firstChar] == '\0')
             {
-            case 0x1172://flash drive
-            case 0x1176://flash drive - rev 0100
-                device->drive_info.media_type = MEDIA_SSM_FLASH;
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_UNKNOWN;
-                passthroughHacksSet = true;
-                break;
-            default:
-                break;
+                continue;
             }
-            break;
-        case USB_Vendor_SanDisk_Corp://0781
-            switch (device->drive_info.adapter_info.productID)
+            temp = (passthroughHacksOverlayRecord*)realloc(overlay, (overlayCount + 1) * sizeof(passthroughHacksOverlayRecord));
+            if (!temp)
             {
-            case 0x5575://Cruzer Glide
-                passthroughHacksSet = true;
-                device->drive_info.media_type = MEDIA_SSM_FLASH;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 16;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                break;
-            case 0x5580://Extreme
-                passthroughHacksSet = true;
-                device->drive_info.media_type = MEDIA_SSM_FLASH;//Leaving this as flash since it is a flash drive/thumb drive, but this is an odd one that seems to do SAT commands.
-                device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_SAT;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 15;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 1048576;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoNeedsTDIR = true;
-                device->drive_info.passThroughHacks.ataPTHacks.returnResponseIgnoreExtendBit = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable = true;
-                device->drive_info.passThroughHacks.ataPTHacks.alwaysUseDMAInsteadOfUDMA = true;
-                device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength = 1048576;
-                break;
-            case 0x5583://Ultra Fit
-                passthroughHacksSet = true;
-                device->drive_info.media_type = MEDIA_SSM_FLASH;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 14;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288;
-                break;
-            default:
+                ret = MEMORY_FAILURE;
                 break;
             }
-            break;
-        case USB_Vendor_Kingston://13FE
-            switch (device->drive_info.adapter_info.productID)
+            overlay = temp;
+            if (parse_Passthrough_Hacks_Overlay_Line(line, &overlay[overlayCount]))
             {
-            case 0x3600://Patriot Memory PMA
-                passthroughHacksSet = true;
-                device->drive_info.media_type = MEDIA_SSM_FLASH;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 4;
-                device->drive_info.passThroughHacks.scsiHacks.preSCSI2InqData = true;
-                //vendor ID is all spaces, so skipping it
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDOffset = 16;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDLength = 16;
-                //Guessing that the "PMA" value is a revision number of some kind. 
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productRevOffset = 32;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productRevLength = 3;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                break;
-            default:
-                break;
+                ++overlayCount;
             }
-            break;
-        case USB_Vendor_Phison://0D7D
-            switch (device->drive_info.adapter_info.productID)
+            else
             {
-            case 0x1300://USB DISK 2.0
-                passthroughHacksSet = true;
-                device->drive_info.media_type = MEDIA_SSM_FLASH;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 33;
-                device->drive_info.passThroughHacks.scsiHacks.preSCSI2InqData = true;
-                //vendor ID is all spaces, so skipping it
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDOffset = 16;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productIDLength = 16;
-                //Guessing that the "PMA" value is a revision number of some kind. 
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productRevOffset = 32;
-                device->drive_info.passThroughHacks.scsiHacks.scsiInq.productRevLength = 3;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536;
-                break;
-            default:
-                break;
+                ret = FAILURE;//skip this line, but keep loading the rest of the file
             }
+        }
+        fclose(overlayFile);
+        //point each record at its own settings now that the array will no longer move
+        for (uint32_t overlayIter = 0; overlayIter < overlayCount; ++overlayIter)
+        {
+            overlay[overlayIter].record.settings = overlay[overlayIter].settings;
+        }
+    }
+    lock_Passthrough_Hacks_Overlay();
+    //swap in the new overlay and keep the old one to free after unlocking
+    oldOverlay = passthroughHacksOverlay;
+    passthroughHacksOverlay = overlay;
+    passthroughHacksOverlayCount = overlayCount;
+    unlock_Passthrough_Hacks_Overlay();
+    safe_Free(oldOverlay);
+    return ret;
+}
+
+//Must be called while holding the overlay lock. The returned record is only valid until it is released.
+static const passthroughHacksRecord* find_Passthrough_Hacks_Overlay_Record(eAdapterInfoType infoType, uint32_t vendorID, uint32_t productID, uint32_t revision)
+{
+    //overlays are expected to be a handful of lines, so a linear search is fine here
+    for (uint32_t overlayIter = 0; overlayIter < passthroughHacksOverlayCount; ++overlayIter)
+    {
+        const passthroughHacksRecord *record = &passthroughHacksOverlay[overlayIter].record;
+        if (record->infoType == infoType && record->vendorID == vendorID && record->productID == productID && record->revision == revision)
+        {
+            return record;
+        }
+    }
+    return NULL;
+}
+
+static void apply_Passthrough_Hacks_Record(const passthroughHacksRecord *record, passthroughHacks *hacks, eDriveType *driveType, eMediaType *mediaType)
+{
+    uint8_t *hackBytes = (uint8_t*)hacks;
+    for (uint16_t settingIter = 0; settingIter < record->settingCount; ++settingIter)
+    {
+        const passthroughHackSetting *setting = &record->settings[settingIter];
+        switch (setting->size)
+        {
+        case 1:
+            hackBytes[setting->offset] = (uint8_t)setting->value;
             break;
-        case USB_Vendor_Symwave://1CA1
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x18AE://rev 0852
-                //This is a USB to SAS adapter. Not everything works as it is targetted at read/write and other basic informatio only.
-                //If sent commands it doesn't understand, this struggles.
-                //Very basic information is set here in order to keep this simple. The main reason is because most capabilties will depend on the
-                //Attached SAS device more than the USB adapter itself.
-                //The exception to that rule is transfer size. Disabling ATA passthrough test also helps
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;//This disabled ATA passthrough which this devices doesn't support anyways
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 1048576;
-                device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;//This may not actually help this device. This hack is usually used to clear error conditions by sending a well known, easy command to clear previous SAT translation issues, but in this case, this may not be helpful
-                device->drive_info.passThroughHacks.turfValue = 17;
-                break;
-            default:
-                break;
-            }
+        case 2:
+        {
+            uint16_t value16 = (uint16_t)setting->value;
+            memcpy(&hackBytes[setting->offset], &value16, sizeof(uint16_t));
+        }
+        break;
+        case 4:
+            memcpy(&hackBytes[setting->offset], &setting->value, sizeof(uint32_t));
             break;
-        default: //unknown
+        default:
             break;
         }
     }
+    if (record->driveType != UNKNOWN_DRIVE && driveType)
+    {
+        *driveType = record->driveType;
+    }
+    if (record->mediaType != MEDIA_UNKNOWN && mediaType)
+    {
+        *mediaType = record->mediaType;
+    }
+}
+
+bool get_Passthrough_Hacks_By_ID(eAdapterInfoType infoType, uint32_t vendorID, uint32_t productID, uint32_t revision, passthroughHacks *hacks, eDriveType *driveType, eMediaType *mediaType)
+{
+    bool passthroughHacksSet = false;
+    const passthroughHacksRecord *records[4] = { NULL };
+    if (!hacks)
+    {
+        return false;
+    }
+    //all revisions first, then the specific revision, built in table first, then the overlay
+    //the overlay records point into the overlay array, so hold the lock until they have been applied
+    lock_Passthrough_Hacks_Overlay();
+    records[0] = find_Passthrough_Hacks_Record(infoType, vendorID, productID, PT_HACKS_ANY_REVISION);
+    records[2] = find_Passthrough_Hacks_Overlay_Record(infoType, vendorID, productID, PT_HACKS_ANY_REVISION);
+    if (revision != PT_HACKS_ANY_REVISION)
+    {
+        records[1] = find_Passthrough_Hacks_Record(infoType, vendorID, productID, revision);
+        records[3] = find_Passthrough_Hacks_Overlay_Record(infoType, vendorID, productID, revision);
+    }
+    for (uint8_t recordIter = 0; recordIter < 4; ++recordIter)
+    {
+        if (records[recordIter])
+        {
+            apply_Passthrough_Hacks_Record(records[recordIter], hacks, driveType, mediaType);
+            passthroughHacksSet = true;
+        }
+    }
+    unlock_Passthrough_Hacks_Overlay();
+    return passthroughHacksSet;
+}
+
+bool set_USB_Passthrough_Hacks_By_PID_and_VID(tDevice *device)
+{
+    bool passthroughHacksSet = false;
+    //only change the ATA Passthrough type for USB (for legacy USB bridges)
+    if (device->drive_info.interface_type == USB_INTERFACE)
+    {
+        //Most USB bridges are SAT so they'll probably not be in the table and issue an identify command for SAT
+        passthroughHacksSet = get_Passthrough_Hacks_By_ID(ADAPTER_INFO_USB, device->drive_info.adapter_info.vendorID, device->drive_info.adapter_info.productID, device->drive_info.adapter_info.revision, &device->drive_info.passThroughHacks, &device->drive_info.drive_type, &device->drive_info.media_type);
+    }
     return passthroughHacksSet;
 }
 
-//Vendor ID's, or OUI's, can be found here: https://regauth.standards.ieee.org/standards-ra-web/pub/view.html#registries
 bool set_IEEE1394_Passthrough_Hacks_By_PID_and_VID(tDevice *device)
 {
     bool passthroughHacksSet = false;
@@ -3983,83 +4930,7 @@ bool set_IEEE1394_Passthrough_Hacks_By_PID_and_VID(tDevice *device)
     {
         //It is unknown if any IEEE 1394 devices support any ATA passthrough.
         //Some devices had both USB and IEEE1394 interfaces and one may have passthrough while the other does not. They may even be different.
-        switch (device->drive_info.adapter_info.vendorID)
-        {
-        case IEEE1394_Vendor_Maxtor://0010B9
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x005000://5000DV
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                //device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 6;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                //device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 65536; //Unable to get a good test result on this, so this is currently commented out. - TJE
-                break;
-            default:
-                break;
-            }
-            break;
-        case IEEE1394_Vendor_Seagate://002037
-            switch (device->drive_info.adapter_info.productID)
-            {
-            default:
-                break;
-            }
-            break;
-        case IEEE1394_Vendor_Quantum://00E09E
-            switch (device->drive_info.adapter_info.productID)
-            {
-            default:
-                break;
-            }
-            break;
-        case 0x000BC2://This vendor ID doesn't make sense for the product that was tested!!!
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x000000://Seagate external drive with USB and 1394. USB mode has passthrough, but that doesn't work in 1394. Likely 2 different chips
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                //device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 5;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6 = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288; //Unable to get a good test result on this, so this is currently commented out. - TJE
-                break;
-            default:
-                break;
-            }
-            break;
-        case 0x000500://This vendor ID doesn't make sense for the product that was tested!!!
-            switch (device->drive_info.adapter_info.productID)
-            {
-            case 0x000001://Seagate external drive with USB and 1394. USB mode has passthrough, but that doesn't work in 1394. Likely 2 different chips
-                passthroughHacksSet = true;
-                device->drive_info.passThroughHacks.passthroughType = PASSTHROUGH_NONE;
-                //device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
-                device->drive_info.passThroughHacks.turfValue = 4;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
-                device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10 = true;
-                device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-                device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
-                device->drive_info.passThroughHacks.scsiHacks.maxTransferLength = 524288; //Unable to get a good test result on this, so this is currently commented out. - TJE
-                break;
-            default:
-                break;
-            }
-            break;
-        default:
-            break;
-        }
+        passthroughHacksSet = get_Passthrough_Hacks_By_ID(ADAPTER_INFO_IEEE1394, device->drive_info.adapter_info.vendorID, device->drive_info.adapter_info.productID, device->drive_info.adapter_info.revision, &device->drive_info.passThroughHacks, &device->drive_info.drive_type, &device->drive_info.media_type);
     }
     return passthroughHacksSet;
 }
@@ -4091,3 +4962,193 @@ bool setup_Passthrough_Hacks_By_ID(tDevice *device)
     }
     return success;
 }
+
+//Device string normalization. ATA, NVMe and SCSI identification strings are fixed length, space padded, and may need a word swap (ATA) or have non-printable characters (old SCSI products).
+//16 bytes at a time are swapped, scrubbed and checked for whitespace with SSE2 (every x86-64 CPU has it) or NEON. Anything left over goes through the byte loop.
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DEVICE_STRING_SSE2
+#elif defined (__ARM_NEON) || defined (__ARM_NEON__)
+#include <arm_neon.h>
+#define DEVICE_STRING_NEON
+#endif
+#if defined (_MSC_VER) && (defined (DEVICE_STRING_SSE2) || defined (DEVICE_STRING_NEON))
+#include <intrin.h>
+#endif
+
+static bool is_Device_String_Space(uint8_t character)
+{
+    //same characters as isspace in the C locale
+    return character == ' ' || (character >= '\t' && character <= '\r');
+}
+
+#if defined (DEVICE_STRING_SSE2) || defined (DEVICE_STRING_NEON)
+//bit/nibble scan helpers for the masks built below. mask must not be zero.
+static uint32_t device_String_Lowest_Bit(uint64_t mask)
+{
+#if defined (_MSC_VER)
+    unsigned long index = 0;
+#if defined (DEVICE_STRING_SSE2)
+    _BitScanForward(&index, (unsigned long)mask);//SSE2 masks are only 16 bits
+#else
+    _BitScanForward64(&index, mask);
+#endif
+    return (uint32_t)index;
+#else
+    return (uint32_t)__builtin_ctzll(mask);
+#endif
+}
+
+static uint32_t device_String_Highest_Bit(uint64_t mask)
+{
+#if defined (_MSC_VER)
+    unsigned long index = 0;
+#if defined (DEVICE_STRING_SSE2)
+    _BitScanReverse(&index, (unsigned long)mask);
+#else
+    _BitScanReverse64(&index, mask);
+#endif
+    return (uint32_t)index;
+#else
+    return (uint32_t)(63 - __builtin_clzll(mask));
+#endif
+}
+
+//Swaps/scrubs 16 bytes from source into destination. Returns a mask of the NUL bytes and sets nonSpaceMask.
+//SSE2 masks have 1 bit per byte, NEON masks have 4 bits per byte, so callers divide bit positions by DEVICE_STRING_MASK_BITS.
+#if defined (DEVICE_STRING_SSE2)
+#define DEVICE_STRING_MASK_BITS 1
+#define DEVICE_STRING_MASK_ALL UINT64_C(0xFFFF)
+static uint64_t normalize_Device_String_16(char *destination, const uint8_t *source, bool wordSwap, bool scrub, uint64_t *nonSpaceMask)
+{
+    __m128i chars = _mm_loadu_si128((const __m128i*)source);
+    __m128i spaces = _mm_set1_epi8(' ');
+    uint64_t nulMask = 0;
+    if (wordSwap)
+    {
+        chars = _mm_or_si128(_mm_slli_epi16(chars, 8), _mm_srli_epi16(chars, 8));
+    }
+    nulMask = (uint64_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_setzero_si128()));
+    if (scrub)
+    {
+        //signed compares: less than 0x20 also catches 0x80-0xFF. 0x7F is the only other non-printable.
+        __m128i nonPrintable = _mm_or_si128(_mm_cmplt_epi8(chars, spaces), _mm_cmpeq_epi8(chars, _mm_set1_epi8(0x7F)));
+        nonPrintable = _mm_andnot_si128(_mm_cmpeq_epi8(chars, _mm_setzero_si128()), nonPrintable);
+        chars = _mm_or_si128(_mm_andnot_si128(nonPrintable, chars), _mm_and_si128(nonPrintable, spaces));
+    }
+    _mm_storeu_si128((__m128i*)destination, chars);
+    *nonSpaceMask = ~(uint64_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, spaces), _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('\r' + 1))))) & DEVICE_STRING_MASK_ALL;
+    return nulMask;
+}
+#else
+#define DEVICE_STRING_MASK_BITS 4
+#define DEVICE_STRING_MASK_ALL UINT64_MAX
+static uint64_t neon_Device_String_Mask(uint8x16_t lanes)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4)), 0);
+}
+
+static uint64_t normalize_Device_String_16(char *destination, const uint8_t *source, bool wordSwap, bool scrub, uint64_t *nonSpaceMask)
+{
+    uint8x16_t chars = vld1q_u8(source);
+    uint8x16_t spaces = vdupq_n_u8(' ');
+    uint64_t nulMask = 0;
+    if (wordSwap)
+    {
+        chars = vrev16q_u8(chars);
+    }
+    nulMask = neon_Device_String_Mask(vceqq_u8(chars, vdupq_n_u8(0)));
+    if (scrub)
+    {
+        uint8x16_t nonPrintable = vorrq_u8(vcltq_u8(chars, spaces), vcgtq_u8(chars, vdupq_n_u8(0x7E)));
+        nonPrintable = vbicq_u8(nonPrintable, vceqq_u8(chars, vdupq_n_u8(0)));
+        chars = vbslq_u8(nonPrintable, spaces, chars);
+    }
+    vst1q_u8((uint8_t*)destination, chars);
+    *nonSpaceMask = ~neon_Device_String_Mask(vorrq_u8(vceqq_u8(chars, spaces), vandq_u8(vcgeq_u8(chars, vdupq_n_u8('\t')), vcleq_u8(chars, vdupq_n_u8('\r')))));
+    return nulMask;
+}
+#endif
+#endif //SIMD
+
+void copy_Device_String(char *destination, size_t destinationSize, const uint8_t *source, size_t sourceLength, eDeviceStringOptions options)
+{
+    bool wordSwap = (options & DEVICE_STRING_WORD_SWAP) != 0;
+    bool scrub = (options & DEVICE_STRING_SCRUB_NON_PRINTABLE) != 0;
+    size_t copyLength = 0;
+    size_t offset = 0;
+    size_t firstNonSpace = SIZE_MAX;
+    size_t lastNonSpace = 0;
+    bool foundNul = false;
+    if (!destination || destinationSize == 0)
+    {
+        return;
+    }
+    if (!source)
+    {
+        memset(destination, 0, destinationSize);
+        return;
+    }
+    copyLength = M_Min(sourceLength, destinationSize - 1);
+#if defined (DEVICE_STRING_SSE2) || defined (DEVICE_STRING_NEON)
+    //a swapped chunk needs both bytes of its last word from the source
+    while (offset + 16 <= copyLength && (!wordSwap || offset + 16 <= sourceLength))
+    {
+        uint64_t nonSpaceMask = 0;
+        uint64_t nulMask = normalize_Device_String_16(&destination[offset], &source[offset], wordSwap, scrub, &nonSpaceMask);
+        size_t validBytes = 16;
+        if (nulMask)
+        {
+            validBytes = device_String_Lowest_Bit(nulMask) / DEVICE_STRING_MASK_BITS;
+            foundNul = true;
+            //ignore anything at or after the NUL
+            nonSpaceMask &= validBytes == 0 ? 0 : (DEVICE_STRING_MASK_ALL >> ((16 - validBytes) * DEVICE_STRING_MASK_BITS));
+        }
+        if (nonSpaceMask)
+        {
+            if (firstNonSpace == SIZE_MAX)
+            {
+                firstNonSpace = offset + device_String_Lowest_Bit(nonSpaceMask) / DEVICE_STRING_MASK_BITS;
+            }
+            lastNonSpace = offset + device_String_Highest_Bit(nonSpaceMask) / DEVICE_STRING_MASK_BITS;
+        }
+        offset += validBytes;
+        if (foundNul)
+        {
+            break;
+        }
+    }
+#endif
+    for (; !foundNul && offset < copyLength; ++offset)
+    {
+        size_t sourceOffset = wordSwap && (offset ^ 1) < sourceLength ? (offset ^ 1) : offset;
+        uint8_t character = source[sourceOffset];
+        if (character == 0)
+        {
+            break;
+        }
+        if (scrub && (character < 0x20 || character > 0x7E))
+        {
+            character = ' ';
+        }
+        destination[offset] = (char)character;
+        if (!is_Device_String_Space(character))
+        {
+            if (firstNonSpace == SIZE_MAX)
+            {
+                firstNonSpace = offset;
+            }
+            lastNonSpace = offset;
+        }
+    }
+    if (firstNonSpace == SIZE_MAX)
+    {
+        memset(destination, 0, destinationSize);
+        return;
+    }
+    if (firstNonSpace > 0)
+    {
+        memmove(destination, &destination[firstNonSpace], lastNonSpace - firstNonSpace + 1);
+    }
+    memset(&destination[lastNonSpace - firstNonSpace + 1], 0, destinationSize - (lastNonSpace - firstNonSpace + 1));
+}
@@ -19,6 +19,7 @@
 
 #include "jmicron_nvme_helper.h"
 #include "scsi_helper_func.h" //for ability to send a SCSI IO
+#include "nvme_helper_func.h"
 
 int build_JM_NVMe_CDB_And_Payload(uint8_t * cdb, eDataTransferDirection *cdbDataDirection, uint8_t * dataPtr, uint32_t dataSize, eJMNvmeProtocol jmProtocol, eJMNvmeVendorControl jmCtrl, nvmeCmdCtx * nvmCmd)
 {
@@ -111,7 +112,7 @@ int build_JM_NVMe_CDB_And_Payload(uint8_t * cdb, eDataTransferDirection *cdbData
                     else
                     {
                         //CDW0 is bytes 11:8
-                        cdb[8] = nvmCmd->cmd.nvmCmd.opcode;
+                        dataPtr[8] = nvmCmd->cmd.nvmCmd.opcode;
                         //TODO: bytes 9, 10, 11 hold fused bits, prp vs sgl, and CID. None of these are filled in for now...-TJE
                         //NSID is 15:12
                         dataPtr[12] = M_Byte0(nvmCmd->cmd.nvmCmd.nsid);
@@ -299,7 +300,10 @@ int send_JM_NVMe_Cmd(nvmeCmdCtx * nvmCmd)
     //Need to request the response information from the command.
     //TODO: There may be some sense data outputs where the return response info won't work or isn't necessary, but they don't seem documented today. Most likely only for illegal requests.
     bool senseDataIsAllWeGot = true;
-    if (sendRet != COMMAND_TIMEOUT)
+    //Good SCSI status does not normally mean the NVMe command passed, so the response info is always read unless this bridge is known to fail the SCSI status on NVMe I/O errors.
+    //Reads, writes and other I/O only return a status, so for those bridges skipping the response info command saves a round trip on every I/O.
+    bool skipResponseInfo = nvmCmd->device->drive_info.passThroughHacks.nvmePTHacks.ioErrorsFailSCSIStatus && sendRet == SUCCESS && !nvme_Command_Uses_Completion_DW0(nvmCmd);
+    if (sendRet != COMMAND_TIMEOUT && !skipResponseInfo)
     {
         //3. build CDB for response info
         //send CDB for response info
@@ -812,6 +812,23 @@ int nvme_Get_Log_Page(tDevice *device, nvmeGetLogPageCmdOpts * getLogPageCmdOpts
     return ret;
 }
 
+int nvme_Get_Log_Page_Cached(tDevice *device, nvmeGetLogPageCmdOpts * getLogPageCmdOpts)
+{
+    int ret = SUCCESS;
+    //only whole logs read from the start are cached. Offsets, log specific fields and retained events go to the device.
+    bool cacheable = getLogPageCmdOpts->offset == 0 && getLogPageCmdOpts->lsp == 0 && getLogPageCmdOpts->rae == 0 && getLogPageCmdOpts->metadataLen == 0;
+    if (cacheable && get_Device_Log_Cache_Entry(device, DEVICE_LOG_CACHE_NVME_LOG, getLogPageCmdOpts->lid, getLogPageCmdOpts->nsid, getLogPageCmdOpts->addr, getLogPageCmdOpts->dataLen))
+    {
+        return SUCCESS;
+    }
+    ret = nvme_Get_Log_Page(device, getLogPageCmdOpts);
+    if (cacheable && ret == SUCCESS)
+    {
+        set_Device_Log_Cache_Entry(device, DEVICE_LOG_CACHE_NVME_LOG, getLogPageCmdOpts->lid, getLogPageCmdOpts->nsid, getLogPageCmdOpts->addr, getLogPageCmdOpts->dataLen);
+    }
+    return ret;
+}
+
 
 int nvme_Format(tDevice *device, nvmeFormatCmdOpts * formatCmdOpts)
 {
@@ -39,6 +39,9 @@ int fill_In_NVMe_Device_Info(tDevice *device)
     uint16_t *fillSectorAlignment = &device->drive_info.sectorAlignment;
     uint64_t *fillMaxLba = &device->drive_info.deviceMaxLba;
 
+    //identify data is being reread, so anything the software translator derived from it must be rebuilt
+    free_Memoized_Supported_Op_Codes(device);
+
     //If not an NVMe interface, such as USB, then we need to store things differently
     if (device->drive_info.interface_type != NVME_INTERFACE)
     {
@@ -72,15 +75,9 @@ printf("fill NVMe info ret = %d\n", ret);
         device->drive_info.media_type = MEDIA_NVM;//This will bite us someday when someone decided to put non-ssds on NVMe interface.
 
         //Set the other device fields we need.
-        memcpy(fillSerialNumber,ctrlData->sn,SERIAL_NUM_LEN);
-        fillSerialNumber[20] = '\0';
-        remove_Leading_And_Trailing_Whitespace(fillSerialNumber);
-        memcpy(fillFWRev, ctrlData->fr,8); //8 is the NVMe spec length of this
-        fillFWRev[8] = '\0';
-        remove_Leading_And_Trailing_Whitespace(fillFWRev);
-        memcpy(fillModelNumber, ctrlData->mn,MODEL_NUM_LEN); 
-        fillModelNumber[40] = '\0';
-        remove_Leading_And_Trailing_Whitespace(fillModelNumber);
+        copy_Device_String(fillSerialNumber, SERIAL_NUM_LEN + 1, (const uint8_t*)ctrlData->sn, SERIAL_NUM_LEN, DEVICE_STRING_NO_OPTIONS);
+        copy_Device_String(fillFWRev, FW_REV_LEN + 1, (const uint8_t*)ctrlData->fr, 8, DEVICE_STRING_NO_OPTIONS); //8 is the NVMe spec length of this
+        copy_Device_String(fillModelNumber, MODEL_NUM_LEN + 1, (const uint8_t*)ctrlData->mn, MODEL_NUM_LEN, DEVICE_STRING_NO_OPTIONS);
         //Do not overwrite this with non-NVMe interfaces. This is used by USB to figure out and track bridge chip specific things that are stored in this location
         if (device->drive_info.interface_type == NVME_INTERFACE && !device->drive_info.adapter_info.vendorIDValid)
         {
@@ -228,6 +225,27 @@ void get_NVMe_Status_Fields_From_DWord(uint32_t nvmeStatusDWord, bool *doNotRetr
     }
 }
 
+bool nvme_Command_Uses_Completion_DW0(const nvmeCmdCtx * cmdCtx)
+{
+    if (cmdCtx->commandType == NVM_CMD)
+    {
+        switch (cmdCtx->cmd.nvmCmd.opcode)
+        {
+        case NVME_CMD_FLUSH:
+        case NVME_CMD_WRITE:
+        case NVME_CMD_READ:
+        case NVME_CMD_WRITE_UNCOR:
+        case NVME_CMD_COMPARE:
+        case NVME_CMD_WRITE_ZEROS:
+        case NVME_CMD_DATA_SET_MANAGEMENT:
+            return false;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
 //TODO: this function needs to be expanded as new status codes are added
 //TODO: use doNotRetry and more bits in some useful way?
 int check_NVMe_Status(uint32_t nvmeStatusDWord)
@@ -19,6 +19,7 @@
 #include "sat_helper_func.h"
 #include "ata_helper_func.h"
 #include "platform_helper.h"
+#include "cmds.h"
 
 //the define below is to switch between different levels of SAT spec support. It is recommended that this is set to the highest version available
 //valid values are 1 - 4
@@ -150,7 +151,27 @@ int get_RTFRs_From_Descriptor_Format_Sense_Data(uint8_t *ptrSenseData, uint32_t
     return ret;
 }
 
-int get_RTFRs_From_Fixed_Format_Sense_Data(tDevice *device, uint8_t *ptrSenseData, uint32_t senseDataSize, ataReturnTFRs *rtfr)
+//Decides whether additional commands may be sent to retrieve RTFRs that did not come back with the command
+static bool sat_RTFR_Follow_Up_Allowed(eATAPassthroughRTFRPolicy rtfrPolicy, bool commandError)
+{
+    switch (rtfrPolicy)
+    {
+    case ATA_RTFR_POLICY_NEVER:
+        return false;
+    case ATA_RTFR_POLICY_ON_ERROR:
+        return commandError;
+    case ATA_RTFR_POLICY_ALWAYS:
+    default:
+        return true;
+    }
+}
+
+static bool sat_RTFR_Status_Error(ataReturnTFRs *rtfr)
+{
+    return (rtfr->status & (ATA_STATUS_BIT_ERROR | ATA_STATUS_BIT_DEVICE_FAULT)) != 0;
+}
+
+static int parse_RTFRs_From_Fixed_Format_Sense_Data(tDevice *device, uint8_t *ptrSenseData, uint32_t senseDataSize, ataReturnTFRs *rtfr, eATAPassthroughRTFRPolicy rtfrPolicy)
 {
     int ret = FAILURE;
     uint8_t senseDataFormat = ptrSenseData[0] & 0x7F;
@@ -242,7 +263,12 @@ int get_RTFRs_From_Fixed_Format_Sense_Data(tDevice *device, uint8_t *ptrSenseDat
             }
         }
 
-        if (unknownExtRegisters)
+        if (unknownExtRegisters && !sat_RTFR_Follow_Up_Allowed(rtfrPolicy, sat_RTFR_Status_Error(rtfr)))
+        {
+            //caller does not need the complete registers for this command, so skip the extra commands
+            ret = WARN_INCOMPLETE_RFTRS;
+        }
+        else if (unknownExtRegisters)
         {
             ret = WARN_INCOMPLETE_RFTRS;//assume that the following code to get the ext registers fails for some reason or another.
             //ok, so we don't know all of the ext registers, so now we need to check if there is a log page available, then try a follow up command (if supported), then try request sense for descriptor format data
@@ -285,6 +311,11 @@ int get_RTFRs_From_Fixed_Format_Sense_Data(tDevice *device, uint8_t *ptrSenseDat
     return ret;
 }
 
+int get_RTFRs_From_Fixed_Format_Sense_Data(tDevice *device, uint8_t *ptrSenseData, uint32_t senseDataSize, ataReturnTFRs *rtfr)
+{
+    return parse_RTFRs_From_Fixed_Format_Sense_Data(device, ptrSenseData, senseDataSize, rtfr, ATA_RTFR_POLICY_ALWAYS);
+}
+
 bool get_Return_TFRs_From_Sense_Data(tDevice *device, ataPassthroughCommand *ataCommandOptions, int ioRet, int senseRet)
 {
     bool gotRTFRsFromSenseData = false;
@@ -305,9 +336,10 @@ bool get_Return_TFRs_From_Sense_Data(tDevice *device, ataPassthroughCommand *ata
         //Parse the fixed format sense data if it says there is ATA Pass through Information available.
         else if ((senseDataFormat == SCSI_SENSE_CUR_INFO_FIXED || senseDataFormat == SCSI_SENSE_DEFER_ERR_FIXED) && ataCommandOptions->ptrSenseData[12] == 0x00 && ataCommandOptions->ptrSenseData[13] == 0x1D)
         {
-            ret = get_RTFRs_From_Fixed_Format_Sense_Data(device, ataCommandOptions->ptrSenseData, ataCommandOptions->senseDataSize, &ataCommandOptions->rtfr);
+            ret = parse_RTFRs_From_Fixed_Format_Sense_Data(device, ataCommandOptions->ptrSenseData, ataCommandOptions->senseDataSize, &ataCommandOptions->rtfr, ataCommandOptions->rtfrPolicy);
             //if the RTFRs are incomplete, but the device supports the request command, send the request command to get the RTFRs
-            if ((ret == WARN_INCOMPLETE_RFTRS || ret == FAILURE) && device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported)
+            if ((ret == WARN_INCOMPLETE_RFTRS || ret == FAILURE) && device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported
+                && sat_RTFR_Follow_Up_Allowed(ataCommandOptions->rtfrPolicy, ret == FAILURE || sat_RTFR_Status_Error(&ataCommandOptions->rtfr)))
             {
                 ret = request_Return_TFRs_From_Device(device, &ataCommandOptions->rtfr);
                 if (ret == SUCCESS)
@@ -320,7 +352,8 @@ bool get_Return_TFRs_From_Sense_Data(tDevice *device, ataPassthroughCommand *ata
                 gotRTFRsFromSenseData = true;
             }
         }
-        else if (device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported)
+        else if (device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported
+            && sat_RTFR_Follow_Up_Allowed(ataCommandOptions->rtfrPolicy, ioRet != SUCCESS || senseRet != SUCCESS))
         {
             ret = request_Return_TFRs_From_Device(device, &ataCommandOptions->rtfr);
             if (ret == SUCCESS)
@@ -776,211 +809,181 @@ int request_Return_TFRs_From_Device(tDevice *device, ataReturnTFRs *rtfr)
     return rtfrRet;
 }
 
-int build_SAT_CDB(tDevice *device, uint8_t **satCDB, eCDBLen *cdbLen, ataPassthroughCommand *ataCommandOptions)
+#define SAT_TEMPLATE_INVALID UINT8_C(0xFF)
+
+//Protocol field (bits 4:1) for each ATA protocol. Columns are data-in, data-out, and any other direction.
+static const uint8_t satProtocolFieldTemplate[ATA_PROTOCOL_MAX_VALUE][3] = {
+    /*ATA_PROTOCOL_UNKNOWN*/    { SAT_TEMPLATE_INVALID, SAT_TEMPLATE_INVALID, SAT_TEMPLATE_INVALID },
+    /*ATA_PROTOCOL_PIO*/        { SAT_PIO_DATA_IN, SAT_PIO_DATA_OUT, SAT_TEMPLATE_INVALID },
+    /*ATA_PROTOCOL_DMA*/        { SAT_DMA, SAT_DMA, SAT_DMA },
+    /*ATA_PROTOCOL_NO_DATA*/    { SAT_NON_DATA, SAT_NON_DATA, SAT_NON_DATA },
+    /*ATA_PROTOCOL_DEV_RESET*/  { SAT_NODATA_RESET, SAT_NODATA_RESET, SAT_NODATA_RESET },
+    /*ATA_PROTOCOL_DEV_DIAG*/   { SAT_EXE_DEV_DIAG, SAT_EXE_DEV_DIAG, SAT_EXE_DEV_DIAG },
+    /*ATA_PROTOCOL_DMA_QUE*/    { SAT_DMA_QUEUED, SAT_DMA_QUEUED, SAT_DMA_QUEUED },
+    /*ATA_PROTOCOL_PACKET*/     { SAT_TEMPLATE_INVALID, SAT_TEMPLATE_INVALID, SAT_TEMPLATE_INVALID },
+    /*ATA_PROTOCOL_PACKET_DMA*/ { SAT_TEMPLATE_INVALID, SAT_TEMPLATE_INVALID, SAT_TEMPLATE_INVALID },
+    /*ATA_PROTOCOL_DMA_FPDMA*/  { SAT_FPDMA, SAT_FPDMA, SAT_FPDMA },
+    /*ATA_PROTOCOL_SOFT_RESET*/ { SAT_ATA_SW_RESET, SAT_ATA_SW_RESET, SAT_ATA_SW_RESET },
+    /*ATA_PROTOCOL_HARD_RESET*/ { SAT_ATA_HW_RESET, SAT_ATA_HW_RESET, SAT_ATA_HW_RESET },
+    /*ATA_PROTOCOL_RET_INFO*/   { SAT_RET_RESP_INFO, SAT_RET_RESP_INFO, SAT_RET_RESP_INFO },
+    /*ATA_PROTOCOL_UDMA*/       { SAT_UDMA_DATA_IN, SAT_UDMA_DATA_OUT, SAT_TEMPLATE_INVALID },
+};
+
+//T_LENGTH, BYTE_BLOCK, T_TYPE and T_DIR bits, indexed by [eATAPassthroughLength][eATAPassthroughTransferBlocks][data-in, anything else]
+#define SAT_XFER_BITS(tLen, blockBits) { (tLen) | (blockBits) | SAT_T_DIR_DATA_IN, (tLen) | (blockBits) | SAT_T_DIR_DATA_OUT }
+#define SAT_XFER_BITS_FOR_LENGTH(tLen) { \
+        SAT_XFER_BITS(tLen, SAT_BYTE_BLOCK_BIT_SET), /*ATA_PT_512B_BLOCKS*/ \
+        SAT_XFER_BITS(tLen, SAT_BYTE_BLOCK_BIT_SET | SAT_T_TYPE_BIT_SET), /*ATA_PT_LOGICAL_SECTOR_SIZE*/ \
+        SAT_XFER_BITS(tLen, 0), /*ATA_PT_NUMBER_OF_BYTES*/ \
+        SAT_XFER_BITS(tLen, 0) /*ATA_PT_NO_DATA_TRANSFER*/ \
+    }
+static const uint8_t satTransferBitsTemplate[ATA_PT_LEN_TPSIU + 1][ATA_PT_NO_DATA_TRANSFER + 1][2] = {
+    /*ATA_PT_LEN_NO_DATA*/ { { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 } },
+    /*ATA_PT_LEN_FEATURES_REGISTER*/ SAT_XFER_BITS_FOR_LENGTH(SAT_T_LEN_XFER_FET),
+    /*ATA_PT_LEN_SECTOR_COUNT*/ SAT_XFER_BITS_FOR_LENGTH(SAT_T_LEN_XFER_SEC_CNT),
+    /*ATA_PT_LEN_TPSIU*/ SAT_XFER_BITS_FOR_LENGTH(SAT_T_LEN_XFER_TPSIU),
+};
+
+typedef enum _eSATCDBTemplate
+{
+    SAT_CDB_TEMPLATE_12,
+    SAT_CDB_TEMPLATE_16,
+    SAT_CDB_TEMPLATE_16_EXT,
+    SAT_CDB_TEMPLATE_32,
+    SAT_CDB_TEMPLATE_32_EXT,
+    SAT_CDB_TEMPLATE_COUNT
+}eSATCDBTemplate;
+
+typedef struct _satCDBTemplate
+{
+    eCDBLen cdbLength;
+    uint8_t protocolOffset;
+    uint8_t transferBitsOffset;
+    uint8_t cdb[CDB_LEN_32];
+}satCDBTemplate;
+
+//Everything in the CDB that does not come from the taskfile. The extend bit shares the byte with the protocol field.
+static const satCDBTemplate satCDBTemplates[SAT_CDB_TEMPLATE_COUNT] = {
+    /*SAT_CDB_TEMPLATE_12*/ { CDB_LEN_12, SAT_PROTOCOL_OFFSET, SAT_TRANSFER_BITS_OFFSET, { ATA_PASS_THROUGH_12 } },
+    /*SAT_CDB_TEMPLATE_16*/ { CDB_LEN_16, SAT_PROTOCOL_OFFSET, SAT_TRANSFER_BITS_OFFSET, { ATA_PASS_THROUGH_16 } },
+    /*SAT_CDB_TEMPLATE_16_EXT*/ { CDB_LEN_16, SAT_PROTOCOL_OFFSET, SAT_TRANSFER_BITS_OFFSET, { ATA_PASS_THROUGH_16, SAT_EXTEND_BIT_SET } },
+    //variable length CDB: additional length 18h, service action 1FF0h
+    /*SAT_CDB_TEMPLATE_32*/ { CDB_LEN_32, 10, 11, { 0x7F, 0, RESERVED, RESERVED, RESERVED, RESERVED, RESERVED, 0x18, 0x1F, 0xF0 } },
+    /*SAT_CDB_TEMPLATE_32_EXT*/ { CDB_LEN_32, 10, 11, { 0x7F, 0, RESERVED, RESERVED, RESERVED, RESERVED, RESERVED, 0x18, 0x1F, 0xF0, SAT_EXTEND_BIT_SET } },
+};
+
+static uint8_t sat_Template_Direction_Index(eDataTransferDirection dataDirection)
+{
+    switch (dataDirection)
+    {
+    case XFER_DATA_IN:
+        return 0;
+    case XFER_DATA_OUT:
+        return 1;
+    default:
+        return 2;
+    }
+}
+
+int fill_SAT_CDB(tDevice *device, uint8_t *satCDB, eCDBLen *cdbLen, ataPassthroughCommand *ataCommandOptions)
 {
     int ret = SUCCESS;
-    uint8_t protocolOffset = SAT_PROTOCOL_OFFSET;
-    uint8_t transferBitsOffset = SAT_TRANSFER_BITS_OFFSET;
+    eSATCDBTemplate cdbTemplate = SAT_CDB_TEMPLATE_COUNT;
+    bool extendedCommand = ataCommandOptions->commandType == ATA_CMD_TYPE_EXTENDED_TASKFILE || ataCommandOptions->commandType == ATA_CMD_TYPE_COMPLETE_TASKFILE;
+    bool extRegistersSet = ataCommandOptions->tfr.SectorCount48 || ataCommandOptions->tfr.LbaLow48
+        || ataCommandOptions->tfr.LbaMid48 || ataCommandOptions->tfr.LbaHi48
+        || ataCommandOptions->tfr.Feature48;
+    bool auxOrICCSet = ataCommandOptions->tfr.aux1 || ataCommandOptions->tfr.aux2 || ataCommandOptions->tfr.aux3
+        || ataCommandOptions->tfr.aux4 || ataCommandOptions->tfr.icc;
+    if (!satCDB || !cdbLen)
+    {
+        return BAD_PARAMETER;
+    }
     if (device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough)
     {
         //override whatever came in here so that commands go through successfully....mostly for USB
         ataCommandOptions->ataCommandLengthLocation = ATA_PT_LEN_TPSIU;
     }
-    if (ataCommandOptions->forceCDBSize > 0)
+    //This force is rarely useful other than troubleshooting devices or support for certain features of a given translator.
+    switch (ataCommandOptions->forceCDBSize)
     {
-        //before proceeding to allocate memory, need to place some checks on some commands or things won't work exactly right. 
-        //This force is rarely useful other than troubleshooting devices or support for certain features of a given translator.
-        switch (ataCommandOptions->forceCDBSize)
+    case 12:
+        //if any ext registers are set, then the command cannot be issued.
+        if (extRegistersSet || auxOrICCSet)
         {
-        case 12:
-            //if any ext registers are set, then the command cannot be issued.
-            if (ataCommandOptions->tfr.SectorCount48 || ataCommandOptions->tfr.LbaLow48
-                || ataCommandOptions->tfr.LbaMid48 || ataCommandOptions->tfr.LbaHi48
-                || ataCommandOptions->tfr.Feature48 || ataCommandOptions->tfr.aux1
-                || ataCommandOptions->tfr.aux2 || ataCommandOptions->tfr.aux3
-                || ataCommandOptions->tfr.aux4 || ataCommandOptions->tfr.icc)
-            {
-                return BAD_PARAMETER;
-            }
-            else
-            {
-                *satCDB = (uint8_t*)calloc_aligned(ataCommandOptions->forceCDBSize, sizeof(uint8_t), device->os_info.minimumAlignment);
-                if (!*satCDB)
-                {
-                    return MEMORY_FAILURE;
-                }
-                *cdbLen = ataCommandOptions->forceCDBSize;
-                //set the OP Code
-                (*satCDB)[OPERATION_CODE] = ATA_PASS_THROUGH_12;
-            }
-            break;
-        case 16:
-            //If aux or ICC are set with this force flag, then it needs to be rejected since it is not possible to issue in 16B CDBs
-            if (ataCommandOptions->tfr.aux1 || ataCommandOptions->tfr.aux2 || ataCommandOptions->tfr.aux3
-                || ataCommandOptions->tfr.aux4 || ataCommandOptions->tfr.icc)
-            {
-                return BAD_PARAMETER;
-            }
-            else
-            {
-                *satCDB = (uint8_t*)calloc_aligned(ataCommandOptions->forceCDBSize, sizeof(uint8_t), device->os_info.minimumAlignment);
-                if (!*satCDB)
-                {
-                    return MEMORY_FAILURE;
-                }
-                *cdbLen = ataCommandOptions->forceCDBSize;
-                //set the OP Code
-                (*satCDB)[OPERATION_CODE] = ATA_PASS_THROUGH_16;
-            }
-            break;
-        case 32:
-            *satCDB = (uint8_t*)calloc_aligned(ataCommandOptions->forceCDBSize, sizeof(uint8_t), device->os_info.minimumAlignment);
-            if (!*satCDB)
-            {
-                return MEMORY_FAILURE;
-            }
-            *cdbLen = ataCommandOptions->forceCDBSize;
-            //Set the OP Code
-            *satCDB[OPERATION_CODE] = 0x7F;//variable length CDB
-            (*satCDB)[1] = 0;//Control field
-            (*satCDB)[2] = RESERVED;
-            (*satCDB)[3] = RESERVED;
-            (*satCDB)[4] = RESERVED;
-            (*satCDB)[5] = RESERVED;
-            (*satCDB)[6] = RESERVED;
-            (*satCDB)[7] = 0x18;//Additional length
-            //Set the service action
-            (*satCDB)[8] = 0x1F;
-            (*satCDB)[9] = 0xF0;
-            protocolOffset = 10;
-            transferBitsOffset = 11;
-            (*satCDB)[12] = RESERVED;
-            (*satCDB)[13] = RESERVED;
-            (*satCDB)[26] = RESERVED;
-            break;
-        default:
-            //Do nothing as this is not a valid value and let the rest of the code figure out what to do
-            break;
+            return BAD_PARAMETER;
         }
-    }
-    if (!*satCDB)
-    {
+        cdbTemplate = SAT_CDB_TEMPLATE_12;
+        break;
+    case 16:
+        //If aux or ICC are set with this force flag, then it needs to be rejected since it is not possible to issue in 16B CDBs
+        if (auxOrICCSet)
+        {
+            return BAD_PARAMETER;
+        }
+        cdbTemplate = extendedCommand ? SAT_CDB_TEMPLATE_16_EXT : SAT_CDB_TEMPLATE_16;
+        break;
+    case 32:
+        cdbTemplate = extendedCommand ? SAT_CDB_TEMPLATE_32_EXT : SAT_CDB_TEMPLATE_32;
+        break;
+    default:
+        //Not a valid value so let the command type decide
         switch (ataCommandOptions->commandType)
         {
         case ATA_CMD_TYPE_TASKFILE:
-            if (!device->drive_info.passThroughHacks.ataPTHacks.a1NeverSupported)
-            {
-                //12B CDB
-                *satCDB = (uint8_t*)calloc_aligned(CDB_LEN_12, sizeof(uint8_t), device->os_info.minimumAlignment);
-                if (!*satCDB)
-                {
-                    return MEMORY_FAILURE;
-                }
-                *cdbLen = CDB_LEN_12;
-                //set the OP Code
-                (*satCDB)[OPERATION_CODE] = ATA_PASS_THROUGH_12;
-            }
-            else
-            {
-                //16B CDB
-                *satCDB = (uint8_t*)calloc_aligned(CDB_LEN_16, sizeof(uint8_t), device->os_info.minimumAlignment);
-                if (!*satCDB)
-                {
-                    return MEMORY_FAILURE;
-                }
-                *cdbLen = CDB_LEN_16;
-                //Set the OP Code
-                (*satCDB)[OPERATION_CODE] = ATA_PASS_THROUGH_16;
-            }
+            cdbTemplate = device->drive_info.passThroughHacks.ataPTHacks.a1NeverSupported ? SAT_CDB_TEMPLATE_16 : SAT_CDB_TEMPLATE_12;
             break;
         case ATA_CMD_TYPE_EXTENDED_TASKFILE:
-            if (device->drive_info.passThroughHacks.ataPTHacks.a1ExtCommandWhenPossible)
+            //No ext registers set means the command can be issued with a 12B CDB. This is a major hack, but might help some devices get some more support.
+            if (device->drive_info.passThroughHacks.ataPTHacks.a1ExtCommandWhenPossible && !extRegistersSet)
             {
-                //validate that there are no ext registers to set. If there are, then do nothing, otherwise allocate the memory to build the CDB
-                if (!(ataCommandOptions->tfr.SectorCount48 || ataCommandOptions->tfr.LbaLow48
-                    || ataCommandOptions->tfr.LbaMid48 || ataCommandOptions->tfr.LbaHi48
-                    || ataCommandOptions->tfr.Feature48))
-                {
-                    //No ext registers are set, so we will issue the command with a 12B CDB. This is a major hack, but might help some devices get some more support.
-                    //12B CDB
-                    *satCDB = (uint8_t*)calloc_aligned(CDB_LEN_12, sizeof(uint8_t), device->os_info.minimumAlignment);
-                    if (!*satCDB)
-                    {
-                        return MEMORY_FAILURE;
-                    }
-                    *cdbLen = CDB_LEN_12;
-                    //Set the OP Code
-                    (*satCDB)[OPERATION_CODE] = ATA_PASS_THROUGH_12;
-                }
+                cdbTemplate = SAT_CDB_TEMPLATE_12;
             }
-            if (!*satCDB) //should fall into here if the above check did not work and allocate the satCDB memory.
+            else
             {
-                //16B CDB
-                *satCDB = (uint8_t*)calloc_aligned(CDB_LEN_16, sizeof(uint8_t), device->os_info.minimumAlignment);
-                if (!*satCDB)
-                {
-                    return MEMORY_FAILURE;
-                }
-                *cdbLen = CDB_LEN_16;
-                //Set the OP Code
-                (*satCDB)[OPERATION_CODE] = ATA_PASS_THROUGH_16;
+                cdbTemplate = SAT_CDB_TEMPLATE_16_EXT;
             }
             break;
         case ATA_CMD_TYPE_COMPLETE_TASKFILE:
-            //32B CDB
-            *satCDB = (uint8_t*)calloc_aligned(CDB_LEN_32, sizeof(uint8_t), device->os_info.minimumAlignment);
-            if (!*satCDB)
-            {
-                return MEMORY_FAILURE;
-            }
-            *cdbLen = CDB_LEN_32;
-            //Set the OP Code
-            (*satCDB)[OPERATION_CODE] = 0x7F;//variable length CDB
-            (*satCDB)[1] = 0;//Control field
-            (*satCDB)[2] = RESERVED;
-            (*satCDB)[3] = RESERVED;
-            (*satCDB)[4] = RESERVED;
-            (*satCDB)[5] = RESERVED;
-            (*satCDB)[6] = RESERVED;
-            (*satCDB)[7] = 0x18;//Additional length
-            //Set the service action
-            (*satCDB)[8] = 0x1F;
-            (*satCDB)[9] = 0xF0;
-            protocolOffset = 10;
-            transferBitsOffset = 11;
-            (*satCDB)[12] = RESERVED;
-            (*satCDB)[13] = RESERVED;
-            (*satCDB)[26] = RESERVED;
+            cdbTemplate = SAT_CDB_TEMPLATE_32_EXT;
             break;
             //TODO: handle hard/soft reset here to generate those CDBs properly as well. For now, they are not supported. - TJE
         default:
             return BAD_PARAMETER;
-            break;
         }
+        break;
     }
+    const satCDBTemplate *cdbShape = &satCDBTemplates[cdbTemplate];
+    uint8_t directionIndex = sat_Template_Direction_Index(ataCommandOptions->commandDirection);
     //set protocol
-    ret = set_Protocol_Field(*satCDB, ataCommandOptions->commadProtocol, ataCommandOptions->commandDirection, protocolOffset);
-    if (ret != SUCCESS)
+    if (ataCommandOptions->commadProtocol >= ATA_PROTOCOL_MAX_VALUE || satProtocolFieldTemplate[ataCommandOptions->commadProtocol][directionIndex] == SAT_TEMPLATE_INVALID)
     {
-        return ret;
+        return BAD_PARAMETER;
+    }
+    //set transfer bits. The transfer type does not matter for non-data
+    if (ataCommandOptions->ataCommandLengthLocation > ATA_PT_LEN_TPSIU
+        || (ataCommandOptions->ataCommandLengthLocation != ATA_PT_LEN_NO_DATA && ataCommandOptions->ataTransferBlocks > ATA_PT_NO_DATA_TRANSFER))
+    {
+        return BAD_PARAMETER;
     }
+    memcpy(satCDB, cdbShape->cdb, cdbShape->cdbLength);
+    *cdbLen = cdbShape->cdbLength;
+    satCDB[cdbShape->protocolOffset] |= satProtocolFieldTemplate[ataCommandOptions->commadProtocol][directionIndex];
     //set multiple count
-    set_Multiple_Count(*satCDB, ataCommandOptions->multipleCount, protocolOffset);
-    //set transfer bits
-    ret = set_Transfer_Bits(*satCDB, ataCommandOptions->ataCommandLengthLocation, ataCommandOptions->ataTransferBlocks, ataCommandOptions->commandDirection, transferBitsOffset);
-    if (ret != SUCCESS)
+    set_Multiple_Count(satCDB, ataCommandOptions->multipleCount, cdbShape->protocolOffset);
+    if (ataCommandOptions->ataCommandLengthLocation != ATA_PT_LEN_NO_DATA)
     {
-        return ret;
+        satCDB[cdbShape->transferBitsOffset] |= satTransferBitsTemplate[ataCommandOptions->ataCommandLengthLocation][ataCommandOptions->ataTransferBlocks][directionIndex == 0 ? 0 : 1];
     }
     //set offline bits
-    set_Offline_Bits(*satCDB, ataCommandOptions->timeout, transferBitsOffset);
+    set_Offline_Bits(satCDB, ataCommandOptions->timeout, cdbShape->transferBitsOffset);
     //set registers
-    ret = set_Registers(*satCDB, ataCommandOptions);
+    ret = set_Registers(satCDB, ataCommandOptions);
     //set the check condition bit as we need it
     if (device->os_info.osType == OS_WINDOWS && device->drive_info.interface_type == IDE_INTERFACE)
     {
         //always set the check condition bit since in this case we won't get RTFRs even if there is an error...Windows low level driver workaround
-        set_Check_Condition_Bit(*satCDB, transferBitsOffset);
+        set_Check_Condition_Bit(satCDB, cdbShape->transferBitsOffset);
     }
     else
     {
@@ -988,13 +991,13 @@ int build_SAT_CDB(tDevice *device, uint8_t **satCDB, eCDBLen *cdbLen, ataPassthr
         switch (ataCommandOptions->commandDirection)
         {
         case XFER_NO_DATA:
-            set_Check_Condition_Bit(*satCDB, transferBitsOffset);
+            set_Check_Condition_Bit(satCDB, cdbShape->transferBitsOffset);
             break;
         default:
             //don't set the bit...unless we're being forced to do so
             if (ataCommandOptions->forceCheckConditionBit || device->drive_info.passThroughHacks.ataPTHacks.alwaysCheckConditionAvailable)
             {
-                set_Check_Condition_Bit(*satCDB, transferBitsOffset);
+                set_Check_Condition_Bit(satCDB, cdbShape->transferBitsOffset);
             }
             break;
         }
@@ -1002,21 +1005,33 @@ int build_SAT_CDB(tDevice *device, uint8_t **satCDB, eCDBLen *cdbLen, ataPassthr
     return ret;
 }
 
+int build_SAT_CDB(tDevice *device, uint8_t **satCDB, eCDBLen *cdbLen, ataPassthroughCommand *ataCommandOptions)
+{
+    int ret = SUCCESS;
+    *satCDB = (uint8_t*)calloc_aligned(CDB_LEN_32, sizeof(uint8_t), device->os_info.minimumAlignment);
+    if (!*satCDB)
+    {
+        return MEMORY_FAILURE;
+    }
+    ret = fill_SAT_CDB(device, *satCDB, cdbLen, ataCommandOptions);
+    if (ret != SUCCESS)
+    {
+        safe_Free_aligned(*satCDB);
+    }
+    return ret;
+}
+
 int send_SAT_Passthrough_Command(tDevice *device, ataPassthroughCommand  *ataCommandOptions)
 {
     int ret = UNKNOWN;
     int senseRet = SUCCESS;
-    uint8_t *satCDB = NULL;
     eCDBLen satCDBLength = 0;
-    uint8_t *senseData = NULL;//only allocate if the pointer in the ataCommandOptions is NULL
+    ScsiIoCtx scsiIoCtx;
+    uint8_t senseData[SPC3_SENSE_LEN];//only used if the pointer in the ataCommandOptions is NULL
     bool localSenseData = false;
     if (!ataCommandOptions->ptrSenseData)
     {
-        senseData = (uint8_t*)calloc_aligned(SPC3_SENSE_LEN, sizeof(uint8_t), device->os_info.minimumAlignment);
-        if (!senseData)
-        {
-            return MEMORY_FAILURE;
-        }
+        memset(senseData, 0, SPC3_SENSE_LEN);
         localSenseData = true;
         ataCommandOptions->ptrSenseData = senseData;
         ataCommandOptions->senseDataSize = SPC3_SENSE_LEN;
@@ -1030,8 +1045,9 @@ int send_SAT_Passthrough_Command(tDevice *device, ataPassthroughCommand  *ataCom
     {
         ataCommandOptions->forceCheckConditionBit = true;
     }
-    //First build the CDB
-    ret = build_SAT_CDB(device, &satCDB, &satCDBLength, ataCommandOptions);
+    //First build the CDB directly into the context that will be sent
+    memset(&scsiIoCtx, 0, sizeof(ScsiIoCtx));
+    ret = fill_SAT_CDB(device, scsiIoCtx.cdb, &satCDBLength, ataCommandOptions);
     if (ret == SUCCESS)
     {
         if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
@@ -1039,10 +1055,7 @@ int send_SAT_Passthrough_Command(tDevice *device, ataPassthroughCommand  *ataCom
             //Print out ATA Command Information in appropriate verbose mode.
             print_Verbose_ATA_Command_Information(ataCommandOptions);
         }
-        //Now setup the scsiioctx and send the CDB
-        ScsiIoCtx scsiIoCtx;
-        memset(&scsiIoCtx, 0, sizeof(ScsiIoCtx));
-        memcpy(scsiIoCtx.cdb, satCDB, satCDBLength);
+        //Now setup the rest of the scsiioctx and send the CDB
         scsiIoCtx.cdbLength = satCDBLength;
         scsiIoCtx.dataLength = ataCommandOptions->dataSize;
         scsiIoCtx.pdata = ataCommandOptions->ptrData;
@@ -1081,7 +1094,7 @@ int send_SAT_Passthrough_Command(tDevice *device, ataPassthroughCommand  *ataCom
         }
         get_Sense_Key_ASC_ASCQ_FRU(ataCommandOptions->ptrSenseData, ataCommandOptions->senseDataSize, &scsiIoCtx.returnStatus.senseKey, &scsiIoCtx.returnStatus.asc, &scsiIoCtx.returnStatus.ascq, &scsiIoCtx.returnStatus.fru);
         senseRet = check_Sense_Key_ASC_ASCQ_And_FRU(device, scsiIoCtx.returnStatus.senseKey, scsiIoCtx.returnStatus.asc, scsiIoCtx.returnStatus.ascq, scsiIoCtx.returnStatus.fru);
-        if (senseData != NULL && ataCommandOptions->senseDataSize > 0 && senseData != device->drive_info.lastCommandSenseData)
+        if (localSenseData && ataCommandOptions->senseDataSize > 0)
         {
             memcpy(device->drive_info.lastCommandSenseData, ataCommandOptions->ptrSenseData, ataCommandOptions->senseDataSize);
         }
@@ -1225,13 +1238,11 @@ int send_SAT_Passthrough_Command(tDevice *device, ataPassthroughCommand  *ataCom
             ret = sendIOret;
         }
     }
-    safe_Free_aligned(satCDB);
     if ((device->drive_info.lastCommandTimeNanoSeconds / 1000000000) > ataCommandOptions->timeout)
     {
         ret = COMMAND_TIMEOUT;
     }
     memcpy(&device->drive_info.lastCommandRTFRs, &ataCommandOptions->rtfr, sizeof(ataReturnTFRs));
-    safe_Free_aligned(senseData);
     if (localSenseData)
     {
         ataCommandOptions->ptrSenseData = NULL;
@@ -1325,13 +1336,14 @@ void set_Sense_Data_For_Translation(uint8_t *sensePtr, uint32_t senseDataLength,
             uint32_t descriptorOffset = 0;
             while (counter < descriptorCount)
             {
-                descriptorLength = descriptor[descriptorOffset + 1] + 1;
-                memcpy(&senseData[senseDataOffset], descriptor, descriptorLength);
+                //descriptor length is the additional length plus the type and additional length bytes
+                descriptorLength = descriptor[descriptorOffset + 1] + 2;
+                memcpy(&senseData[senseDataOffset], &descriptor[descriptorOffset], descriptorLength);
                 additionalSenseLength += descriptorLength;
                 ++counter;
                 descriptorOffset += descriptorLength;
                 senseDataOffset += descriptorLength;
-                if (descriptor[descriptorOffset] == 9)
+                if (counter < descriptorCount && descriptor[descriptorOffset] == 9)
                 {
                     descriptorOffset += 1;//adding 1 since we put the log index in one extra byte, which is non standard and not part of the actual descriptor. This handles going on to the next descriptor in the list properly. We don't return this byte in the descriptor anyways
                 }
@@ -1620,8 +1632,8 @@ void set_Sense_Data_By_RTFRs(tDevice *device, ataReturnTFRs *rtfrs, uint8_t *sen
     return;
 }
 
-//To be used by the SATL when issuing a single read command (non-ncq)
-int satl_Read_Command(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, bool fua)
+//Issues a single ATA read command (non-ncq). dataSize must fit in one command (see satl_Max_Sectors_Per_Command)
+static int satl_Read_Chunk(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, bool fua)
 {
     int ret = SUCCESS;
     bool dmaSupported = false;
@@ -1693,8 +1705,8 @@ int satl_Read_Command(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint
     set_Sense_Data_By_RTFRs(scsiIoCtx->device, &scsiIoCtx->device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
     return ret;
 }
-//To be used by the SATL when issuing a single write command
-int satl_Write_Command(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, bool fua)
+//Issues a single ATA write command. dataSize must fit in one command (see satl_Max_Sectors_Per_Command)
+static int satl_Write_Chunk(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, bool fua)
 {
     int ret = SUCCESS;
     bool dmaSupported = false;
@@ -1770,179 +1782,233 @@ int satl_Write_Command(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uin
     set_Sense_Data_By_RTFRs(scsiIoCtx->device, &scsiIoCtx->device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
     return ret;
 }
-//To be used by the SATL when issuing a single read-verify command (or read and compare data bytes if bytecheck is 1)
-int satl_Read_Verify_Command(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, uint8_t byteCheck)
+//Largest number of sectors a single ATA read or write command can move for this device, including any passthrough transfer length limit.
+static uint32_t satl_Max_Sectors_Per_Command(tDevice *device)
+{
+    uint32_t maxSectors = 256;
+    if (device->drive_info.IdentifyData.ata.Word083 & BIT10)
+    {
+        maxSectors = 65536;
+    }
+    if (device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength > 0)
+    {
+        maxSectors = M_Min(maxSectors, M_Max(UINT32_C(1), device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength / device->drive_info.deviceBlockSize));
+    }
+    return maxSectors;
+}
+
+//Each chunk reports its status through the translated sense data, so check that for an error before issuing the next one.
+static bool satl_Chunk_Failed(ScsiIoCtx *scsiIoCtx)
+{
+    uint8_t senseKey = 0, asc = 0, ascq = 0, fru = 0;
+    if (!scsiIoCtx->psense || scsiIoCtx->senseDataSize == 0)
+    {
+        return false;
+    }
+    get_Sense_Key_ASC_ASCQ_FRU(scsiIoCtx->psense, scsiIoCtx->senseDataSize, &senseKey, &asc, &ascq, &fru);
+    return senseKey != SENSE_KEY_NO_ERROR && senseKey != SENSE_KEY_RECOVERED_ERROR;
+}
+
+//To be used by the SATL when reading. Transfers larger than one ATA command can handle are split into multiple commands.
+int satl_Read_Command(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, bool fua)
 {
     int ret = SUCCESS;
-    bool dmaSupported = false;
-    uint32_t verificationLength = dataSize / scsiIoCtx->device->drive_info.deviceBlockSize;
-    if (scsiIoCtx->device->drive_info.IdentifyData.ata.Word049 & BIT8)
+    uint32_t chunkSize = satl_Max_Sectors_Per_Command(scsiIoCtx->device) * scsiIoCtx->device->drive_info.deviceBlockSize;
+    uint32_t offset = 0;
+    if (dataSize <= chunkSize)
     {
-        if (scsiIoCtx->device->drive_info.IdentifyData.ata.Word063 & (BIT0 | BIT1 | BIT2))
-        {
-            dmaSupported = true;
-        }
-        else if (scsiIoCtx->device->drive_info.IdentifyData.ata.Word088 & 0xFF)
-        {
-            dmaSupported = true;
-        }
+        return satl_Read_Chunk(scsiIoCtx, lba, ptrData, dataSize, fua);
     }
-    //check if 48bit
-    if (scsiIoCtx->device->drive_info.IdentifyData.ata.Word083 & BIT10)
+    while (ret == SUCCESS && offset < dataSize)
     {
-        uint16_t scnt = verificationLength / scsiIoCtx->device->drive_info.deviceBlockSize;
-        if (verificationLength == 65536)
+        uint32_t thisChunk = M_Min(chunkSize, dataSize - offset);
+        ret = satl_Read_Chunk(scsiIoCtx, lba + (offset / scsiIoCtx->device->drive_info.deviceBlockSize), ptrData + offset, thisChunk, fua);
+        if (satl_Chunk_Failed(scsiIoCtx))
         {
-            //ATA Spec says to transfer this may sectors, you must set the sector count to zero (Not that any passthrough driver will actually allow this)
-            scnt = 0;
+            //stop here so the sense data for the failing chunk is what gets returned
+            break;
         }
-        if (byteCheck == 0)
+        offset += thisChunk;
+    }
+    return ret;
+}
+
+//To be used by the SATL when writing. Transfers larger than one ATA command can handle are split into multiple commands.
+int satl_Write_Command(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, bool fua)
+{
+    int ret = SUCCESS;
+    uint32_t chunkSize = satl_Max_Sectors_Per_Command(scsiIoCtx->device) * scsiIoCtx->device->drive_info.deviceBlockSize;
+    uint32_t offset = 0;
+    if (dataSize <= chunkSize)
+    {
+        return satl_Write_Chunk(scsiIoCtx, lba, ptrData, dataSize, fua);
+    }
+    while (ret == SUCCESS && offset < dataSize)
+    {
+        uint32_t thisChunk = M_Min(chunkSize, dataSize - offset);
+        ret = satl_Write_Chunk(scsiIoCtx, lba + (offset / scsiIoCtx->device->drive_info.deviceBlockSize), ptrData + offset, thisChunk, fua);
+        if (satl_Chunk_Failed(scsiIoCtx))
         {
-            //send ata read-verify
-            ret = ata_Read_Verify_Sectors(scsiIoCtx->device, true, verificationLength, lba);
+            //stop here so the sense data for the failing chunk is what gets returned
+            break;
         }
-        else
+        offset += thisChunk;
+    }
+    return ret;
+}
+
+//Returns the offset of the first byte that differs between the two buffers, or length if they match.
+//memcmp is used to find the region containing the difference since it is already vectorized by the C library, then the exact byte is found within that region.
+static uint32_t find_First_Miscompare(const uint8_t *buf1, const uint8_t *buf2, uint32_t length)
+{
+    const uint32_t strideLength = 4096;
+    uint32_t offset = 0;
+    while (offset < length)
+    {
+        uint32_t thisStride = M_Min(strideLength, length - offset);
+        if (memcmp(&buf1[offset], &buf2[offset], thisStride) != 0)
         {
-            uint8_t *compareBuf = NULL;
-            //uint32_t compareLength = 0;
-            if (byteCheck == 0x02)
-            {
-                //return an error
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
-            compareBuf = (uint8_t*)calloc_aligned(scsiIoCtx->dataLength, sizeof(uint8_t), scsiIoCtx->device->os_info.minimumAlignment);
-            if (!compareBuf)
-            {
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return MEMORY_FAILURE;
-            }
-            if (dmaSupported)
-            {
-                ret = ata_Read_DMA(scsiIoCtx->device, lba, compareBuf, scnt, scsiIoCtx->dataLength, true);
-            }
-            else //pio
-            {
-                ret = ata_Read_Sectors(scsiIoCtx->device, lba, compareBuf, scnt, scsiIoCtx->dataLength, true);
-            }
-            bool errorFound = false;
-            if (byteCheck == 0x01)
+            uint32_t strideEnd = offset + thisStride;
+            //narrow down 8 bytes at a time before going byte by byte
+            while (offset + sizeof(uint64_t) <= strideEnd)
             {
-                if (memcmp(compareBuf, scsiIoCtx->pdata, scsiIoCtx->dataLength))
+                uint64_t word1 = 0, word2 = 0;
+                memcpy(&word1, &buf1[offset], sizeof(uint64_t));
+                memcpy(&word2, &buf2[offset], sizeof(uint64_t));
+                if (word1 != word2)
                 {
-                    //does not match - set miscompare error
-                    errorFound = true;
-                }
-            }
-            else if (byteCheck == 0x03)
-            {
-                //compare each logical sector to the data sent into this command
-
-                uint32_t iter = 0;
-                for (; iter < scsiIoCtx->dataLength; iter += scsiIoCtx->device->drive_info.deviceBlockSize)
-                {
-                    if (memcmp(&compareBuf[iter], scsiIoCtx->pdata, M_Min(scsiIoCtx->device->drive_info.deviceBlockSize, scsiIoCtx->dataLength)))
-                    {
-                        errorFound = true;
-                        break;
-                    }
+                    break;
                 }
+                offset += sizeof(uint64_t);
             }
-            safe_Free_aligned(compareBuf);
-            if (errorFound)
+            while (offset < strideEnd && buf1[offset] == buf2[offset])
             {
-                //set failure
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_MISCOMPARE, 0x1D, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
-            else
-            {
-                //set success
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0x00, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
+                ++offset;
             }
+            return offset;
         }
+        offset += thisStride;
     }
-    else //28bit command
+    return length;
+}
+
+//Reads back the range and compares it to the host's data for BYTCHK 01b (data-out holds every logical block) and 11b (data-out holds one logical block to compare to each logical block in the range).
+//The range is read in chunks into one pooled buffer, and reading stops at the first miscompare.
+//On a miscompare, the INFORMATION field is set to the offset of the first miscompared byte, counted from the first logical block in the range.
+static int satl_Byte_Check_Verify(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint32_t numberOfLogicalBlocks, uint8_t byteCheck)
+{
+    int ret = SUCCESS;
+    tDevice *device = scsiIoCtx->device;
+    uint32_t blockSize = device->drive_info.deviceBlockSize;
+    uint32_t chunkBlocks = M_Min(satl_Max_Sectors_Per_Command(device), M_Max(get_Sector_Count_For_Read_Write(device), UINT32_C(1)));
+    uint64_t hostDataNeeded = byteCheck == 0x03 ? blockSize : (uint64_t)numberOfLogicalBlocks * blockSize;
+    uint8_t *readBuffer = NULL;
+    bool miscompare = false;
+    uint64_t miscompareOffset = 0;
+    if (!scsiIoCtx->pdata || scsiIoCtx->dataLength < hostDataNeeded)
     {
-        if (verificationLength > 256)
-        {
-            //return an error
-            set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-            return SUCCESS;
-        }
-        uint16_t scnt = verificationLength / scsiIoCtx->device->drive_info.deviceBlockSize;
-        if (verificationLength == 256)
+        //parameter list length error
+        set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x1A, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
+        return SUCCESS;
+    }
+    chunkBlocks = M_Min(chunkBlocks, numberOfLogicalBlocks);
+    readBuffer = lease_Device_Buffer(device, chunkBlocks * blockSize);
+    if (!readBuffer)
+    {
+        //insufficient resources
+        set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ABORTED_COMMAND, 0x55, 0x03, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
+        return MEMORY_FAILURE;
+    }
+    for (uint32_t blocksDone = 0; blocksDone < numberOfLogicalBlocks && !miscompare;)
+    {
+        uint32_t thisChunkBlocks = M_Min(chunkBlocks, numberOfLogicalBlocks - blocksDone);
+        uint32_t thisChunkSize = thisChunkBlocks * blockSize;
+        ret = satl_Read_Chunk(scsiIoCtx, lba + blocksDone, readBuffer, thisChunkSize, false);
+        if (ret != SUCCESS || satl_Chunk_Failed(scsiIoCtx))
         {
-            //ATA Spec says to transfer this may sectors, you must set the sector count to zero (Not that any passthrough driver will actually allow this)
-            scnt = 0;
+            //read failed. Leave the sense data from the read in place
+            safe_Return_Device_Buffer(device, readBuffer);
+            return ret;
         }
-        if (byteCheck == 0)
+        if (byteCheck == 0x01)
         {
-            //send ata read-verify
-            ret = ata_Read_Verify_Sectors(scsiIoCtx->device, false, verificationLength, lba);
+            uint32_t offset = find_First_Miscompare(readBuffer, &scsiIoCtx->pdata[(uint64_t)blocksDone * blockSize], thisChunkSize);
+            if (offset < thisChunkSize)
+            {
+                miscompare = true;
+                miscompareOffset = ((uint64_t)blocksDone * blockSize) + offset;
+            }
         }
         else
         {
-            uint8_t *compareBuf = NULL;
-            //uint32_t compareLength = 0;
-            if (byteCheck == 0x02)
+            for (uint32_t blockIter = 0; blockIter < thisChunkBlocks; ++blockIter)
             {
-                //return an error
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
-            compareBuf = (uint8_t*)calloc_aligned(scsiIoCtx->dataLength, sizeof(uint8_t), scsiIoCtx->device->os_info.minimumAlignment);
-            if (!compareBuf)
-            {
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return MEMORY_FAILURE;
-            }
-            if (dmaSupported)
-            {
-                ret = ata_Read_DMA(scsiIoCtx->device, lba, compareBuf, scnt, scsiIoCtx->dataLength, false);
-            }
-            else //pio
-            {
-                ret = ata_Read_Sectors(scsiIoCtx->device, lba, compareBuf, scnt, scsiIoCtx->dataLength, false);
-            }
-            bool errorFound = false;
-            if (byteCheck == 0x01)
-            {
-                if (memcmp(compareBuf, scsiIoCtx->pdata, scsiIoCtx->dataLength))
+                uint32_t offset = find_First_Miscompare(&readBuffer[blockIter * blockSize], scsiIoCtx->pdata, blockSize);
+                if (offset < blockSize)
                 {
-                    //does not match - set miscompare error
-                    errorFound = true;
+                    miscompare = true;
+                    miscompareOffset = ((uint64_t)(blocksDone + blockIter) * blockSize) + offset;
+                    break;
                 }
             }
-            else if (byteCheck == 0x03)
-            {
-                //compare each logical sector to the data sent into this command
+        }
+        blocksDone += thisChunkBlocks;
+    }
+    safe_Return_Device_Buffer(device, readBuffer);
+    if (miscompare)
+    {
+        uint8_t informationSenseDescriptor[12] = { 0 };
+        informationSenseDescriptor[0] = 0;
+        informationSenseDescriptor[1] = 0x0A;
+        informationSenseDescriptor[2] = BIT7;//valid
+        informationSenseDescriptor[4] = M_Byte7(miscompareOffset);
+        informationSenseDescriptor[5] = M_Byte6(miscompareOffset);
+        informationSenseDescriptor[6] = M_Byte5(miscompareOffset);
+        informationSenseDescriptor[7] = M_Byte4(miscompareOffset);
+        informationSenseDescriptor[8] = M_Byte3(miscompareOffset);
+        informationSenseDescriptor[9] = M_Byte2(miscompareOffset);
+        informationSenseDescriptor[10] = M_Byte1(miscompareOffset);
+        informationSenseDescriptor[11] = M_Byte0(miscompareOffset);
+        set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_MISCOMPARE, 0x1D, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, informationSenseDescriptor, 1);
+    }
+    else
+    {
+        set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0x00, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
+    }
+    return SUCCESS;
+}
 
-                uint32_t iter = 0;
-                for (; iter < scsiIoCtx->dataLength; iter += scsiIoCtx->device->drive_info.deviceBlockSize)
-                {
-                    if (memcmp(&compareBuf[iter], scsiIoCtx->pdata, M_Min(scsiIoCtx->device->drive_info.deviceBlockSize, scsiIoCtx->dataLength)))
-                    {
-                        errorFound = true;
-                        break;
-                    }
-                }
-            }
-            safe_Free_aligned(compareBuf);
-            if (errorFound)
-            {
-                //set failure
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_MISCOMPARE, 0x1D, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
-            else
-            {
-                //set success
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0x00, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
+//To be used by the SATL when issuing a single read-verify command (or read and compare data bytes if bytecheck is 1 or 3)
+int satl_Read_Verify_Command(ScsiIoCtx *scsiIoCtx, uint64_t lba, uint8_t *ptrData, uint32_t dataSize, uint8_t byteCheck)
+{
+    int ret = SUCCESS;
+    uint32_t verificationLength = dataSize / scsiIoCtx->device->drive_info.deviceBlockSize;
+    if (byteCheck == 0x02)
+    {
+        //return an error
+        set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
+        return SUCCESS;
+    }
+    else if (byteCheck != 0)
+    {
+        return satl_Byte_Check_Verify(scsiIoCtx, lba, verificationLength, byteCheck);
+    }
+    //check if 48bit
+    if (scsiIoCtx->device->drive_info.IdentifyData.ata.Word083 & BIT10)
+    {
+        //send ata read-verify
+        ret = ata_Read_Verify_Sectors(scsiIoCtx->device, true, verificationLength, lba);
+    }
+    else //28bit command
+    {
+        if (verificationLength > 256)
+        {
+            //return an error
+            set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, scsiIoCtx->device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
+            return SUCCESS;
         }
+        //send ata read-verify
+        ret = ata_Read_Verify_Sectors(scsiIoCtx->device, false, verificationLength, lba);
     }
     //now set sense data
     set_Sense_Data_By_RTFRs(scsiIoCtx->device, &scsiIoCtx->device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
@@ -2614,16 +2680,9 @@ int translate_Block_Limits_VPD_Page_B0h(tDevice *device, ScsiIoCtx *scsiIoCtx)
     //unmap stuff
     if (device->drive_info.IdentifyData.ata.Word169 & BIT0 && device->drive_info.IdentifyData.ata.Word069 & BIT14)
     {
-#if SAT_SPEC_SUPPORTED > 3
-        uint8_t maxDescriptorsPerBlock = device->drive_info.softSATFlags.dataSetManagementXLSupported ? 32 : 64;
-        uint64_t maxUnmapRangePerDescriptor = device->drive_info.softSATFlags.dataSetManagementXLSupported ? UINT64_MAX : UINT16_MAX;
-        uint64_t maxLBAsPerUnmap = maxDescriptorsPerBlock * device->drive_info.IdentifyData.ata.Word105 * maxUnmapRangePerDescriptor;
-        uint32_t unmapLBACount = maxLBAsPerUnmap > UINT32_MAX ? UINT32_MAX : (uint32_t)maxLBAsPerUnmap;
-        uint32_t unmapMaxBlockDescriptors = maxDescriptorsPerBlock * device->drive_info.IdentifyData.ata.Word105;
-#else
-        uint32_t unmapLBACount = 64 * device->drive_info.IdentifyData.ata.Word105 * UINT16_MAX;
-        uint32_t unmapMaxBlockDescriptors = 64 * device->drive_info.IdentifyData.ata.Word105;
-#endif
+        //The translator sends as many data set management commands as it takes, so the only limits are what fits in one UNMAP parameter list
+        uint32_t unmapLBACount = UINT32_MAX;
+        uint32_t unmapMaxBlockDescriptors = (UINT16_MAX - 8) / 16;
         //maximum unmap LBA count (unspecified....we decide)
         blockLimits[20] = M_Byte3(unmapLBACount);
         blockLimits[21] = M_Byte2(unmapLBACount);
@@ -3932,7 +3991,7 @@ int translate_SCSI_Read_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
     {
         return SUCCESS;
     }
-    else if (transferLength > 65536)
+    else if ((uint64_t)transferLength * device->drive_info.deviceBlockSize > UINT32_MAX)//larger transfers are split into multiple commands, but the total must still fit in a 32bit byte count
     {
         //return an error
         switch (scsiIoCtx->cdb[OPERATION_CODE])
@@ -4056,7 +4115,7 @@ int translate_SCSI_Write_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
         //a transfer length of zero means do nothing but validate inputs and is not an error
         return SUCCESS;
     }
-    else if (transferLength > 65536)
+    else if ((uint64_t)transferLength * device->drive_info.deviceBlockSize > UINT32_MAX)//larger transfers are split into multiple commands, but the total must still fit in a 32bit byte count
     {
         //return an error
         switch (scsiIoCtx->cdb[OPERATION_CODE])
@@ -4534,12 +4593,6 @@ int translate_SCSI_Write_And_Verify_Command(tDevice *device, ScsiIoCtx *scsiIoCt
     //check if 48bit
     if (device->drive_info.IdentifyData.ata.Word083 & BIT10)
     {
-        uint16_t scnt = verificationLength / device->drive_info.deviceBlockSize;
-        if (verificationLength == 65536)
-        {
-            //ATA Spec says to transfer this may sectors, you must set the sector count to zero (Not that any passthrough driver will actually allow this)
-            scnt = 0;
-        }
         if (dmaSupported)
         {
             ret = ata_Write_DMA(device, lba, scsiIoCtx->pdata, scsiIoCtx->dataLength, true, false);
@@ -4555,8 +4608,6 @@ int translate_SCSI_Write_And_Verify_Command(tDevice *device, ScsiIoCtx *scsiIoCt
         }
         else
         {
-            uint8_t *compareBuf = NULL;
-            //uint32_t compareLength = 0;
             if (byteCheck == 0x02)
             {
                 fieldPointer = 1;
@@ -4565,56 +4616,7 @@ int translate_SCSI_Write_And_Verify_Command(tDevice *device, ScsiIoCtx *scsiIoCt
                 set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
                 return SUCCESS;
             }
-            compareBuf = (uint8_t*)calloc_aligned(scsiIoCtx->dataLength, sizeof(uint8_t), device->os_info.minimumAlignment);
-            if (!compareBuf)
-            {
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return MEMORY_FAILURE;
-            }
-            if (dmaSupported)
-            {
-                ret = ata_Read_DMA(device, lba, compareBuf, scnt, scsiIoCtx->dataLength, true);
-            }
-            else //pio
-            {
-                ret = ata_Read_Sectors(device, lba, compareBuf, scnt, scsiIoCtx->dataLength, true);
-            }
-            bool errorFound = false;
-            if (byteCheck == 0x01)
-            {
-                if (memcmp(compareBuf, scsiIoCtx->pdata, scsiIoCtx->dataLength))
-                {
-                    //does not match - set miscompare error
-                    errorFound = true;
-                }
-            }
-            else if (byteCheck == 0x03)
-            {
-                //compare each logical sector to the data sent into this command
-
-                uint32_t iter = 0;
-                for (; iter < scsiIoCtx->dataLength; iter += device->drive_info.deviceBlockSize)
-                {
-                    if (memcmp(&compareBuf[iter], scsiIoCtx->pdata, M_Min(device->drive_info.deviceBlockSize, scsiIoCtx->dataLength)))
-                    {
-                        errorFound = true;
-                        break;
-                    }
-                }
-            }
-            safe_Free_aligned(compareBuf);
-            if (errorFound)
-            {
-                //set failure
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_MISCOMPARE, 0x1D, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
-            else
-            {
-                //set success
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0x00, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
+            return satl_Byte_Check_Verify(scsiIoCtx, lba, verificationLength, byteCheck);
         }
     }
     else //28bit command
@@ -4625,12 +4627,6 @@ int translate_SCSI_Write_And_Verify_Command(tDevice *device, ScsiIoCtx *scsiIoCt
             set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
             return SUCCESS;
         }
-        uint16_t scnt = verificationLength / device->drive_info.deviceBlockSize;
-        if (verificationLength == 256)
-        {
-            //ATA Spec says to transfer this may sectors, you must set the sector count to zero (Not that any passthrough driver will actually allow this)
-            scnt = 0;
-        }
         if (dmaSupported)
         {
             ret = ata_Write_DMA(device, lba, scsiIoCtx->pdata, scsiIoCtx->dataLength, false, false);
@@ -4646,8 +4642,6 @@ int translate_SCSI_Write_And_Verify_Command(tDevice *device, ScsiIoCtx *scsiIoCt
         }
         else
         {
-            uint8_t *compareBuf = NULL;
-            //uint32_t compareLength = 0;
             if (byteCheck == 0x02)
             {
                 fieldPointer = 1;
@@ -4656,56 +4650,7 @@ int translate_SCSI_Write_And_Verify_Command(tDevice *device, ScsiIoCtx *scsiIoCt
                 set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
                 return SUCCESS;
             }
-            compareBuf = (uint8_t*)calloc_aligned(scsiIoCtx->dataLength, sizeof(uint8_t), device->os_info.minimumAlignment);
-            if (!compareBuf)
-            {
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return MEMORY_FAILURE;
-            }
-            if (dmaSupported)
-            {
-                ret = ata_Read_DMA(device, lba, compareBuf, scnt, scsiIoCtx->dataLength, false);
-            }
-            else //pio
-            {
-                ret = ata_Read_Sectors(device, lba, compareBuf, scnt, scsiIoCtx->dataLength, false);
-            }
-            bool errorFound = false;
-            if (byteCheck == 0x01)
-            {
-                if (memcmp(compareBuf, scsiIoCtx->pdata, scsiIoCtx->dataLength))
-                {
-                    //does not match - set miscompare error
-                    errorFound = true;
-                }
-            }
-            else if (byteCheck == 0x03)
-            {
-                //compare each logical sector to the data sent into this command
-
-                uint32_t iter = 0;
-                for (; iter < scsiIoCtx->dataLength; iter += device->drive_info.deviceBlockSize)
-                {
-                    if (memcmp(&compareBuf[iter], scsiIoCtx->pdata, M_Min(device->drive_info.deviceBlockSize, scsiIoCtx->dataLength)))
-                    {
-                        errorFound = true;
-                        break;
-                    }
-                }
-            }
-            safe_Free_aligned(compareBuf);
-            if (errorFound)
-            {
-                //set failure
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_MISCOMPARE, 0x1D, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
-            else
-            {
-                //set success
-                set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0x00, 0x00, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                return SUCCESS;
-            }
+            return satl_Byte_Check_Verify(scsiIoCtx, lba, verificationLength, byteCheck);
         }
     }
     //now set sense data
@@ -5241,7 +5186,7 @@ int translate_SCSI_Reassign_Blocks_Command(tDevice *device, ScsiIoCtx *scsiIoCtx
         set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
         return ret;
     }
-    uint8_t *writeData = (uint8_t*)calloc_aligned(device->drive_info.deviceBlockSize, sizeof(uint8_t), device->os_info.minimumAlignment);
+    uint8_t *writeData = lease_Device_Buffer(device, device->drive_info.deviceBlockSize);
     if (!writeData)
     {
         return MEMORY_FAILURE;
@@ -5302,7 +5247,7 @@ int translate_SCSI_Reassign_Blocks_Command(tDevice *device, ScsiIoCtx *scsiIoCtx
             }
         }
     }
-    safe_Free_aligned(writeData);
+    safe_Return_Device_Buffer(device, writeData);
     return ret;
 }
 
@@ -8634,7 +8579,7 @@ int translate_Read_Error_Counters_Log_0x03(tDevice *device, ScsiIoCtx *scsiIoCtx
     uint16_t fieldPointer = 0;
     if (parameterPointer <= 0x0004 && device->drive_info.softSATFlags.deviceStatsPages.rotatingMediaStatisticsPageSupported)
     {
-        if (SUCCESS != ata_Read_Log_Ext(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_ROTATING_MEDIA, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+        if (SUCCESS != ata_Read_Log_Ext_Cached(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_ROTATING_MEDIA, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported))
         {
             set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
             return FAILURE;
@@ -8657,7 +8602,7 @@ int translate_Read_Error_Counters_Log_0x03(tDevice *device, ScsiIoCtx *scsiIoCtx
     }
     if (parameterPointer <= 0x0006 && device->drive_info.softSATFlags.deviceStatsPages.generalErrorStatisticsSupported)
     {
-        if (SUCCESS != ata_Read_Log_Ext(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_GEN_ERR, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+        if (SUCCESS != ata_Read_Log_Ext_Cached(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_GEN_ERR, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported))
         {
             set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
             return FAILURE;
@@ -8729,7 +8674,7 @@ int translate_Temperature_Log_0x0D(tDevice *device, ScsiIoCtx *scsiIoCtx)
         set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
         return ret;
     }
-    if (SUCCESS != ata_Read_Log_Ext(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_TEMP, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+    if (SUCCESS != ata_Read_Log_Ext_Cached(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_TEMP, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported))
     {
         set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
         return FAILURE;
@@ -8822,7 +8767,7 @@ int translate_Solid_State_Media_Log_0x11(tDevice *device, ScsiIoCtx *scsiIoCtx)
         set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
         return ret;
     }
-    if (SUCCESS != ata_Read_Log_Ext(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_SSD, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+    if (SUCCESS != ata_Read_Log_Ext_Cached(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_SSD, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported))
     {
         set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
         return FAILURE;
@@ -8888,7 +8833,7 @@ int translate_Background_Scan_Results_Log_0x15(tDevice *device, ScsiIoCtx *scsiI
         set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
         return ret;
     }
-    if (SUCCESS != ata_Read_Log_Ext(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_GENERAL, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+    if (SUCCESS != ata_Read_Log_Ext_Cached(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_GENERAL, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported))
     {
         set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
         return FAILURE;
@@ -8967,7 +8912,7 @@ int translate_General_Statistics_And_Performance_Log_0x19(tDevice *device, ScsiI
         set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x24, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
         return ret;
     }
-    if (SUCCESS != ata_Read_Log_Ext(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_GENERAL, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported, 0))
+    if (SUCCESS != ata_Read_Log_Ext_Cached(device, ATA_LOG_DEVICE_STATISTICS, ATA_DEVICE_STATS_LOG_GENERAL, logPage, LEGACY_DRIVE_SEC_SIZE, device->drive_info.ata_Options.readLogWriteLogDMASupported))
     {
         set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
         return FAILURE;
@@ -9729,7 +9674,7 @@ int translate_Application_Client_Log_Select_0x0F(tDevice *device, ScsiIoCtx *scs
             {
                 uint16_t parameterCode = M_BytesTo2ByteValue(ptrData[parameterDataOffset + 0], ptrData[parameterDataOffset + 1]);
                 parameterLength = ptrData[parameterDataOffset + 3];
-                uint8_t *hostLogData = (uint8_t*)calloc_aligned(16 * LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment);
+                uint8_t *hostLogData = lease_Device_Buffer(device, 16 * LEGACY_DRIVE_SEC_SIZE);
                 if (!hostLogData)
                 {
                     return MEMORY_FAILURE;
@@ -9834,7 +9779,7 @@ int translate_Application_Client_Log_Select_0x0F(tDevice *device, ScsiIoCtx *scs
                     {
                         //break and set an error code
                         set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
-                        safe_Free_aligned(hostLogData);
+                        safe_Return_Device_Buffer(device, hostLogData);
                         break;
                     }
                 }
@@ -9844,14 +9789,14 @@ int translate_Application_Client_Log_Select_0x0F(tDevice *device, ScsiIoCtx *scs
                     {
                         //break and set an error code
                         set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
-                        safe_Free_aligned(hostLogData);
+                        safe_Return_Device_Buffer(device, hostLogData);
                         break;
                     }
                 }
                 else
                 {
                     //error...we shouldn't be here!
-                    safe_Free_aligned(hostLogData);
+                    safe_Return_Device_Buffer(device, hostLogData);
                     break;
                 }
                 //need another for loop to go through the ATA log data we just read so that we can modify the data before we write it.
@@ -9876,7 +9821,7 @@ int translate_Application_Client_Log_Select_0x0F(tDevice *device, ScsiIoCtx *scs
                     {
                         //break and set an error code
                         set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
-                        safe_Free_aligned(hostLogData);
+                        safe_Return_Device_Buffer(device, hostLogData);
                         break;
                     }
                 }
@@ -9886,17 +9831,17 @@ int translate_Application_Client_Log_Select_0x0F(tDevice *device, ScsiIoCtx *scs
                     {
                         //break and set an error code
                         set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
-                        safe_Free_aligned(hostLogData);
+                        safe_Return_Device_Buffer(device, hostLogData);
                         break;
                     }
                 }
                 else
                 {
                     //error...we shouldn't be here!
-                    safe_Free_aligned(hostLogData);
+                    safe_Return_Device_Buffer(device, hostLogData);
                     break;
                 }
-                safe_Free_aligned(hostLogData);
+                safe_Return_Device_Buffer(device, hostLogData);
             }
         }
     }
@@ -10060,25 +10005,12 @@ int translate_SCSI_Unmap_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
         uint16_t unmapBlockDescriptorLength = (M_BytesTo2ByteValue(scsiIoCtx->pdata[2], scsiIoCtx->pdata[3]) / 16) * 16;//this can be set to zero, which is NOT an error. Also, I'm making sure this is a multiple of 16 to avoid partial block descriptors-TJE
         if (unmapBlockDescriptorLength > 0)
         {
-            uint8_t *trimBuffer = (uint8_t*)calloc_aligned(device->drive_info.IdentifyData.ata.Word105 * LEGACY_DRIVE_SEC_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment);//allocate the max size the device supports...we'll fill in as much as we need to
-#if SAT_SPEC_SUPPORTED > 3
-            bool useXL = device->drive_info.softSATFlags.dataSetManagementXLSupported;
-            uint8_t maxDescriptorsPerBlock = device->drive_info.softSATFlags.dataSetManagementXLSupported ? 32 : 64;
-            uint8_t descriptorSize = device->drive_info.softSATFlags.dataSetManagementXLSupported ? 16 : 8;
-            uint64_t maxUnmapRangePerDescriptor = device->drive_info.softSATFlags.dataSetManagementXLSupported ? UINT64_MAX : UINT16_MAX;
-#else
-            bool useXL = false
-            uint8_t maxDescriptorsPerBlock = 64;
-            uint8_t descriptorSize = 8;
-            uint64_t maxUnmapRangePerDescriptor = UINT16_MAX;
-#endif
             //need to check to make sure there weren't any truncated block descriptors before we begin
             uint16_t minBlockDescriptorLength = M_Min(unmapBlockDescriptorLength + 8, parameterListLength);
-            uint16_t unmapBlockDescriptorIter = 8;
-            uint64_t numberOfLBAsToTRIM = 0;//this will be checked later to make sure it isn't greater than what we reported on the VPD pages
-            uint16_t numberOfBlockDescriptors = 0;//this will be checked later to make sure it isn't greater than what we reported on the VPD pages
-            uint16_t ataTrimOffset = 0;
-            if (!trimBuffer)
+            uint32_t numberOfRanges = 0;
+            uint8_t *rangeBuffer = lease_Device_Buffer(device, (uint32_t)(((minBlockDescriptorLength - 8) / 16 + 1) * sizeof(deallocateRange)));
+            deallocateRange *ranges = (deallocateRange*)rangeBuffer;
+            if (!rangeBuffer)
             {
                 //lets just set this error for now...-TJE
                 fieldPointer = 7;
@@ -10087,10 +10019,9 @@ int translate_SCSI_Unmap_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
                 set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x1A, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
                 return MEMORY_FAILURE;
             }
-            //start building the buffer to transfer with data set management
-            for (; unmapBlockDescriptorIter < minBlockDescriptorLength; unmapBlockDescriptorIter += 16, numberOfBlockDescriptors++)
+            //collect the block descriptors. The deallocation engine sorts and merges them, then sends as many data set management commands as it takes.
+            for (uint16_t unmapBlockDescriptorIter = 8; unmapBlockDescriptorIter + 16 <= minBlockDescriptorLength; unmapBlockDescriptorIter += 16)
             {
-                bool exitLoop = false;
                 uint64_t unmapLogicalBlockAddress = M_BytesTo8ByteValue(scsiIoCtx->pdata[unmapBlockDescriptorIter + 0], scsiIoCtx->pdata[unmapBlockDescriptorIter + 1], scsiIoCtx->pdata[unmapBlockDescriptorIter + 2], scsiIoCtx->pdata[unmapBlockDescriptorIter + 3], scsiIoCtx->pdata[unmapBlockDescriptorIter + 4], scsiIoCtx->pdata[unmapBlockDescriptorIter + 5], scsiIoCtx->pdata[unmapBlockDescriptorIter + 6], scsiIoCtx->pdata[unmapBlockDescriptorIter + 7]);
                 uint32_t unmapNumberOfLogicalBlocks = M_BytesTo4ByteValue(scsiIoCtx->pdata[unmapBlockDescriptorIter + 8], scsiIoCtx->pdata[unmapBlockDescriptorIter + 9], scsiIoCtx->pdata[unmapBlockDescriptorIter + 10], scsiIoCtx->pdata[unmapBlockDescriptorIter + 11]);
                 if (unmapNumberOfLogicalBlocks == 0)
@@ -10098,8 +10029,6 @@ int translate_SCSI_Unmap_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
                     //nothing to unmap...
                     continue;
                 }
-                //increment this so we can check if we were given more to do than we support (to be checked after the loop)
-                numberOfLBAsToTRIM += unmapNumberOfLogicalBlocks;
                 //check we aren't trying to go over the end of the drive
                 if (unmapLogicalBlockAddress > device->drive_info.deviceMaxLba)
                 {
@@ -10108,115 +10037,47 @@ int translate_SCSI_Unmap_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
                     set_Sense_Key_Specific_Descriptor_Invalid_Field(senseKeySpecificDescriptor, false, true, bitPointer, fieldPointer);
                     ret = FAILURE;
                     set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x21, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
-                    exitLoop = true;
                     break;
                 }
-                else if (unmapLogicalBlockAddress + unmapNumberOfLogicalBlocks > device->drive_info.deviceMaxLba)
+                else if (unmapNumberOfLogicalBlocks > device->drive_info.deviceMaxLba - unmapLogicalBlockAddress + 1)
                 {
                     fieldPointer = unmapBlockDescriptorIter + 8;
                     bitPointer = 7;
                     set_Sense_Key_Specific_Descriptor_Invalid_Field(senseKeySpecificDescriptor, false, true, bitPointer, fieldPointer);
                     ret = FAILURE;
                     set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x21, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
-                    exitLoop = true;
                     break;
                 }
-                //check that we haven't had too many block descriptors yet
-                if (numberOfBlockDescriptors > (maxDescriptorsPerBlock * device->drive_info.IdentifyData.ata.Word105))
+                ranges[numberOfRanges].lba = unmapLogicalBlockAddress;
+                ranges[numberOfRanges].length = unmapNumberOfLogicalBlocks;
+                ++numberOfRanges;
+            }
+            if (ret == SUCCESS)
+            {
+                switch (deallocate_LBA_Ranges(device, ranges, numberOfRanges))
                 {
-                    //not setting sense key specific information because it's not clear in this condition what error we should point to
+                case SUCCESS:
+                    break;
+                //These are returned before any command is sent, so there is no command status to build sense data from
+                case NOT_SUPPORTED:
                     ret = FAILURE;
-                    set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x26, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                    exitLoop = true;
+                    set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x20, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
                     break;
-                }
-                //check that we haven't been asked to TRIM more LBAs than we care to support in this code
-                if (numberOfLBAsToTRIM > (maxDescriptorsPerBlock * device->drive_info.IdentifyData.ata.Word105 * maxUnmapRangePerDescriptor))
-                {
-                    //not setting sense key specific information because it's not clear in this condition what error we should point to
+                case BAD_PARAMETER:
                     ret = FAILURE;
-                    set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x26, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                    exitLoop = true;
+                    set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x21, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
                     break;
-                }
-                //now that we've done all of our checks so far, start setting up the buffer
-                //break this block descriptor into multiple ATA entries if necessary
-                while (unmapNumberOfLogicalBlocks > 0)
-                {
-                    //lba
-                    trimBuffer[ataTrimOffset + 0] = M_Byte5(unmapLogicalBlockAddress);
-                    trimBuffer[ataTrimOffset + 1] = M_Byte4(unmapLogicalBlockAddress);
-                    trimBuffer[ataTrimOffset + 2] = M_Byte3(unmapLogicalBlockAddress);
-                    trimBuffer[ataTrimOffset + 3] = M_Byte2(unmapLogicalBlockAddress);
-                    trimBuffer[ataTrimOffset + 4] = M_Byte1(unmapLogicalBlockAddress);
-                    trimBuffer[ataTrimOffset + 5] = M_Byte0(unmapLogicalBlockAddress);
-                    //range (set for XL vs non-XL commands!)
-                    if (useXL)
-                    {
-                        trimBuffer[ataTrimOffset + 6] = RESERVED;
-                        trimBuffer[ataTrimOffset + 7] = RESERVED;
-                        trimBuffer[ataTrimOffset + 8] = M_Byte7(unmapNumberOfLogicalBlocks);
-                        trimBuffer[ataTrimOffset + 9] = M_Byte6(unmapNumberOfLogicalBlocks);
-                        trimBuffer[ataTrimOffset + 10] = M_Byte5(unmapNumberOfLogicalBlocks);
-                        trimBuffer[ataTrimOffset + 11] = M_Byte4(unmapNumberOfLogicalBlocks);
-                        trimBuffer[ataTrimOffset + 12] = M_Byte3(unmapNumberOfLogicalBlocks);
-                        trimBuffer[ataTrimOffset + 13] = M_Byte2(unmapNumberOfLogicalBlocks);
-                        trimBuffer[ataTrimOffset + 14] = M_Byte1(unmapNumberOfLogicalBlocks);
-                        trimBuffer[ataTrimOffset + 15] = M_Byte0(unmapNumberOfLogicalBlocks);
-                    }
-                    else
-                    {
-                        if (unmapNumberOfLogicalBlocks > UINT16_MAX)
-                        {
-                            trimBuffer[ataTrimOffset + 6] = UINT8_MAX;
-                            trimBuffer[ataTrimOffset + 7] = UINT8_MAX;
-                            unmapNumberOfLogicalBlocks -= UINT16_MAX;
-                            unmapLogicalBlockAddress += UINT16_MAX;
-                        }
-                        else
-                        {
-                            trimBuffer[ataTrimOffset + 6] = M_Byte1(unmapNumberOfLogicalBlocks);
-                            trimBuffer[ataTrimOffset + 7] = M_Byte0(unmapNumberOfLogicalBlocks);
-                        }
-                    }
-                    //now increment the ataTrimOffset
-                    ataTrimOffset += descriptorSize;
-                    //check if the ATA Trim buffer is full...if it is and there are more or potentially more block descriptors, send the command now
-                    if ((ataTrimOffset > (device->drive_info.IdentifyData.ata.Word105 * LEGACY_DRIVE_SEC_SIZE)) && ((unmapBlockDescriptorIter + 16) < minBlockDescriptorLength))
-                    {
-                        //TODO: do we want to make it smart enough to only send as many 512B blocks as necessary without extras?
-                        if (SUCCESS == ata_Data_Set_Management(device, true, trimBuffer, device->drive_info.IdentifyData.ata.Word105 * LEGACY_DRIVE_SEC_SIZE, useXL))
-                        {
-                            //clear the buffer for reuse
-                            memset(trimBuffer, 0, device->drive_info.IdentifyData.ata.Word105 * LEGACY_DRIVE_SEC_SIZE);
-                            //reset the ataTrimOffset
-                            ataTrimOffset = 0;
-                        }
-                        else
-                        {
-                            ret = FAILURE;
-                            set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
-                            exitLoop = true;
-                            break;
-                        }
-                    }
-                }
-                if (exitLoop)
-                {
+                case MEMORY_FAILURE:
+                    ret = FAILURE;
+                    set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ABORTED_COMMAND, 0x55, 0x03, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
                     break;
-                }
-            }
-            if (ret == SUCCESS)
-            {
-                //send the data set management command with whatever is in the trim buffer at this point (all zeros is safe to send if we do get that)
-                //TODO: do we want to make it smart enough to only send as many 512B blocks as necessary without extras?
-                if (SUCCESS != ata_Data_Set_Management(device, true, trimBuffer, device->drive_info.IdentifyData.ata.Word105 * LEGACY_DRIVE_SEC_SIZE, useXL))
-                {
+                default:
                     ret = FAILURE;
                     set_Sense_Data_By_RTFRs(device, &device->drive_info.lastCommandRTFRs, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
+                    break;
                 }
             }
-            safe_Free_aligned(trimBuffer);
+            safe_Return_Device_Buffer(device, rangeBuffer);
         }
     }
     return ret;
@@ -15954,7 +15815,15 @@ int translate_SCSI_Report_Supported_Operation_Codes_Command(tDevice *device, Scs
     switch (reportingOptions)
     {
     case 0://return all op codes (return not supported for now until we get the other methods working...)
-        ret = create_All_Supported_Op_Codes_Buffer(device, rctd, &supportedOpData, &supportedOpDataLength);
+        {
+            const uint8_t *allOpCodes = NULL;
+            uint32_t allOpCodesLength = 0;
+            ret = get_Memoized_Supported_Op_Codes(device, rctd, create_All_Supported_Op_Codes_Buffer, &allOpCodes, &allOpCodesLength);
+            if (ret == SUCCESS && scsiIoCtx->pdata)
+            {
+                memcpy(scsiIoCtx->pdata, allOpCodes, M_Min(allOpCodesLength, allocationLength));
+            }
+        }
         break;
     case 1://check operation code, service action ignored
         //check op code func
@@ -16000,10 +15869,41 @@ int translate_SCSI_Report_Supported_Operation_Codes_Command(tDevice *device, Scs
     return ret;
 }
 
+//Commands that use the capacity or block size from the complete tier of driveInfo. Only these finish lazy discovery so that commands like test unit ready and inquiry do not touch the media.
+static bool satl_Command_Needs_Complete_Drive_Info(ScsiIoCtx *scsiIoCtx)
+{
+    switch (scsiIoCtx->cdb[OPERATION_CODE])
+    {
+    case READ6:
+    case READ10:
+    case READ12:
+    case READ16:
+    case WRITE6:
+    case WRITE10:
+    case WRITE12:
+    case WRITE16:
+    case VERIFY10:
+    case VERIFY12:
+    case VERIFY16:
+    case WRITE_AND_VERIFY_10:
+    case WRITE_AND_VERIFY_12:
+    case WRITE_AND_VERIFY_16:
+    case READ_CAPACITY_10:
+    case UNMAP_CMD:
+    case WRITE_SAME_10_CMD:
+    case WRITE_SAME_16_CMD:
+    case SCSI_FORMAT_UNIT_CMD:
+        return true;
+    case 0x9E:
+        return (scsiIoCtx->cdb[1] & 0x1F) == 0x10;//read capacity 16
+    default:
+        return false;
+    }
+}
+
 //always sets Descriptor type sense data
 int translate_SCSI_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
 {
-    static bool deviceInfoAvailable = false;
     int ret = UNKNOWN;
     bool invalidFieldInCDB = false;
     bool invalidOperationCode = false;
@@ -16050,8 +15950,12 @@ int translate_SCSI_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
         return SUCCESS;
     }
     set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
+    if (satl_Command_Needs_Complete_Drive_Info(scsiIoCtx))
+    {
+        complete_Lazy_Drive_Info_Data(device);
+    }
     //if the ataIdentify data is zero, send an identify at least once so we aren't sending that every time we do a read or write command...inquiry, read capacity will always do one though to get the most recent data
-    if (!deviceInfoAvailable)
+    if (!device->drive_info.softSATFlags.deviceInfoAvailable)
     {
         uint8_t zeroData[LEGACY_DRIVE_SEC_SIZE] = { 0 };
         if (memcmp(&device->drive_info.IdentifyData.ata.Word000, zeroData, LEGACY_DRIVE_SEC_SIZE) == 0)
@@ -16061,7 +15965,7 @@ int translate_SCSI_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
             {
                 return FAILURE;
             }
-            deviceInfoAvailable = true;
+            device->drive_info.softSATFlags.deviceInfoAvailable = true;
             set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
             ////read identify data
             //if (SUCCESS != ata_Identify(device, (uint8_t*)&device->drive_info.IdentifyData.ata.Word000, LEGACY_DRIVE_SEC_SIZE))
@@ -16080,7 +15984,7 @@ int translate_SCSI_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
         }
         else
         {
-            deviceInfoAvailable = true;
+            device->drive_info.softSATFlags.deviceInfoAvailable = true;
         }
     }
     if (device->drive_info.drive_type == ATAPI_DRIVE)
@@ -21,17 +21,11 @@
 int private_SCSI_Send_CDB(ScsiIoCtx *scsiIoCtx, ptrSenseDataFields pSenseFields)
 {
     int ret = UNKNOWN;
-    bool localSenseFieldsAllocated = false;
-    ptrSenseDataFields localSenseFields = NULL;
+    senseDataFields localSenseFields;//on the stack so that sending a command does not need the heap. This also stays correct when a command is sent from inside this function (test unit ready below)
     if (!pSenseFields)
     {
-        localSenseFields = (ptrSenseDataFields)calloc(1, sizeof(senseDataFields));
-        if (!localSenseFields)
-        {
-            return MEMORY_FAILURE;
-        }
-        localSenseFieldsAllocated = true;
-        pSenseFields = localSenseFields;
+        memset(&localSenseFields, 0, sizeof(senseDataFields));
+        pSenseFields = &localSenseFields;
     }
     //clear the last command sense data every single time before we issue any commands
     memset(scsiIoCtx->device->drive_info.lastCommandSenseData, 0, SPC3_SENSE_LEN);
@@ -123,11 +117,6 @@ int private_SCSI_Send_CDB(ScsiIoCtx *scsiIoCtx, ptrSenseDataFields pSenseFields)
             }
         }
     }
-
-    if (localSenseFieldsAllocated)
-    {
-        safe_Free(localSenseFields);
-    }
     return ret;
 }
 
@@ -18,7743 +18,1127 @@
 #include "nvme_helper_func.h"
 #endif
 
-uint16_t calculate_Logical_Block_Guard(uint8_t *buffer, uint32_t userDataLength, uint32_t totalDataLength)
-{
-    uint16_t crc = 0;//Can also be all F's to invert it. TODO: should invert be a boolean option to this function? - TJE
-    uint16_t const polynomial = 0x8BB7L;
-    if (!buffer)
-    {
-        return 0;
-    }
-    for (uint32_t iter = 0; iter < userDataLength && iter < totalDataLength; iter += 2)
-    {
-        uint16_t x = M_BytesTo2ByteValue(buffer[iter], buffer[iter + 1]);
-        for (uint32_t bitIter = 0; bitIter < 16; ++bitIter)
-        {
-            bool bit15Set = ((x & BIT15) == BIT15) ^ ((crc & BIT15) == BIT15);
-            x <<= 1;
-            crc <<= 1;
-            if (bit15Set)
-            {
-                crc ^= polynomial;
-            }
-        }
-
-    }
-    return crc;
-}
-
-//this is mean to only be called by check_Sense_Key_asc_And_ascq()
-void print_sense_key(const char* senseKeyToPrint, uint8_t senseKeyValue)
-{
-    printf("Sense Key: %"PRIX8"h = %s\n", senseKeyValue, senseKeyToPrint);
-    fflush(stdout);
-}
-//this is meant to only be called by check_Sense_Key_asc_And_ascq()
-void print_acs_ascq(const char* acsAndascqStringToPrint, uint8_t ascValue, uint8_t ascqValue)
-{
-    printf("ASC & ASCQ: %"PRIX8"h - %"PRIX8"h = %s\n", ascValue, ascqValue, acsAndascqStringToPrint);
-    fflush(stdout);
-}
-
-//this is meant to only be called by check_Sense_Key_asc_And_ascq()
-void print_Field_Replacable_Unit_Code(tDevice *device, const char *fruMessage, uint8_t fruCode)
-{
-    //we'll only print out a translatable string for seagate drives since fru is vendor specific
-    if (is_Seagate(device, false) == true && fruMessage && device->drive_info.interface_type == SCSI_INTERFACE)
-    {
-        printf("FRU: %"PRIX8"h = %s\n", fruCode, fruMessage);
-        fflush(stdout);
-    }
-    else
-    {
-        if (fruCode == 0)
-        {
-            printf("FRU: %"PRIX8"h = No Additional Information\n", fruCode);
-        }
-        else
-        {
-            printf("FRU: %"PRIX8"h = Vendor Specific\n", fruCode);
-        }
-        fflush(stdout);
-    }
-}
-
-int check_Sense_Key_ASC_ASCQ_And_FRU(tDevice *device, uint8_t senseKey, uint8_t asc, uint8_t ascq, uint8_t fru)
-{
-    int ret = UNKNOWN;//if this gets returned from this function, then something is not right...
-    //first check the senseKey
-    senseKey = senseKey & 0x0F;//strip off bits that are not part of the sense key
-    switch (senseKey)
-    {
-    case SENSE_KEY_NO_ERROR:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("No Error", senseKey);
-        }
-        ret = SUCCESS;
-        break;
-    case SENSE_KEY_RECOVERED_ERROR:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Recovered Error", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_NOT_READY:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Not Ready", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_MEDIUM_ERROR:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Medium Error", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_HARDWARE_ERROR:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Hardware Error", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_ILLEGAL_REQUEST:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Illegal Request", senseKey);
-        }
-        ret = NOT_SUPPORTED;
-        break;
-    case SENSE_KEY_UNIT_ATTENTION:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Unit Attention", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_DATA_PROTECT:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Data Protect", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_BLANK_CHECK:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Blank Check", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_VENDOR_SPECIFIC:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Vendor Specific", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_COPY_ABORTED:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Copy Aborted", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_ABORTED_COMMAND:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Aborted Command", senseKey);
-        }
-        ret = ABORTED;
-        break;
-    case SENSE_KEY_RESERVED:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Reserved", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_VOLUME_OVERFLOW:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Volume Overflow", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_MISCOMPARE:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Miscompare", senseKey);
-        }
-        ret = FAILURE;
-        break;
-    case SENSE_KEY_COMPLETED:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Completed", senseKey);
-        }
-        ret = SUCCESS;
-        break;
-    default:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-        {
-            print_sense_key("Invalid sense key!", senseKey);
-        }
-        return BAD_PARAMETER;
-        break;
-    }
-    //now check the asc and ascq combination...this is going to be very large set of switch cases to do this...
-    //FYI there is no rhyme or reason to the order...I just went through the massive table in SPC4...and only things for direct access block devices were implemented - TJE
-    switch (asc)
-    {
-    case 0x00:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No Additional Sense Information", asc, ascq);
-            }
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Filemark Detected", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("End-Of_Partition/Medium Detected", asc, ascq);
-            }
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Setmark Detected", asc, ascq);
-            }
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Beginning-Of-Partition/Medium Detected", asc, ascq);
-            }
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("End-Of-Data Detected", asc, ascq);
-            }
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("I/O Process Terminated", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Programmable Early Warning Detected", asc, ascq);
-            }
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Audio Play Operation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Audio Play Operation Paused", asc, ascq);
-            }
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Audio Play Operation Successfully Completed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Audio Play Operation Stopped Due To Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No Current Audio Status To Return", asc, ascq);
-            }
-            break;
-        case 0x16:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Operation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x17:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cleaning Requested", asc, ascq);
-            }
-            ret = UNKNOWN;
-            break;
-        case 0x18:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Erase Operation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x19:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Locate Operation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x1A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Rewind Operation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x1B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Set Capacity Operation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x1C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Verify Operation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x1D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ATA Passthrough Information Available", asc, ascq);
-            }
-            ret = UNKNOWN;
-            break;
-        case 0x1E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Conflicting SA Creation Request", asc, ascq);
-            }
-            ret = UNKNOWN;
-            break;
-        case 0x1F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Transitioning To Another Power Condition", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x20:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Extended Copy Information Available", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x21:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Atomic Command Aborted Due To ACA", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x01:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No Index/Sector Signal", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x02:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No Seek Complete", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x03:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Peripheral Device Write Fault", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No Write Current", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Excessive Write Errors", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x04:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Cause Not Reported", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Is In The Process Of Becoming Ready", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Initializing Command Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Manual Intervention Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Format In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Rebuild In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Recalculation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Operation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Self-Test In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Accessible, Asymetric Access State Transition", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Accessible, Target Port In Standby State", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Accessible, Target Port in Unavailable State", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Structure Check Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Security Session In Progress", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Auxilary Memory Not Accessible", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Notify (Enable Spinup) Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, SA Creation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Space Allocation In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Robotics Disabled", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x16:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Configuration Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x17:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Calibration Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x18:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, A Door Is Open", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x19:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Operating In Sequential Mode", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x1A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Start Stop Unit Command In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x1B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Sanitize In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x1C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Additional Power Use Not Yet Granted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x1D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Configuration In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x1E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Microcode Activation Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x1F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Microcode Download Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x20:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Logical Unit Reset Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x21:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Hard Reset Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x22:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Power Cycle Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x23:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Ready, Affiliation Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x05:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Does Not Respond To Selection", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x06:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No Reference Position Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x07:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Multiple Peripheral Devices Selected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x08:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Communication Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Communication Time-Out", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Communication Parity Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Communication CRC Error (Ultra-DMA/32)", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unreachable Copy Target", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x09:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Track Following Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Tracking Servo Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Focus Servo Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Servo Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Head Select Fault", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Vibration Induced Tracking Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x0A:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error Log Overflow", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x0B:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning", asc, ascq);
-            }
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Specified Temperature Exceeded", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Enclosure Degraded", asc, ascq);
-            }
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Background Self-Test Failed", asc, ascq);
-            }
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Background Pre-Scan Detected Medium Error", asc, ascq);
-            }
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Background Media Scan Detected Medium Error", asc, ascq);
-            }
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Non-Volitile Cache Now Volitile", asc, ascq);
-            }
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Degraded Power To Non-Volitile Cache", asc, ascq);
-            }
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Power Loss Expected", asc, ascq);
-            }
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Device Statistics Notification Active", asc, ascq);
-            }
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - High Critical Temperature Limit Exceeded", asc, ascq);
-            }
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Low Critical Temperature Limit Exceeded", asc, ascq);
-            }
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - High Operating Temperature Limit Exceeded", asc, ascq);
-            }
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Low Operating Temperature Limit Exceeded", asc, ascq);
-            }
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - High Critical Humidity Limit Exceeded", asc, ascq);
-            }
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Low Critical Humidity Limit Exceeded", asc, ascq);
-            }
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - High Operating Humidity Limit Exceeded", asc, ascq);
-            }
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Low Operating Humidity Limit Exceeded", asc, ascq);
-            }
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Microcode Security At Risk", asc, ascq);
-            }
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Warning - Microcode Digital Signature Validation Failure", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x0C:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Recovered With Auto Reallocation", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Auto Reallocation Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Recommend Reassignment", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Compression Check Miscompare Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Expansion Occurred During Compression", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Block Not Compressible", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Recovery Needed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Recovery Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Loss Of Streaming", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Padding Blocks Added", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Auxiliary Memory Write Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Unexpected Unsolicited Data", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Not Enough Unsolicited Data", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Multiple Write Errors", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Defects In Error Window", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incomplete Multiple Atomic Write Operations", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Recovery Scan Needed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Error - Insufficient Zone Resources", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x0D:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error Detected By Third Party Temporary Initiator", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Third Party Device Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Target Device Not Reachable", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incorrect Copy Target Device Type", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Target Device Data Underrun", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Target Device Data Overrun", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x0E:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Information Unit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Information Unit Too Short", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Information Unit Too Long", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Field In Command Information Unit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x0F:
-        switch (ascq)
-        {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x10:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ID CRC Or ECC Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Block Guard Check Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Block Application Tag Check Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Block Reference Tag Check Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Block Protection Error On Recover Buffered Data", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Block Protection Method Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x11:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unrecovered Read Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Retries Exhausted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error Too Long To Correct", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Multiple Read Errors", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unrecovered Read Error - Auto Reallocate Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("L-EC Uncorrectable Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("CIRC Unrecovered Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Re-synchonization Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incomplete Block Read", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No Gap Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Miscorrected Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unrecovered Read Error - Recommend Reassignment", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unrecovered Read Error - Recommend Rewrite The Data", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("De-compression CRC Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cannot Decompress Using Declared Algorithm", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error Reading UPC/EAN Number", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error Reading ISRC Number", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Error - Loss Of Streaming", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Auxiliary Memory Read Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Error - Failed Retransmission Request", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Error - LBA Marked Bad By Application Client", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write After Sanitize Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x12:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Address Mark Not Found for ID Field", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x13:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Address Mark Not Found for Data Field", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x14:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recorded Entity Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Record Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Filemark Or Setmark Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("End-Of-Data Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Block Sequence Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Record Not Found - Recommend Reassignment", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Record Not Found - Data Auto-Reallocated", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Locate Operation Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x15:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Random Positioning Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Mechanical Positioning Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Positioning Error Detected By Read Of Medium", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x16:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Synchronization Mark Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Sync Error - Data Rewritten", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Sync Error - Recommend Rewrite", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Sync Error - Data Auto-Reallocation", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Sync Error - Recommend Reassignment", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x17:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With No Error Correction Applied", asc, ascq);
-            }
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With Retries", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With Positive Head Offset", asc, ascq);
-            }
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With Negative Head Offset", asc, ascq);
-            }
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With Retries And/Or CIRC Applied", asc, ascq);
-            }
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data Using Previous Sector ID", asc, ascq);
-            }
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data Without ECC - Data Auto-Reallocated", asc, ascq);
-            }
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data Without ECC - Recommend Reassignment", asc, ascq);
-            }
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data Without ECC - Recommend Rewrite", asc, ascq);
-            }
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data Without ECC - Data Rewritten", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x18:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With Error Correction Applied", asc, ascq);
-            }
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With Error Correction & Retries Applied", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data - Data Auto-Reallocated", asc, ascq);
-            }
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With CIRC", asc, ascq);
-            }
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With L-EC", asc, ascq);
-            }
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data - Recommend Reassignment", asc, ascq);
-            }
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data - Recommend Rewrite", asc, ascq);
-            }
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With ECC - Data Rewritten", asc, ascq);
-            }
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered Data With Linking", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x19:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Defect List Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Defect List Not Available", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Defect List Error In Primary List", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Defect List Error In Grown List", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x1A:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Parameter List Length Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x1B:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Synchronous Data Transfer Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x1C:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Defect List Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Primary Defect List Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Grown Defect List Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x1D:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Miscompare During Verify Operation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Miscompare During Verify Of Unmapped LBA", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x1E:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recovered ID With ECC Correction", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-    case 0x1F:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Partial Defect List Transfer", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x20:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Command Operation Code", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Access Denied - Initiator Pending - Enrolled", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Access Denied - No Access Rights", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Access Denied - Invalid Management ID Key", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Illegal Command While In Write Capable State", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Illegal Command While In Read Capable State", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Illegal Command While In Explicit Address Mode", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Illegal Command While In Implicit Address Mode", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Access Denied - Enrollment Conflict", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Access Denied - Invalid Logical Unit Identifier", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Access Denied - Invalid Proxy Token", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Access Denied - ACL LUN Conflict", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Illegal Command When Not In Append-Only Mode", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Not An Administrative Logical Unit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Not A Subsidiary Logical Unit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Not A Conglomerate Logical Unit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x21:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Block Address Out Of Range", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Element Address", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Address For Write", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Write Crossing Layer Jump", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unaligned Write Command", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Boundary Violation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Attempt To Read Invalid Data", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Boundary Violation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Misaligned Write Command", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x22:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Illegal Function. Use 22 00, 24 00, or 26 00", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x23:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Cause Not Reportable", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Unsupported Token Type", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Remote Token Usage Not Supported", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Remote ROD Token Creation Not Supported", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Token Unknown", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Token Corrupt", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Token Revoked", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Token Expired", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Token Cancelled", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Token Deleted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Token Operation - Invalid Token Length", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x24:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Field In CDB", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("CDB Decryption Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid CDB Field While In Explicit Block Address Model", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid CDB Field While In Implicit Block Address Model", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Security Audit Value Frozen", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Security Working Key Frozen", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Nonce Not Unique", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Nonce Timestamp Out Of Range", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid XCDB", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Fast Format", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x25:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Supported", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x26:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Field In Parameter List", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Parameter Not Supported", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Parameter Value Invalid", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Threshold Parameters Not Supported", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Release Of Persistent Reservation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Decryption Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Too Many Target Descriptors", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unsupported Target Descriptor Type Code", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Too Many Segment Descriptors", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unsupported Segment Descriptor Type Code", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unexpected Inexact Segment", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Inline Data Length Exceeded", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Operation For Copy Source Or Destination", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Segment Granularity Violation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Parameter While Port Is Enabled", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Data-Out Buffer Integrity Check Value", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Decryption Key Fail Limit Reached", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incomplete Key-Associated Data Set", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Vendor Specific Key Reference Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Application Tag Mode Page Is Invalid", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Tape Stream Mirroring Prevented", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Source Or Copy Destination Not Authorized", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x27:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Protected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Write Protected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Software Write Protected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Associated Write Protect", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Persistent Write Protect", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Permanent Write Protect", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Conditional Write Protect", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Space Allocation Failed Write Protect", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Zone Is Read Only", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x28:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Not Ready To Ready Change, Medium May Have Changed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Import or Export Element Accessed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Format-Layer May Have Changed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Import/Export Element Accessed, Medium Changed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x29:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power On, Reset, Or Bus Device Reset Occurred", asc, ascq);
-            }
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power On Occurred", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("SCSI Bus Reset Occurred", asc, ascq);
-            }
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Bus Device Reset Function Occurred", asc, ascq);
-            }
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Device Internal Reset", asc, ascq);
-            }
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Transceiver Mode Changed To Single-Ended", asc, ascq);
-            }
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Transceiver Mode Changed To LVD", asc, ascq);
-            }
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("I_T Nexus Loss Occurred", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x2A:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Parameters Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Mode Parameters Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Log Parameters Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Reservations Preempted", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Reservations Released", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Registrations Preempted", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Asymmetric Access State Changed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Implicit Asymetric Access State Transition Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Priority Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Capacity Data Has Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error History I_T Nexus Cleared", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error History Snapshot Released", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error Recovery Attributes Have Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Encryption Capabilities Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Timestamp Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Encryption Parameters Changed By Another I_T Nexus", asc, ascq);
-            }
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Encryption Parameters Changed By Vendor Specific Event", asc, ascq);
-            }
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Encryption Key Instance Counter Has Changed", asc, ascq);
-            }
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("SA Creation Capabilities Has Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Removal Precention Preempted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x16:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Zone Reset Write Pointer Recommended", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x2B:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Cannot Execute Since Host Cannot Disconnect", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x2C:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Command Sequence Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Too Many Windows Specified", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Combination Of Windows Specified", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Current Program Area Is Not Empty", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Current Program Area Is Empty", asc, ascq);
-            }
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Illegal Power Condition Request", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Persistent Prevent Conflict", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Previous Busy Status", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Previous Task Set Full Status", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Previous Reservation Conflict Status", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Partition Or Collection Contains User Objects", asc, ascq);
-            }
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Not Reserved", asc, ascq);
-            }
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ORWrite Generation Does Not Match", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Reset Write Pointer Not Allowed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Zone Is Offline", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Stream Not Open", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unwritten Data In Zone", asc, ascq);
-            }
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Descriptor Format Sense Data Required", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x2D:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Overwrite Error On Update In Place", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x2E:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Time For Operation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Command Timeout Before Processing", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Command Timeout During Processing", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Command Timeout During Processing Due To Error Recovery", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x2F:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Commands Cleared By Another Initiator", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Commands Cleared By Power Loss Notification", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Commands Cleared By Device Server", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Some Commands Cleared By Queuing Layer Event", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        /*case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Space Allocation Failed Write Protect", asc, ascq);
-            }
-            ret = FAILURE;
-            break;*/
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x30:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incompatible Medium Installed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cannot Read Medium - Unknown Format", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cannot Read Medium - Incompatible Format", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cleaning Cartridge Installed", asc, ascq);
-            }
-            ret = UNKNOWN;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cannot Write Medium - Unknown Format", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cannot Write Medium - Incompatible Format", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cannot Format Medium - Incompatible Medium", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cleaning Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cannot Write - Application Code Mismatch", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Current Session Not Fixated For Append", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cleaning Request Rejected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("WORM Medium - Overwrite Attempted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("WORM Medium - Integrity Check", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Not Formatted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incompatible Volume Type", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incompatible Volume Qualifier", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cleaning Volume Expired", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x31:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Format Corrupted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Format Command Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Zoned Formatting Failed Due To Spare Linking", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Sanitize Command Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x32:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No Defect Space Location Available", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Defect List Update Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x33:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Tape Length Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x34:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Enclosure Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x35:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Enclosure Services Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unsupported Enclosure Function", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Enclosure Services Unavailable", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Enclosure Services Transfer Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Enclosure Services Transfer Refused", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Enclosure Services Checksum Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x36:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Ribbon, Ink, Or Toner Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x37:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Rounded Parameter", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x38:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Event Status Notification", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ESN - Power Management Class Event", asc, ascq);
-            }
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ESN - Media Class Event", asc, ascq);
-            }
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ESN - Device Busy Class Event", asc, ascq);
-            }
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Thin Provisioning Soft Threshold Reached", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x39:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Saving Parameters Not Supported", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x3A:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Not Present", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Not Present - Tray Closed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Not Present - Tray Open", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Not Present - Loadable", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Not Present - Medium Auxilary Memory Accessible", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x3B:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Sequential Positioning Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Tape Position Error At Beginning-Of-Medium", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Tape Position Error At End-Of-Medium", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Tape Or Electronic Vertical Forms Unit Not Ready", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Slew Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Paper Jam", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Failed To Sense Top-Of-Form", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Failed To Sense Bottom-Of-Form", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Reposition Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Past End Of Medium", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Past Beginning Of Medium", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Position Past End Of Medium", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Position Past Beginning Of Medium", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Destination Element Full", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Source Element Empty", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("End Of Medium Reached", asc, ascq);
-            }
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Magazine Not Accessible", asc, ascq);
-            }
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Magazine Removed", asc, ascq);
-            }
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Magazine Inserted", asc, ascq);
-            }
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Magazine Locked", asc, ascq);
-            }
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Magazine Unlocked", asc, ascq);
-            }
-            break;
-        case 0x16:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Mechanical Positioning Or Changer Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x17:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Past End Of User Object", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x18:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Element Disabled", asc, ascq);
-            }
-            break;
-        case 0x19:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Element Enabled", asc, ascq);
-            }
-            break;
-        case 0x1A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Transfer Device Removed", asc, ascq);
-            }
-            break;
-        case 0x1B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Transfer Device Inserted", asc, ascq);
-            }
-            break;
-        case 0x1C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Too Many Logical Objects On Partition To Supported Operation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x3C:
-        switch (ascq)
-        {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x3D:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Bits In Identify Message", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x3E:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Has Not Self-Configured Yet", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Timeout On Logical Unit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Failed Self-Test", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Unable to Update Self-Test Log", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x3F:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Target Operating Conditions Have Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Microcode Has Been Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Changed Operation Definition", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Inquiry Data Has Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Component Device Attached", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Device Identifier Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Redundancy Group Created Or Modified", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Redundancy Group Deleted", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spare Created Or Modified", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spare Deleted", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Volume Set Created Or Modified", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Volume Set Deleted", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Volume Set Deassigned", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Volume Set Reassigned", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Reported LUNs Data Has Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Echo Buffer Overwritten", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Loadable", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Auxilary Memory Accessible", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("iSCSI IP Address Added", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("iSCSI IP Address Removed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("iSCSI IP Address Changed", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Inspect Referrals Sense Descriptors", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x16:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Microcode Has Been Changed Without Reset", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x17:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Zone Transition To Full", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x18:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Bind Completed", asc, ascq);
-            }
-            break;
-        case 0x19:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Bind Redirected", asc, ascq);
-            }
-            break;
-        case 0x1A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Subsidiary Binding Changed", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x40:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("RAM Failure (Should Use 40 NN) ", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (ascq >= 0x80 && ascq <= 0xFF)
-            {
-                if (VERBOSITY_COMMAND_NAMES <= device->deviceVerbosity)
-                {
-                    printf("asc & ascq: %" PRIX8 "h - %" PRIX8 "h = Diagnostic Failure On Component %02" PRIX8 "h\n", asc, ascq, ascq);
-                }
-                ret = FAILURE;
-            }
-            else
-            {
-                if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-                ret = UNKNOWN;
-            }
-            break;
-        }
-        break;
-    case 0x41:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Path Failure (Should Use 40NN)", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x42:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power-on Or Self-Test Failure (Should use 40 NN)", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-    case 0x43:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Message Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x44:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Internal Target Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Persistent Reservation Information Lost", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x71:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ATA Device Failed Set Features", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x45:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Select Or Reselect Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x46:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unsuccessful Soft Reset", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x47:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("SCSI Parity Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Phase CRC Error Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("SCSI Parity Error Detected During ST Data Phase", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Information Unit uiCRC Error Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Asynchronous Information Protection Error Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Protocol Service CRC Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PHY Test Function In Progress", asc, ascq);
-            }
-            ret = IN_PROGRESS;
-            break;
-        case 0x7F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Some Commands Cleared By ISCSI Protocol Event", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x48:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Initiator Detected Error Message Received", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x49:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Message Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x4A:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Command Phase Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x4B:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Phase Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Target Port Transfer Tag Received", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Too Much Write Data", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ACK/NAK Timeout", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("NAK Received", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Offset Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Initiator Response Timeout", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Connection Lost", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data-In Buffer Overflow - Data Buffer Size", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data-In Buffer Overflow - Data Buffer Descriptor Area", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data-In Buffer Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data-Out Buffer Overflow - Data Buffer Size", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data-Out Buffer Overflow - Data Buffer Descriptor Area", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data-Out Buffer Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PCIE Fabric Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PCIE Completion Timeout", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PCIE Completer Abort", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PCIE Poisoned TLP Received", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PCIE ECRC Check Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PCIE Unsupported Request", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PCIE ACS Violation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("PCIE TLP Prefix Blocked", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x4C:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Failed Self-Configuration", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x4D:
-        switch (ascq)
-        {
-        default:
-            if (VERBOSITY_COMMAND_NAMES <= device->deviceVerbosity)
-            {
-                printf("asc & ascq: %" PRIX8 "h - %" PRIX8 "h = Tagged Overlapped Commands. Task Tag = %02" PRIX8 "h\n", asc, ascq, ascq);
-            }
-            break;
-        }
-        break;
-    case 0x4E:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Overlapped Commands Attempted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x4F:
-        switch (ascq)
-        {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x50:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Append Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Write Append Position Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Position Error Related To Timing", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x51:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Erase Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Erase Failure - Incomplete Erase Operation Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x52:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cartridge Fault", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x53:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Media Load Or Eject Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unload Tape Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Removal Prevented", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Removal Prevented By Data Transfer Element", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Thread Or Unthread Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Volume Identifier Invalid", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Volume Identifier Missing", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Duplicate Volume Identifier", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Element Status Unknown", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Transfer Device Error - Load Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Transfer Device Error - Unload Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Transfer Device Error - Unload Missing", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Transfer Device Error - Eject Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Transfer Device Error - Library Communication Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x54:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("SCSI To host System Interface Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x55:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("System Resource Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("System Buffer Full", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Reservation Resources", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Resources", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Registration Resources", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Access Control Resources", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Auxiliary Memory Out Of Space", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Quota Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Maximum Number Of Supplemental Decryption Keys Exceeded", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Medium Auxilary Memory Not Accessible", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Currently Unavailable", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Power For Operation", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Resources To Create ROD", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Resources To Create ROD Token", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Zone Resources", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Zone Resources To Complete Write", asc, ascq);
-            }
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Maximum Number Of Streams Open", asc, ascq);
-            }
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Resources To Bind", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x56:
-        switch (ascq)
-        {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x57:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unable To Recover Table-Of-Contents", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (ascq >= 0x80 && ascq <= 0xFF)
-            {
-                print_acs_ascq("Vendor specific ascq code", asc, ascq);
-            }
-            else
-            {
-                print_acs_ascq("Unknown ascq code", asc, ascq);
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x58:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Generation Does Not Exist", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x59:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Updated Block Read", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x5A:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Operator Request Or State Change Input", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Operator Medium Removal Request", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Operator Selected Write Protect", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Operator Selected Write Permit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x5B:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Log Exception", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Threshold Condition Met", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Log Counter At Maximum", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Log List Codes Exhausted", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x5C:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("RPL Status Change", asc, ascq);
-            }
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindles Synchronized", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindles Not Synchronized", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x5D:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Failure Prediction Threshold Exceeded", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Media Failure Prediction Threshold Exceeded", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Failure Prediction Threshold Exceeded", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spare Area Exhaustion Prediction Threshold Exceeded", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - General Hard Drive Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Drive Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Data Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x13:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Seek Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x14:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Too Many Block Reassigns", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x15:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Access Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x16:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Start Unit Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x17:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Channel Parametrics", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x18:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Controller Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x19:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Throughput Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x1A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Seek Time Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x1B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Spin-Up Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x1C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Drive Calibration Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x1D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Hardware Impending Failure - Power Loss Protection Circuit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x20:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - General Hard Drive Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x21:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Drive Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x22:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Data Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x23:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Seek Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x24:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Too Many Block Reassigns", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x25:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Access Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x26:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Start Unit Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x27:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Channel Parametrics", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x28:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Controller Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x29:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Throughput Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x2A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Seek Time Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x2B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Spin-Up Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x2C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Controller Impending Failure - Drive Calibration Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x30:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - General Hard Drive Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x31:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Drive Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x32:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Data Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x33:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Seek Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x34:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Too Many Block Reassigns", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x35:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Access Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x36:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Start Unit Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x37:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Channel Parametrics", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x38:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Controller Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x39:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Throughput Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x3A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Seek Time Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x3B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Spin-Up Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x3C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Channel Impending Failure - Drive Calibration Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x40:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - General Hard Drive Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x41:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Drive Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x42:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Data Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x43:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Seek Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x44:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Too Many Block Reassigns", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x45:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Access Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x46:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Start Unit Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x47:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Channel Parametrics", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x48:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Controller Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x49:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Throughput Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x4A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Seek Time Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x4B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Spin-Up Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x4C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Servo Impending Failure - Drive Calibration Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x50:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - General Hard Drive Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x51:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Drive Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x52:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Data Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x53:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Seek Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x54:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Too Many Block Reassigns", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x55:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Access Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x56:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Start Unit Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x57:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Channel Parametrics", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x58:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Controller Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x59:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Throughput Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x5A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Seek Time Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x5B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Spin-Up Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x5C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Spindle Impending Failure - Drive Calibration Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x60:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - General Hard Drive Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x61:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Drive Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x62:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Data Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x63:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Seek Error Rate Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x64:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Too Many Block Reassigns", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x65:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Access Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x66:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Start Unit Times Too High", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x67:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Channel Parametrics", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x68:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Controller Detected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x69:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Throughput Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x6A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Seek Time Performance", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x6B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Spin-Up Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x6C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Firmware Impending Failure - Drive Calibration Retry Count", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x73:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Media Impending Failure Endurance Limit Met", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0xFF:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Failure Prediction Threshold Exceeded (False)", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x5E:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Low Power Condition On", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Idle Condition Activated By Timer", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Standby Condition Activated By Timer", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Idle Condition Activated By Command", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Standby Condition Activated By Command", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Idle_B Condition Activated By Timer", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Idle_B Condition Activated By Command", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Idle_C Condition Activated By Timer", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Idle_C Condition Activated By Command", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Standby_Y Condition Activated By Timer", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Standby_Y Condition Activated By Command", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x41:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power State Change To Active", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x42:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power State Change To Idle", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x43:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power State Change To Standby", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x45:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power State Change To Sleep", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        case 0x47:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power State Change To Device Control", asc, ascq);
-            }
-            ret = SUCCESS;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x5F:
-        switch (ascq)
-        {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x60:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Lamp Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x61:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Video ascuisition Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unable To ascuire Video", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Out Of Focus", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x62:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Scan Head Positioning Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x63:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("End Of User Area Encountered On This Track", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Packet Does Not Fit In Available Space", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x64:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Illegal Mode For This Track", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Packet Size", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x65:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Voltage Fault", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x66:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Automatic Document Feeder Cover Up", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Automatic Document Feeder Lift Up", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Document Jam In Automatic Document Feeder", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Document Miss Feed Automatic In Document Feeder", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x67:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Configuration Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Configuration Of Incapable Logical Units Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Add Logical Unit Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Modification Of Logical Unit Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Exchange Of Logical Unit Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Remove Of Logical Unit Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Attachment Of Logical Unit Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Creation Of Logical Unit Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Assign Failure Occurred", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Multiply Assigned Logical Unit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Set Target Port Groups Command Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("ATA Device Feature Not Enabled", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Command Rejected", asc, ascq);
-            }
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Explicit Bind Not Allowed", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x68:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Not Configured", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Subsidiary Logical Unit Not Configured", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x69:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Loss On Logical Unit", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Multiple Logical Unit Failures", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Parity/Data Mismatch", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x6A:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Informational, Refer To Log", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x6B:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("State Change Has Occurred", asc, ascq);
-            }
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Redundancy Level Got Better", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Redundancy Level Got Worse", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x6C:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Rebuild Failure Occurred", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x6D:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Recalculate Failure Occurred", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x6E:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Command To Logical Unit Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x6F:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Protection Key Exchange Failure - Authentication Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Protection Key Exchange Failure - Key Not Present", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Copy Protection Key Exchange Failure - Key Not Established", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Read Of Scrambled Sector Without Authentication", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Media Region Code Is Mismatched To Logical Unit Region", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Drive Region Must Be Permanent/Region Reset Count Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Block Count For Binding Nonce Recording", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Conflict In Binding Nonce Recording", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Insufficient Permission", asc, ascq);
-            }
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid Drive-Host Pairing Server", asc, ascq);
-            }
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Drive-Host Pairing Suspended", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x70:
-        if (device->deviceVerbosity >= VERBOSITY_COMMAND_NAMES)
-        {
-            printf("asc & ascq: %" PRIX8 "h - %" PRIX8 "h = Decompression Exception Short Algorithm ID of %" PRIX8 "", asc, ascq, ascq);
-        }
-        break;
-    case 0x71:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Decompression Exception Long Algorithm ID", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x72:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Session Fixation Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Session Fixation Error Writing Lead-In", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Session Fixation Error Writing Lead-Out", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Session Fixation Error - Incomplete Track In Session", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Empty Or Partially Written Reserved Track", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No More Track Reservations Allowed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("RMZ Extension Is Not Allowed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("No More Test Zone Extensions Are Allowed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x73:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("CD Control Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power Calibration Area Almost Full", asc, ascq);
-            }
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power Calibration Area Is Full", asc, ascq);
-            }
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Power Calibration Area Error", asc, ascq);
-            }
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Program Memory Area Update Failuer", asc, ascq);
-            }
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Program Memory Area Is Full", asc, ascq);
-            }
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("RMA/PMA Is Almost Full", asc, ascq);
-            }
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Current Power Calibration Area Almost Full", asc, ascq);
-            }
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Current Power Calibration Area Is Full", asc, ascq);
-            }
-            break;
-        case 0x17:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("RDZ Is Full", asc, ascq);
-            }
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x74:
-        switch (ascq)
-        {
-        case 0x00:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Security Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x01:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unable To Decrypt Data", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x02:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unencrypted Data Encountered While Decrypting", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x03:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incorrect Data Encryption Key", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x04:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Cryptographic Integrity Validation Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x05:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Error Decrypting Data", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x06:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unknown Signature Verification Key", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x07:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Encryption Parameters Not Useable", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x08:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Digital Signature Validation Failure", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x09:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Encryption Mode Mismatch On Read", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0A:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Encrypted Block Not Raw Read Enabled", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0B:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Incorrect Encryption Parameters", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0C:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Unable To Decrypt Parameter List", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x0D:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Encryption Algorithm Disabled", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x10:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("SA Creation Parameter Value Invalid", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x11:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("SA Creation Parameter Value Rejected", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x12:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Invalid SA Usage", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x21:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Data Encryption Configuration Prevented", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x30:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("SA Creation Parameter Not Supported", asc, ascq);
-            }
-            ret = NOT_SUPPORTED;
-            break;
-        case 0x40:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Authenticaion Failed", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x61:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("External Data Encryption Key Manager Access Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x62:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("External Data Encryption Key Manager Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x63:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("External Data Encryption Key Not Found", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x64:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("External Data Encryption Request Not Authorized", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x6E:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("External Data Encryption Control Timeout", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x6F:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("External Data Encryption Control Error", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x71:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Logical Unit Access Not Authorized", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        case 0x79:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                print_acs_ascq("Security Conflict In Translated Device", asc, ascq);
-            }
-            ret = FAILURE;
-            break;
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x75:
-        switch (ascq)
-        {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
-        }
-        break;
-    case 0x76:
-        switch (ascq)
+//T10-DIF guard CRC (polynomial 8BB7h) lookup tables for slicing-by-8.
+//Table 0 is the CRC of a single byte. Table N is the CRC of a byte followed by N zero bytes, so 8 bytes of data are processed with 8 independent lookups.
+static const uint16_t t10DifCrcTable[8][256] = {
+    {
+        0x0000, 0x8BB7, 0x9CD9, 0x176E, 0xB205, 0x39B2, 0x2EDC, 0xA56B, 0xEFBD, 0x640A, 0x7364, 0xF8D3, 0x5DB8, 0xD60F, 0xC161, 0x4AD6,
+        0x54CD, 0xDF7A, 0xC814, 0x43A3, 0xE6C8, 0x6D7F, 0x7A11, 0xF1A6, 0xBB70, 0x30C7, 0x27A9, 0xAC1E, 0x0975, 0x82C2, 0x95AC, 0x1E1B,
+        0xA99A, 0x222D, 0x3543, 0xBEF4, 0x1B9F, 0x9028, 0x8746, 0x0CF1, 0x4627, 0xCD90, 0xDAFE, 0x5149, 0xF422, 0x7F95, 0x68FB, 0xE34C,
+        0xFD57, 0x76E0, 0x618E, 0xEA39, 0x4F52, 0xC4E5, 0xD38B, 0x583C, 0x12EA, 0x995D, 0x8E33, 0x0584, 0xA0EF, 0x2B58, 0x3C36, 0xB781,
+        0xD883, 0x5334, 0x445A, 0xCFED, 0x6A86, 0xE131, 0xF65F, 0x7DE8, 0x373E, 0xBC89, 0xABE7, 0x2050, 0x853B, 0x0E8C, 0x19E2, 0x9255,
+        0x8C4E, 0x07F9, 0x1097, 0x9B20, 0x3E4B, 0xB5FC, 0xA292, 0x2925, 0x63F3, 0xE844, 0xFF2A, 0x749D, 0xD1F6, 0x5A41, 0x4D2F, 0xC698,
+        0x7119, 0xFAAE, 0xEDC0, 0x6677, 0xC31C, 0x48AB, 0x5FC5, 0xD472, 0x9EA4, 0x1513, 0x027D, 0x89CA, 0x2CA1, 0xA716, 0xB078, 0x3BCF,
+        0x25D4, 0xAE63, 0xB90D, 0x32BA, 0x97D1, 0x1C66, 0x0B08, 0x80BF, 0xCA69, 0x41DE, 0x56B0, 0xDD07, 0x786C, 0xF3DB, 0xE4B5, 0x6F02,
+        0x3AB1, 0xB106, 0xA668, 0x2DDF, 0x88B4, 0x0303, 0x146D, 0x9FDA, 0xD50C, 0x5EBB, 0x49D5, 0xC262, 0x6709, 0xECBE, 0xFBD0, 0x7067,
+        0x6E7C, 0xE5CB, 0xF2A5, 0x7912, 0xDC79, 0x57CE, 0x40A0, 0xCB17, 0x81C1, 0x0A76, 0x1D18, 0x96AF, 0x33C4, 0xB873, 0xAF1D, 0x24AA,
+        0x932B, 0x189C, 0x0FF2, 0x8445, 0x212E, 0xAA99, 0xBDF7, 0x3640, 0x7C96, 0xF721, 0xE04F, 0x6BF8, 0xCE93, 0x4524, 0x524A, 0xD9FD,
+        0xC7E6, 0x4C51, 0x5B3F, 0xD088, 0x75E3, 0xFE54, 0xE93A, 0x628D, 0x285B, 0xA3EC, 0xB482, 0x3F35, 0x9A5E, 0x11E9, 0x0687, 0x8D30,
+        0xE232, 0x6985, 0x7EEB, 0xF55C, 0x5037, 0xDB80, 0xCCEE, 0x4759, 0x0D8F, 0x8638, 0x9156, 0x1AE1, 0xBF8A, 0x343D, 0x2353, 0xA8E4,
+        0xB6FF, 0x3D48, 0x2A26, 0xA191, 0x04FA, 0x8F4D, 0x9823, 0x1394, 0x5942, 0xD2F5, 0xC59B, 0x4E2C, 0xEB47, 0x60F0, 0x779E, 0xFC29,
+        0x4BA8, 0xC01F, 0xD771, 0x5CC6, 0xF9AD, 0x721A, 0x6574, 0xEEC3, 0xA415, 0x2FA2, 0x38CC, 0xB37B, 0x1610, 0x9DA7, 0x8AC9, 0x017E,
+        0x1F65, 0x94D2, 0x83BC, 0x080B, 0xAD60, 0x26D7, 0x31B9, 0xBA0E, 0xF0D8, 0x7B6F, 0x6C01, 0xE7B6, 0x42DD, 0xC96A, 0xDE04, 0x55B3
+    },
+    {
+        0x0000, 0x7562, 0xEAC4, 0x9FA6, 0x5E3F, 0x2B5D, 0xB4FB, 0xC199, 0xBC7E, 0xC91C, 0x56BA, 0x23D8, 0xE241, 0x9723, 0x0885, 0x7DE7,
+        0xF34B, 0x8629, 0x198F, 0x6CED, 0xAD74, 0xD816, 0x47B0, 0x32D2, 0x4F35, 0x3A57, 0xA5F1, 0xD093, 0x110A, 0x6468, 0xFBCE, 0x8EAC,
+        0x6D21, 0x1843, 0x87E5, 0xF287, 0x331E, 0x467C, 0xD9DA, 0xACB8, 0xD15F, 0xA43D, 0x3B9B, 0x4EF9, 0x8F60, 0xFA02, 0x65A4, 0x10C6,
+        0x9E6A, 0xEB08, 0x74AE, 0x01CC, 0xC055, 0xB537, 0x2A91, 0x5FF3, 0x2214, 0x5776, 0xC8D0, 0xBDB2, 0x7C2B, 0x0949, 0x96EF, 0xE38D,
+        0xDA42, 0xAF20, 0x3086, 0x45E4, 0x847D, 0xF11F, 0x6EB9, 0x1BDB, 0x663C, 0x135E, 0x8CF8, 0xF99A, 0x3803, 0x4D61, 0xD2C7, 0xA7A5,
+        0x2909, 0x5C6B, 0xC3CD, 0xB6AF, 0x7736, 0x0254, 0x9DF2, 0xE890, 0x9577, 0xE015, 0x7FB3, 0x0AD1, 0xCB48, 0xBE2A, 0x218C, 0x54EE,
+        0xB763, 0xC201, 0x5DA7, 0x28C5, 0xE95C, 0x9C3E, 0x0398, 0x76FA, 0x0B1D, 0x7E7F, 0xE1D9, 0x94BB, 0x5522, 0x2040, 0xBFE6, 0xCA84,
+        0x4428, 0x314A, 0xAEEC, 0xDB8E, 0x1A17, 0x6F75, 0xF0D3, 0x85B1, 0xF856, 0x8D34, 0x1292, 0x67F0, 0xA669, 0xD30B, 0x4CAD, 0x39CF,
+        0x3F33, 0x4A51, 0xD5F7, 0xA095, 0x610C, 0x146E, 0x8BC8, 0xFEAA, 0x834D, 0xF62F, 0x6989, 0x1CEB, 0xDD72, 0xA810, 0x37B6, 0x42D4,
+        0xCC78, 0xB91A, 0x26BC, 0x53DE, 0x9247, 0xE725, 0x7883, 0x0DE1, 0x7006, 0x0564, 0x9AC2, 0xEFA0, 0x2E39, 0x5B5B, 0xC4FD, 0xB19F,
+        0x5212, 0x2770, 0xB8D6, 0xCDB4, 0x0C2D, 0x794F, 0xE6E9, 0x938B, 0xEE6C, 0x9B0E, 0x04A8, 0x71CA, 0xB053, 0xC531, 0x5A97, 0x2FF5,
+        0xA159, 0xD43B, 0x4B9D, 0x3EFF, 0xFF66, 0x8A04, 0x15A2, 0x60C0, 0x1D27, 0x6845, 0xF7E3, 0x8281, 0x4318, 0x367A, 0xA9DC, 0xDCBE,
+        0xE571, 0x9013, 0x0FB5, 0x7AD7, 0xBB4E, 0xCE2C, 0x518A, 0x24E8, 0x590F, 0x2C6D, 0xB3CB, 0xC6A9, 0x0730, 0x7252, 0xEDF4, 0x9896,
+        0x163A, 0x6358, 0xFCFE, 0x899C, 0x4805, 0x3D67, 0xA2C1, 0xD7A3, 0xAA44, 0xDF26, 0x4080, 0x35E2, 0xF47B, 0x8119, 0x1EBF, 0x6BDD,
+        0x8850, 0xFD32, 0x6294, 0x17F6, 0xD66F, 0xA30D, 0x3CAB, 0x49C9, 0x342E, 0x414C, 0xDEEA, 0xAB88, 0x6A11, 0x1F73, 0x80D5, 0xF5B7,
+        0x7B1B, 0x0E79, 0x91DF, 0xE4BD, 0x2524, 0x5046, 0xCFE0, 0xBA82, 0xC765, 0xB207, 0x2DA1, 0x58C3, 0x995A, 0xEC38, 0x739E, 0x06FC
+    },
+    {
+        0x0000, 0x7E66, 0xFCCC, 0x82AA, 0x722F, 0x0C49, 0x8EE3, 0xF085, 0xE45E, 0x9A38, 0x1892, 0x66F4, 0x9671, 0xE817, 0x6ABD, 0x14DB,
+        0x430B, 0x3D6D, 0xBFC7, 0xC1A1, 0x3124, 0x4F42, 0xCDE8, 0xB38E, 0xA755, 0xD933, 0x5B99, 0x25FF, 0xD57A, 0xAB1C, 0x29B6, 0x57D0,
+        0x8616, 0xF870, 0x7ADA, 0x04BC, 0xF439, 0x8A5F, 0x08F5, 0x7693, 0x6248, 0x1C2E, 0x9E84, 0xE0E2, 0x1067, 0x6E01, 0xECAB, 0x92CD,
+        0xC51D, 0xBB7B, 0x39D1, 0x47B7, 0xB732, 0xC954, 0x4BFE, 0x3598, 0x2143, 0x5F25, 0xDD8F, 0xA3E9, 0x536C, 0x2D0A, 0xAFA0, 0xD1C6,
+        0x879B, 0xF9FD, 0x7B57, 0x0531, 0xF5B4, 0x8BD2, 0x0978, 0x771E, 0x63C5, 0x1DA3, 0x9F09, 0xE16F, 0x11EA, 0x6F8C, 0xED26, 0x9340,
+        0xC490, 0xBAF6, 0x385C, 0x463A, 0xB6BF, 0xC8D9, 0x4A73, 0x3415, 0x20CE, 0x5EA8, 0xDC02, 0xA264, 0x52E1, 0x2C87, 0xAE2D, 0xD04B,
+        0x018D, 0x7FEB, 0xFD41, 0x8327, 0x73A2, 0x0DC4, 0x8F6E, 0xF108, 0xE5D3, 0x9BB5, 0x191F, 0x6779, 0x97FC, 0xE99A, 0x6B30, 0x1556,
+        0x4286, 0x3CE0, 0xBE4A, 0xC02C, 0x30A9, 0x4ECF, 0xCC65, 0xB203, 0xA6D8, 0xD8BE, 0x5A14, 0x2472, 0xD4F7, 0xAA91, 0x283B, 0x565D,
+        0x8481, 0xFAE7, 0x784D, 0x062B, 0xF6AE, 0x88C8, 0x0A62, 0x7404, 0x60DF, 0x1EB9, 0x9C13, 0xE275, 0x12F0, 0x6C96, 0xEE3C, 0x905A,
+        0xC78A, 0xB9EC, 0x3B46, 0x4520, 0xB5A5, 0xCBC3, 0x4969, 0x370F, 0x23D4, 0x5DB2, 0xDF18, 0xA17E, 0x51FB, 0x2F9D, 0xAD37, 0xD351,
+        0x0297, 0x7CF1, 0xFE5B, 0x803D, 0x70B8, 0x0EDE, 0x8C74, 0xF212, 0xE6C9, 0x98AF, 0x1A05, 0x6463, 0x94E6, 0xEA80, 0x682A, 0x164C,
+        0x419C, 0x3FFA, 0xBD50, 0xC336, 0x33B3, 0x4DD5, 0xCF7F, 0xB119, 0xA5C2, 0xDBA4, 0x590E, 0x2768, 0xD7ED, 0xA98B, 0x2B21, 0x5547,
+        0x031A, 0x7D7C, 0xFFD6, 0x81B0, 0x7135, 0x0F53, 0x8DF9, 0xF39F, 0xE744, 0x9922, 0x1B88, 0x65EE, 0x956B, 0xEB0D, 0x69A7, 0x17C1,
+        0x4011, 0x3E77, 0xBCDD, 0xC2BB, 0x323E, 0x4C58, 0xCEF2, 0xB094, 0xA44F, 0xDA29, 0x5883, 0x26E5, 0xD660, 0xA806, 0x2AAC, 0x54CA,
+        0x850C, 0xFB6A, 0x79C0, 0x07A6, 0xF723, 0x8945, 0x0BEF, 0x7589, 0x6152, 0x1F34, 0x9D9E, 0xE3F8, 0x137D, 0x6D1B, 0xEFB1, 0x91D7,
+        0xC607, 0xB861, 0x3ACB, 0x44AD, 0xB428, 0xCA4E, 0x48E4, 0x3682, 0x2259, 0x5C3F, 0xDE95, 0xA0F3, 0x5076, 0x2E10, 0xACBA, 0xD2DC
+    },
+    {
+        0x0000, 0x82B5, 0x8EDD, 0x0C68, 0x960D, 0x14B8, 0x18D0, 0x9A65, 0xA7AD, 0x2518, 0x2970, 0xABC5, 0x31A0, 0xB315, 0xBF7D, 0x3DC8,
+        0xC4ED, 0x4658, 0x4A30, 0xC885, 0x52E0, 0xD055, 0xDC3D, 0x5E88, 0x6340, 0xE1F5, 0xED9D, 0x6F28, 0xF54D, 0x77F8, 0x7B90, 0xF925,
+        0x026D, 0x80D8, 0x8CB0, 0x0E05, 0x9460, 0x16D5, 0x1ABD, 0x9808, 0xA5C0, 0x2775, 0x2B1D, 0xA9A8, 0x33CD, 0xB178, 0xBD10, 0x3FA5,
+        0xC680, 0x4435, 0x485D, 0xCAE8, 0x508D, 0xD238, 0xDE50, 0x5CE5, 0x612D, 0xE398, 0xEFF0, 0x6D45, 0xF720, 0x7595, 0x79FD, 0xFB48,
+        0x04DA, 0x866F, 0x8A07, 0x08B2, 0x92D7, 0x1062, 0x1C0A, 0x9EBF, 0xA377, 0x21C2, 0x2DAA, 0xAF1F, 0x357A, 0xB7CF, 0xBBA7, 0x3912,
+        0xC037, 0x4282, 0x4EEA, 0xCC5F, 0x563A, 0xD48F, 0xD8E7, 0x5A52, 0x679A, 0xE52F, 0xE947, 0x6BF2, 0xF197, 0x7322, 0x7F4A, 0xFDFF,
+        0x06B7, 0x8402, 0x886A, 0x0ADF, 0x90BA, 0x120F, 0x1E67, 0x9CD2, 0xA11A, 0x23AF, 0x2FC7, 0xAD72, 0x3717, 0xB5A2, 0xB9CA, 0x3B7F,
+        0xC25A, 0x40EF, 0x4C87, 0xCE32, 0x5457, 0xD6E2, 0xDA8A, 0x583F, 0x65F7, 0xE742, 0xEB2A, 0x699F, 0xF3FA, 0x714F, 0x7D27, 0xFF92,
+        0x09B4, 0x8B01, 0x8769, 0x05DC, 0x9FB9, 0x1D0C, 0x1164, 0x93D1, 0xAE19, 0x2CAC, 0x20C4, 0xA271, 0x3814, 0xBAA1, 0xB6C9, 0x347C,
+        0xCD59, 0x4FEC, 0x4384, 0xC131, 0x5B54, 0xD9E1, 0xD589, 0x573C, 0x6AF4, 0xE841, 0xE429, 0x669C, 0xFCF9, 0x7E4C, 0x7224, 0xF091,
+        0x0BD9, 0x896C, 0x8504, 0x07B1, 0x9DD4, 0x1F61, 0x1309, 0x91BC, 0xAC74, 0x2EC1, 0x22A9, 0xA01C, 0x3A79, 0xB8CC, 0xB4A4, 0x3611,
+        0xCF34, 0x4D81, 0x41E9, 0xC35C, 0x5939, 0xDB8C, 0xD7E4, 0x5551, 0x6899, 0xEA2C, 0xE644, 0x64F1, 0xFE94, 0x7C21, 0x7049, 0xF2FC,
+        0x0D6E, 0x8FDB, 0x83B3, 0x0106, 0x9B63, 0x19D6, 0x15BE, 0x970B, 0xAAC3, 0x2876, 0x241E, 0xA6AB, 0x3CCE, 0xBE7B, 0xB213, 0x30A6,
+        0xC983, 0x4B36, 0x475E, 0xC5EB, 0x5F8E, 0xDD3B, 0xD153, 0x53E6, 0x6E2E, 0xEC9B, 0xE0F3, 0x6246, 0xF823, 0x7A96, 0x76FE, 0xF44B,
+        0x0F03, 0x8DB6, 0x81DE, 0x036B, 0x990E, 0x1BBB, 0x17D3, 0x9566, 0xA8AE, 0x2A1B, 0x2673, 0xA4C6, 0x3EA3, 0xBC16, 0xB07E, 0x32CB,
+        0xCBEE, 0x495B, 0x4533, 0xC786, 0x5DE3, 0xDF56, 0xD33E, 0x518B, 0x6C43, 0xEEF6, 0xE29E, 0x602B, 0xFA4E, 0x78FB, 0x7493, 0xF626
+    },
+    {
+        0x0000, 0x1368, 0x26D0, 0x35B8, 0x4DA0, 0x5EC8, 0x6B70, 0x7818, 0x9B40, 0x8828, 0xBD90, 0xAEF8, 0xD6E0, 0xC588, 0xF030, 0xE358,
+        0xBD37, 0xAE5F, 0x9BE7, 0x888F, 0xF097, 0xE3FF, 0xD647, 0xC52F, 0x2677, 0x351F, 0x00A7, 0x13CF, 0x6BD7, 0x78BF, 0x4D07, 0x5E6F,
+        0xF1D9, 0xE2B1, 0xD709, 0xC461, 0xBC79, 0xAF11, 0x9AA9, 0x89C1, 0x6A99, 0x79F1, 0x4C49, 0x5F21, 0x2739, 0x3451, 0x01E9, 0x1281,
+        0x4CEE, 0x5F86, 0x6A3E, 0x7956, 0x014E, 0x1226, 0x279E, 0x34F6, 0xD7AE, 0xC4C6, 0xF17E, 0xE216, 0x9A0E, 0x8966, 0xBCDE, 0xAFB6,
+        0x6805, 0x7B6D, 0x4ED5, 0x5DBD, 0x25A5, 0x36CD, 0x0375, 0x101D, 0xF345, 0xE02D, 0xD595, 0xC6FD, 0xBEE5, 0xAD8D, 0x9835, 0x8B5D,
+        0xD532, 0xC65A, 0xF3E2, 0xE08A, 0x9892, 0x8BFA, 0xBE42, 0xAD2A, 0x4E72, 0x5D1A, 0x68A2, 0x7BCA, 0x03D2, 0x10BA, 0x2502, 0x366A,
+        0x99DC, 0x8AB4, 0xBF0C, 0xAC64, 0xD47C, 0xC714, 0xF2AC, 0xE1C4, 0x029C, 0x11F4, 0x244C, 0x3724, 0x4F3C, 0x5C54, 0x69EC, 0x7A84,
+        0x24EB, 0x3783, 0x023B, 0x1153, 0x694B, 0x7A23, 0x4F9B, 0x5CF3, 0xBFAB, 0xACC3, 0x997B, 0x8A13, 0xF20B, 0xE163, 0xD4DB, 0xC7B3,
+        0xD00A, 0xC362, 0xF6DA, 0xE5B2, 0x9DAA, 0x8EC2, 0xBB7A, 0xA812, 0x4B4A, 0x5822, 0x6D9A, 0x7EF2, 0x06EA, 0x1582, 0x203A, 0x3352,
+        0x6D3D, 0x7E55, 0x4BED, 0x5885, 0x209D, 0x33F5, 0x064D, 0x1525, 0xF67D, 0xE515, 0xD0AD, 0xC3C5, 0xBBDD, 0xA8B5, 0x9D0D, 0x8E65,
+        0x21D3, 0x32BB, 0x0703, 0x146B, 0x6C73, 0x7F1B, 0x4AA3, 0x59CB, 0xBA93, 0xA9FB, 0x9C43, 0x8F2B, 0xF733, 0xE45B, 0xD1E3, 0xC28B,
+        0x9CE4, 0x8F8C, 0xBA34, 0xA95C, 0xD144, 0xC22C, 0xF794, 0xE4FC, 0x07A4, 0x14CC, 0x2174, 0x321C, 0x4A04, 0x596C, 0x6CD4, 0x7FBC,
+        0xB80F, 0xAB67, 0x9EDF, 0x8DB7, 0xF5AF, 0xE6C7, 0xD37F, 0xC017, 0x234F, 0x3027, 0x059F, 0x16F7, 0x6EEF, 0x7D87, 0x483F, 0x5B57,
+        0x0538, 0x1650, 0x23E8, 0x3080, 0x4898, 0x5BF0, 0x6E48, 0x7D20, 0x9E78, 0x8D10, 0xB8A8, 0xABC0, 0xD3D8, 0xC0B0, 0xF508, 0xE660,
+        0x49D6, 0x5ABE, 0x6F06, 0x7C6E, 0x0476, 0x171E, 0x22A6, 0x31CE, 0xD296, 0xC1FE, 0xF446, 0xE72E, 0x9F36, 0x8C5E, 0xB9E6, 0xAA8E,
+        0xF4E1, 0xE789, 0xD231, 0xC159, 0xB941, 0xAA29, 0x9F91, 0x8CF9, 0x6FA1, 0x7CC9, 0x4971, 0x5A19, 0x2201, 0x3169, 0x04D1, 0x17B9
+    },
+    {
+        0x0000, 0x2BA3, 0x5746, 0x7CE5, 0xAE8C, 0x852F, 0xF9CA, 0xD269, 0xD6AF, 0xFD0C, 0x81E9, 0xAA4A, 0x7823, 0x5380, 0x2F65, 0x04C6,
+        0x26E9, 0x0D4A, 0x71AF, 0x5A0C, 0x8865, 0xA3C6, 0xDF23, 0xF480, 0xF046, 0xDBE5, 0xA700, 0x8CA3, 0x5ECA, 0x7569, 0x098C, 0x222F,
+        0x4DD2, 0x6671, 0x1A94, 0x3137, 0xE35E, 0xC8FD, 0xB418, 0x9FBB, 0x9B7D, 0xB0DE, 0xCC3B, 0xE798, 0x35F1, 0x1E52, 0x62B7, 0x4914,
+        0x6B3B, 0x4098, 0x3C7D, 0x17DE, 0xC5B7, 0xEE14, 0x92F1, 0xB952, 0xBD94, 0x9637, 0xEAD2, 0xC171, 0x1318, 0x38BB, 0x445E, 0x6FFD,
+        0x9BA4, 0xB007, 0xCCE2, 0xE741, 0x3528, 0x1E8B, 0x626E, 0x49CD, 0x4D0B, 0x66A8, 0x1A4D, 0x31EE, 0xE387, 0xC824, 0xB4C1, 0x9F62,
+        0xBD4D, 0x96EE, 0xEA0B, 0xC1A8, 0x13C1, 0x3862, 0x4487, 0x6F24, 0x6BE2, 0x4041, 0x3CA4, 0x1707, 0xC56E, 0xEECD, 0x9228, 0xB98B,
+        0xD676, 0xFDD5, 0x8130, 0xAA93, 0x78FA, 0x5359, 0x2FBC, 0x041F, 0x00D9, 0x2B7A, 0x579F, 0x7C3C, 0xAE55, 0x85F6, 0xF913, 0xD2B0,
+        0xF09F, 0xDB3C, 0xA7D9, 0x8C7A, 0x5E13, 0x75B0, 0x0955, 0x22F6, 0x2630, 0x0D93, 0x7176, 0x5AD5, 0x88BC, 0xA31F, 0xDFFA, 0xF459,
+        0xBCFF, 0x975C, 0xEBB9, 0xC01A, 0x1273, 0x39D0, 0x4535, 0x6E96, 0x6A50, 0x41F3, 0x3D16, 0x16B5, 0xC4DC, 0xEF7F, 0x939A, 0xB839,
+        0x9A16, 0xB1B5, 0xCD50, 0xE6F3, 0x349A, 0x1F39, 0x63DC, 0x487F, 0x4CB9, 0x671A, 0x1BFF, 0x305C, 0xE235, 0xC996, 0xB573, 0x9ED0,
+        0xF12D, 0xDA8E, 0xA66B, 0x8DC8, 0x5FA1, 0x7402, 0x08E7, 0x2344, 0x2782, 0x0C21, 0x70C4, 0x5B67, 0x890E, 0xA2AD, 0xDE48, 0xF5EB,
+        0xD7C4, 0xFC67, 0x8082, 0xAB21, 0x7948, 0x52EB, 0x2E0E, 0x05AD, 0x016B, 0x2AC8, 0x562D, 0x7D8E, 0xAFE7, 0x8444, 0xF8A1, 0xD302,
+        0x275B, 0x0CF8, 0x701D, 0x5BBE, 0x89D7, 0xA274, 0xDE91, 0xF532, 0xF1F4, 0xDA57, 0xA6B2, 0x8D11, 0x5F78, 0x74DB, 0x083E, 0x239D,
+        0x01B2, 0x2A11, 0x56F4, 0x7D57, 0xAF3E, 0x849D, 0xF878, 0xD3DB, 0xD71D, 0xFCBE, 0x805B, 0xABF8, 0x7991, 0x5232, 0x2ED7, 0x0574,
+        0x6A89, 0x412A, 0x3DCF, 0x166C, 0xC405, 0xEFA6, 0x9343, 0xB8E0, 0xBC26, 0x9785, 0xEB60, 0xC0C3, 0x12AA, 0x3909, 0x45EC, 0x6E4F,
+        0x4C60, 0x67C3, 0x1B26, 0x3085, 0xE2EC, 0xC94F, 0xB5AA, 0x9E09, 0x9ACF, 0xB16C, 0xCD89, 0xE62A, 0x3443, 0x1FE0, 0x6305, 0x48A6
+    },
+    {
+        0x0000, 0xF249, 0x6F25, 0x9D6C, 0xDE4A, 0x2C03, 0xB16F, 0x4326, 0x3723, 0xC56A, 0x5806, 0xAA4F, 0xE969, 0x1B20, 0x864C, 0x7405,
+        0x6E46, 0x9C0F, 0x0163, 0xF32A, 0xB00C, 0x4245, 0xDF29, 0x2D60, 0x5965, 0xAB2C, 0x3640, 0xC409, 0x872F, 0x7566, 0xE80A, 0x1A43,
+        0xDC8C, 0x2EC5, 0xB3A9, 0x41E0, 0x02C6, 0xF08F, 0x6DE3, 0x9FAA, 0xEBAF, 0x19E6, 0x848A, 0x76C3, 0x35E5, 0xC7AC, 0x5AC0, 0xA889,
+        0xB2CA, 0x4083, 0xDDEF, 0x2FA6, 0x6C80, 0x9EC9, 0x03A5, 0xF1EC, 0x85E9, 0x77A0, 0xEACC, 0x1885, 0x5BA3, 0xA9EA, 0x3486, 0xC6CF,
+        0x32AF, 0xC0E6, 0x5D8A, 0xAFC3, 0xECE5, 0x1EAC, 0x83C0, 0x7189, 0x058C, 0xF7C5, 0x6AA9, 0x98E0, 0xDBC6, 0x298F, 0xB4E3, 0x46AA,
+        0x5CE9, 0xAEA0, 0x33CC, 0xC185, 0x82A3, 0x70EA, 0xED86, 0x1FCF, 0x6BCA, 0x9983, 0x04EF, 0xF6A6, 0xB580, 0x47C9, 0xDAA5, 0x28EC,
+        0xEE23, 0x1C6A, 0x8106, 0x734F, 0x3069, 0xC220, 0x5F4C, 0xAD05, 0xD900, 0x2B49, 0xB625, 0x446C, 0x074A, 0xF503, 0x686F, 0x9A26,
+        0x8065, 0x722C, 0xEF40, 0x1D09, 0x5E2F, 0xAC66, 0x310A, 0xC343, 0xB746, 0x450F, 0xD863, 0x2A2A, 0x690C, 0x9B45, 0x0629, 0xF460,
+        0x655E, 0x9717, 0x0A7B, 0xF832, 0xBB14, 0x495D, 0xD431, 0x2678, 0x527D, 0xA034, 0x3D58, 0xCF11, 0x8C37, 0x7E7E, 0xE312, 0x115B,
+        0x0B18, 0xF951, 0x643D, 0x9674, 0xD552, 0x271B, 0xBA77, 0x483E, 0x3C3B, 0xCE72, 0x531E, 0xA157, 0xE271, 0x1038, 0x8D54, 0x7F1D,
+        0xB9D2, 0x4B9B, 0xD6F7, 0x24BE, 0x6798, 0x95D1, 0x08BD, 0xFAF4, 0x8EF1, 0x7CB8, 0xE1D4, 0x139D, 0x50BB, 0xA2F2, 0x3F9E, 0xCDD7,
+        0xD794, 0x25DD, 0xB8B1, 0x4AF8, 0x09DE, 0xFB97, 0x66FB, 0x94B2, 0xE0B7, 0x12FE, 0x8F92, 0x7DDB, 0x3EFD, 0xCCB4, 0x51D8, 0xA391,
+        0x57F1, 0xA5B8, 0x38D4, 0xCA9D, 0x89BB, 0x7BF2, 0xE69E, 0x14D7, 0x60D2, 0x929B, 0x0FF7, 0xFDBE, 0xBE98, 0x4CD1, 0xD1BD, 0x23F4,
+        0x39B7, 0xCBFE, 0x5692, 0xA4DB, 0xE7FD, 0x15B4, 0x88D8, 0x7A91, 0x0E94, 0xFCDD, 0x61B1, 0x93F8, 0xD0DE, 0x2297, 0xBFFB, 0x4DB2,
+        0x8B7D, 0x7934, 0xE458, 0x1611, 0x5537, 0xA77E, 0x3A12, 0xC85B, 0xBC5E, 0x4E17, 0xD37B, 0x2132, 0x6214, 0x905D, 0x0D31, 0xFF78,
+        0xE53B, 0x1772, 0x8A1E, 0x7857, 0x3B71, 0xC938, 0x5454, 0xA61D, 0xD218, 0x2051, 0xBD3D, 0x4F74, 0x0C52, 0xFE1B, 0x6377, 0x913E
+    },
+    {
+        0x0000, 0xCABC, 0x1ECF, 0xD473, 0x3D9E, 0xF722, 0x2351, 0xE9ED, 0x7B3C, 0xB180, 0x65F3, 0xAF4F, 0x46A2, 0x8C1E, 0x586D, 0x92D1,
+        0xF678, 0x3CC4, 0xE8B7, 0x220B, 0xCBE6, 0x015A, 0xD529, 0x1F95, 0x8D44, 0x47F8, 0x938B, 0x5937, 0xB0DA, 0x7A66, 0xAE15, 0x64A9,
+        0x6747, 0xADFB, 0x7988, 0xB334, 0x5AD9, 0x9065, 0x4416, 0x8EAA, 0x1C7B, 0xD6C7, 0x02B4, 0xC808, 0x21E5, 0xEB59, 0x3F2A, 0xF596,
+        0x913F, 0x5B83, 0x8FF0, 0x454C, 0xACA1, 0x661D, 0xB26E, 0x78D2, 0xEA03, 0x20BF, 0xF4CC, 0x3E70, 0xD79D, 0x1D21, 0xC952, 0x03EE,
+        0xCE8E, 0x0432, 0xD041, 0x1AFD, 0xF310, 0x39AC, 0xEDDF, 0x2763, 0xB5B2, 0x7F0E, 0xAB7D, 0x61C1, 0x882C, 0x4290, 0x96E3, 0x5C5F,
+        0x38F6, 0xF24A, 0x2639, 0xEC85, 0x0568, 0xCFD4, 0x1BA7, 0xD11B, 0x43CA, 0x8976, 0x5D05, 0x97B9, 0x7E54, 0xB4E8, 0x609B, 0xAA27,
+        0xA9C9, 0x6375, 0xB706, 0x7DBA, 0x9457, 0x5EEB, 0x8A98, 0x4024, 0xD2F5, 0x1849, 0xCC3A, 0x0686, 0xEF6B, 0x25D7, 0xF1A4, 0x3B18,
+        0x5FB1, 0x950D, 0x417E, 0x8BC2, 0x622F, 0xA893, 0x7CE0, 0xB65C, 0x248D, 0xEE31, 0x3A42, 0xF0FE, 0x1913, 0xD3AF, 0x07DC, 0xCD60,
+        0x16AB, 0xDC17, 0x0864, 0xC2D8, 0x2B35, 0xE189, 0x35FA, 0xFF46, 0x6D97, 0xA72B, 0x7358, 0xB9E4, 0x5009, 0x9AB5, 0x4EC6, 0x847A,
+        0xE0D3, 0x2A6F, 0xFE1C, 0x34A0, 0xDD4D, 0x17F1, 0xC382, 0x093E, 0x9BEF, 0x5153, 0x8520, 0x4F9C, 0xA671, 0x6CCD, 0xB8BE, 0x7202,
+        0x71EC, 0xBB50, 0x6F23, 0xA59F, 0x4C72, 0x86CE, 0x52BD, 0x9801, 0x0AD0, 0xC06C, 0x141F, 0xDEA3, 0x374E, 0xFDF2, 0x2981, 0xE33D,
+        0x8794, 0x4D28, 0x995B, 0x53E7, 0xBA0A, 0x70B6, 0xA4C5, 0x6E79, 0xFCA8, 0x3614, 0xE267, 0x28DB, 0xC136, 0x0B8A, 0xDFF9, 0x1545,
+        0xD825, 0x1299, 0xC6EA, 0x0C56, 0xE5BB, 0x2F07, 0xFB74, 0x31C8, 0xA319, 0x69A5, 0xBDD6, 0x776A, 0x9E87, 0x543B, 0x8048, 0x4AF4,
+        0x2E5D, 0xE4E1, 0x3092, 0xFA2E, 0x13C3, 0xD97F, 0x0D0C, 0xC7B0, 0x5561, 0x9FDD, 0x4BAE, 0x8112, 0x68FF, 0xA243, 0x7630, 0xBC8C,
+        0xBF62, 0x75DE, 0xA1AD, 0x6B11, 0x82FC, 0x4840, 0x9C33, 0x568F, 0xC45E, 0x0EE2, 0xDA91, 0x102D, 0xF9C0, 0x337C, 0xE70F, 0x2DB3,
+        0x491A, 0x83A6, 0x57D5, 0x9D69, 0x7484, 0xBE38, 0x6A4B, 0xA0F7, 0x3226, 0xF89A, 0x2CE9, 0xE655, 0x0FB8, 0xC504, 0x1177, 0xDBCB
+    }
+};
+
+static uint16_t t10_DIF_CRC(uint16_t crc, const uint8_t *data, uint32_t length)
+{
+    while (length >= 8)
+    {
+        crc = t10DifCrcTable[7][data[0] ^ M_Byte1(crc)] ^ t10DifCrcTable[6][data[1] ^ M_Byte0(crc)]
+            ^ t10DifCrcTable[5][data[2]] ^ t10DifCrcTable[4][data[3]]
+            ^ t10DifCrcTable[3][data[4]] ^ t10DifCrcTable[2][data[5]]
+            ^ t10DifCrcTable[1][data[6]] ^ t10DifCrcTable[0][data[7]];
+        data += 8;
+        length -= 8;
+    }
+    while (length > 0)
+    {
+        crc = (uint16_t)(crc << 8) ^ t10DifCrcTable[0][data[0] ^ M_Byte1(crc)];
+        ++data;
+        --length;
+    }
+    return crc;
+}
+
+uint16_t calculate_Logical_Block_Guard(uint8_t *buffer, uint32_t userDataLength, uint32_t totalDataLength)
+{
+    uint16_t crc = 0;//Can also be all F's to invert it. TODO: should invert be a boolean option to this function? - TJE
+    uint32_t crcLength = M_Min(userDataLength, totalDataLength);
+    if (!buffer)
+    {
+        return 0;
+    }
+    if (crcLength % 2 && crcLength < totalDataLength)
+    {
+        //The guard is calculated on 16 bit words, so an odd length uses the next byte in the buffer.
+        ++crcLength;
+    }
+    crc = t10_DIF_CRC(crc, buffer, crcLength);
+    if (crcLength % 2)
+    {
+        //no more data in the buffer. Finish the last word with zero.
+        uint8_t zero = 0;
+        crc = t10_DIF_CRC(crc, &zero, 1);
+    }
+    return crc;
+}
+
+int calculate_Logical_Block_Guards(uint8_t *buffer, uint32_t bufferLength, uint32_t userDataLength, uint32_t logicalBlockLength, uint16_t *guards, uint32_t numberOfBlocks)
+{
+    if (!buffer || !guards || userDataLength == 0 || logicalBlockLength < userDataLength)
+    {
+        return BAD_PARAMETER;
+    }
+    if ((uint64_t)logicalBlockLength * numberOfBlocks > bufferLength)
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t blockIter = 0; blockIter < numberOfBlocks; ++blockIter)
+    {
+        guards[blockIter] = calculate_Logical_Block_Guard(&buffer[(uint64_t)blockIter * logicalBlockLength], userDataLength, logicalBlockLength);
+    }
+    return SUCCESS;
+}
+
+//this is mean to only be called by check_Sense_Key_asc_And_ascq()
+void print_sense_key(const char* senseKeyToPrint, uint8_t senseKeyValue)
+{
+    printf("Sense Key: %"PRIX8"h = %s\n", senseKeyValue, senseKeyToPrint);
+    fflush(stdout);
+}
+//this is meant to only be called by check_Sense_Key_asc_And_ascq()
+void print_acs_ascq(const char* acsAndascqStringToPrint, uint8_t ascValue, uint8_t ascqValue)
+{
+    printf("ASC & ASCQ: %"PRIX8"h - %"PRIX8"h = %s\n", ascValue, ascqValue, acsAndascqStringToPrint);
+    fflush(stdout);
+}
+
+//this is meant to only be called by check_Sense_Key_asc_And_ascq()
+void print_Field_Replacable_Unit_Code(tDevice *device, const char *fruMessage, uint8_t fruCode)
+{
+    //we'll only print out a translatable string for seagate drives since fru is vendor specific
+    if (is_Seagate(device, false) == true && fruMessage && device->drive_info.interface_type == SCSI_INTERFACE)
+    {
+        printf("FRU: %"PRIX8"h = %s\n", fruCode, fruMessage);
+        fflush(stdout);
+    }
+    else
+    {
+        if (fruCode == 0)
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            printf("FRU: %"PRIX8"h = No Additional Information\n", fruCode);
         }
-        break;
-    case 0x77:
-        switch (ascq)
+        else
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            printf("FRU: %"PRIX8"h = Vendor Specific\n", fruCode);
         }
-        break;
-    case 0x78:
-        switch (ascq)
+        fflush(stdout);
+    }
+}
+
+//Result for a sense key, ASC/ASCQ table entry that does not change the result decided by the sense key.
+#define SENSE_RESULT_FROM_SENSE_KEY (-1)
+
+typedef struct _senseKeyResult
+{
+    int8_t result;
+    const char *name;
+}senseKeyResult;
+
+//Indexed by sense key.
+static const senseKeyResult senseKeyResults[16] = {
+    { SUCCESS, "No Error" },
+    { FAILURE, "Recovered Error" },
+    { FAILURE, "Not Ready" },
+    { FAILURE, "Medium Error" },
+    { FAILURE, "Hardware Error" },
+    { NOT_SUPPORTED, "Illegal Request" },
+    { FAILURE, "Unit Attention" },
+    { FAILURE, "Data Protect" },
+    { FAILURE, "Blank Check" },
+    { FAILURE, "Vendor Specific" },
+    { FAILURE, "Copy Aborted" },
+    { ABORTED, "Aborted Command" },
+    { FAILURE, "Reserved" },
+    { FAILURE, "Volume Overflow" },
+    { FAILURE, "Miscompare" },
+    { SUCCESS, "Completed" }
+};
+
+typedef struct _ascAscqResult
+{
+    uint8_t asc;
+    uint8_t ascq;
+    int8_t result;//SENSE_RESULT_FROM_SENSE_KEY to keep the result from the sense key
+    const char *message;//only used for verbose output
+}ascAscqResult;
+
+//ASC/ASCQ combinations from SPC4 that apply to direct access block devices.
+//This MUST stay sorted by ASC, then ASCQ since it is binary searched.
+static const ascAscqResult ascAscqResults[] = {
+    { 0x00, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "No Additional Sense Information" },
+    { 0x00, 0x01, SENSE_RESULT_FROM_SENSE_KEY, "Filemark Detected" },
+    { 0x00, 0x02, SENSE_RESULT_FROM_SENSE_KEY, "End-Of_Partition/Medium Detected" },
+    { 0x00, 0x03, SENSE_RESULT_FROM_SENSE_KEY, "Setmark Detected" },
+    { 0x00, 0x04, SENSE_RESULT_FROM_SENSE_KEY, "Beginning-Of-Partition/Medium Detected" },
+    { 0x00, 0x05, SENSE_RESULT_FROM_SENSE_KEY, "End-Of-Data Detected" },
+    { 0x00, 0x06, FAILURE, "I/O Process Terminated" },
+    { 0x00, 0x07, SENSE_RESULT_FROM_SENSE_KEY, "Programmable Early Warning Detected" },
+    { 0x00, 0x11, IN_PROGRESS, "Audio Play Operation In Progress" },
+    { 0x00, 0x12, SENSE_RESULT_FROM_SENSE_KEY, "Audio Play Operation Paused" },
+    { 0x00, 0x13, SUCCESS, "Audio Play Operation Successfully Completed" },
+    { 0x00, 0x14, FAILURE, "Audio Play Operation Stopped Due To Error" },
+    { 0x00, 0x15, SENSE_RESULT_FROM_SENSE_KEY, "No Current Audio Status To Return" },
+    { 0x00, 0x16, IN_PROGRESS, "Operation In Progress" },
+    { 0x00, 0x17, UNKNOWN, "Cleaning Requested" },
+    { 0x00, 0x18, IN_PROGRESS, "Erase Operation In Progress" },
+    { 0x00, 0x19, IN_PROGRESS, "Locate Operation In Progress" },
+    { 0x00, 0x1A, IN_PROGRESS, "Rewind Operation In Progress" },
+    { 0x00, 0x1B, IN_PROGRESS, "Set Capacity Operation In Progress" },
+    { 0x00, 0x1C, IN_PROGRESS, "Verify Operation In Progress" },
+    { 0x00, 0x1D, UNKNOWN, "ATA Passthrough Information Available" },
+    { 0x00, 0x1E, UNKNOWN, "Conflicting SA Creation Request" },
+    { 0x00, 0x1F, SUCCESS, "Logical Unit Transitioning To Another Power Condition" },
+    { 0x00, 0x20, SUCCESS, "Extended Copy Information Available" },
+    { 0x00, 0x21, FAILURE, "Atomic Command Aborted Due To ACA" },
+    { 0x01, 0x00, FAILURE, "No Index/Sector Signal" },
+    { 0x02, 0x00, FAILURE, "No Seek Complete" },
+    { 0x03, 0x00, FAILURE, "Peripheral Device Write Fault" },
+    { 0x03, 0x01, FAILURE, "No Write Current" },
+    { 0x03, 0x02, FAILURE, "Excessive Write Errors" },
+    { 0x04, 0x00, FAILURE, "Logical Unit Not Ready, Cause Not Reported" },
+    { 0x04, 0x01, FAILURE, "Logical Unit Is In The Process Of Becoming Ready" },
+    { 0x04, 0x02, FAILURE, "Logical Unit Not Ready, Initializing Command Required" },
+    { 0x04, 0x03, FAILURE, "Logical Unit Not Ready, Manual Intervention Required" },
+    { 0x04, 0x04, IN_PROGRESS, "Logical Unit Not Ready, Format In Progress" },
+    { 0x04, 0x05, IN_PROGRESS, "Logical Unit Not Ready, Rebuild In Progress" },
+    { 0x04, 0x06, IN_PROGRESS, "Logical Unit Not Ready, Recalculation In Progress" },
+    { 0x04, 0x07, IN_PROGRESS, "Logical Unit Not Ready, Operation In Progress" },
+    { 0x04, 0x09, IN_PROGRESS, "Logical Unit Not Ready, Self-Test In Progress" },
+    { 0x04, 0x0A, FAILURE, "Logical Unit Not Accessible, Asymetric Access State Transition" },
+    { 0x04, 0x0B, FAILURE, "Logical Unit Not Accessible, Target Port In Standby State" },
+    { 0x04, 0x0C, FAILURE, "Logical Unit Not Accessible, Target Port in Unavailable State" },
+    { 0x04, 0x0D, FAILURE, "Logical Unit Not Ready, Structure Check Required" },
+    { 0x04, 0x0E, FAILURE, "Logical Unit Not Ready, Security Session In Progress" },
+    { 0x04, 0x10, FAILURE, "Logical Unit Not Ready, Auxilary Memory Not Accessible" },
+    { 0x04, 0x11, FAILURE, "Logical Unit Not Ready, Notify (Enable Spinup) Required" },
+    { 0x04, 0x13, IN_PROGRESS, "Logical Unit Not Ready, SA Creation In Progress" },
+    { 0x04, 0x14, IN_PROGRESS, "Logical Unit Not Ready, Space Allocation In Progress" },
+    { 0x04, 0x15, FAILURE, "Logical Unit Not Ready, Robotics Disabled" },
+    { 0x04, 0x16, FAILURE, "Logical Unit Not Ready, Configuration Required" },
+    { 0x04, 0x17, FAILURE, "Logical Unit Not Ready, Calibration Required" },
+    { 0x04, 0x18, FAILURE, "Logical Unit Not Ready, A Door Is Open" },
+    { 0x04, 0x19, IN_PROGRESS, "Logical Unit Not Ready, Operating In Sequential Mode" },
+    { 0x04, 0x1A, IN_PROGRESS, "Logical Unit Not Ready, Start Stop Unit Command In Progress" },
+    { 0x04, 0x1B, IN_PROGRESS, "Logical Unit Not Ready, Sanitize In Progress" },
+    { 0x04, 0x1C, FAILURE, "Logical Unit Not Ready, Additional Power Use Not Yet Granted" },
+    { 0x04, 0x1D, IN_PROGRESS, "Logical Unit Not Ready, Configuration In Progress" },
+    { 0x04, 0x1E, FAILURE, "Logical Unit Not Ready, Microcode Activation Required" },
+    { 0x04, 0x1F, FAILURE, "Logical Unit Not Ready, Microcode Download Required" },
+    { 0x04, 0x20, FAILURE, "Logical Unit Not Ready, Logical Unit Reset Required" },
+    { 0x04, 0x21, FAILURE, "Logical Unit Not Ready, Hard Reset Required" },
+    { 0x04, 0x22, FAILURE, "Logical Unit Not Ready, Power Cycle Required" },
+    { 0x04, 0x23, FAILURE, "Logical Unit Not Ready, Affiliation Required" },
+    { 0x05, 0x00, FAILURE, "Logical Unit Does Not Respond To Selection" },
+    { 0x06, 0x00, FAILURE, "No Reference Position Found" },
+    { 0x07, 0x00, FAILURE, "Multiple Peripheral Devices Selected" },
+    { 0x08, 0x00, FAILURE, "Logical Unit Communication Failure" },
+    { 0x08, 0x01, FAILURE, "Logical Unit Communication Time-Out" },
+    { 0x08, 0x02, FAILURE, "Logical Unit Communication Parity Error" },
+    { 0x08, 0x03, FAILURE, "Logical Unit Communication CRC Error (Ultra-DMA/32)" },
+    { 0x08, 0x04, FAILURE, "Unreachable Copy Target" },
+    { 0x09, 0x00, FAILURE, "Track Following Error" },
+    { 0x09, 0x01, FAILURE, "Tracking Servo Failure" },
+    { 0x09, 0x02, FAILURE, "Focus Servo Failure" },
+    { 0x09, 0x03, FAILURE, "Spindle Servo Failure" },
+    { 0x09, 0x04, FAILURE, "Head Select Fault" },
+    { 0x09, 0x05, FAILURE, "Vibration Induced Tracking Error" },
+    { 0x0A, 0x00, FAILURE, "Error Log Overflow" },
+    { 0x0B, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Warning" },
+    { 0x0B, 0x01, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Specified Temperature Exceeded" },
+    { 0x0B, 0x02, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Enclosure Degraded" },
+    { 0x0B, 0x03, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Background Self-Test Failed" },
+    { 0x0B, 0x04, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Background Pre-Scan Detected Medium Error" },
+    { 0x0B, 0x05, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Background Media Scan Detected Medium Error" },
+    { 0x0B, 0x06, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Non-Volitile Cache Now Volitile" },
+    { 0x0B, 0x07, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Degraded Power To Non-Volitile Cache" },
+    { 0x0B, 0x08, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Power Loss Expected" },
+    { 0x0B, 0x09, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Device Statistics Notification Active" },
+    { 0x0B, 0x0A, SENSE_RESULT_FROM_SENSE_KEY, "Warning - High Critical Temperature Limit Exceeded" },
+    { 0x0B, 0x0B, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Low Critical Temperature Limit Exceeded" },
+    { 0x0B, 0x0C, SENSE_RESULT_FROM_SENSE_KEY, "Warning - High Operating Temperature Limit Exceeded" },
+    { 0x0B, 0x0D, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Low Operating Temperature Limit Exceeded" },
+    { 0x0B, 0x0E, SENSE_RESULT_FROM_SENSE_KEY, "Warning - High Critical Humidity Limit Exceeded" },
+    { 0x0B, 0x0F, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Low Critical Humidity Limit Exceeded" },
+    { 0x0B, 0x10, SENSE_RESULT_FROM_SENSE_KEY, "Warning - High Operating Humidity Limit Exceeded" },
+    { 0x0B, 0x11, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Low Operating Humidity Limit Exceeded" },
+    { 0x0B, 0x12, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Microcode Security At Risk" },
+    { 0x0B, 0x13, SENSE_RESULT_FROM_SENSE_KEY, "Warning - Microcode Digital Signature Validation Failure" },
+    { 0x0C, 0x00, FAILURE, "Write Error" },
+    { 0x0C, 0x01, SENSE_RESULT_FROM_SENSE_KEY, "Write Error - Recovered With Auto Reallocation" },
+    { 0x0C, 0x02, FAILURE, "Write Error - Auto Reallocation Failed" },
+    { 0x0C, 0x03, FAILURE, "Write Error - Recommend Reassignment" },
+    { 0x0C, 0x04, FAILURE, "Compression Check Miscompare Error" },
+    { 0x0C, 0x05, FAILURE, "Data Expansion Occurred During Compression" },
+    { 0x0C, 0x06, FAILURE, "Block Not Compressible" },
+    { 0x0C, 0x07, FAILURE, "Write Error - Recovery Needed" },
+    { 0x0C, 0x08, FAILURE, "Write Error - Recovery Failed" },
+    { 0x0C, 0x09, FAILURE, "Write Error - Loss Of Streaming" },
+    { 0x0C, 0x0A, FAILURE, "Write Error - Padding Blocks Added" },
+    { 0x0C, 0x0B, FAILURE, "Auxiliary Memory Write Error" },
+    { 0x0C, 0x0C, FAILURE, "Write Error - Unexpected Unsolicited Data" },
+    { 0x0C, 0x0D, FAILURE, "Write Error - Not Enough Unsolicited Data" },
+    { 0x0C, 0x0E, FAILURE, "Multiple Write Errors" },
+    { 0x0C, 0x0F, FAILURE, "Defects In Error Window" },
+    { 0x0C, 0x10, FAILURE, "Incomplete Multiple Atomic Write Operations" },
+    { 0x0C, 0x11, FAILURE, "Write Error - Recovery Scan Needed" },
+    { 0x0C, 0x12, FAILURE, "Write Error - Insufficient Zone Resources" },
+    { 0x0D, 0x00, FAILURE, "Error Detected By Third Party Temporary Initiator" },
+    { 0x0D, 0x01, FAILURE, "Third Party Device Failure" },
+    { 0x0D, 0x02, FAILURE, "Copy Target Device Not Reachable" },
+    { 0x0D, 0x03, FAILURE, "Incorrect Copy Target Device Type" },
+    { 0x0D, 0x04, FAILURE, "Copy Target Device Data Underrun" },
+    { 0x0D, 0x05, FAILURE, "Copy Target Device Data Overrun" },
+    { 0x0E, 0x00, FAILURE, "Invalid Information Unit" },
+    { 0x0E, 0x01, FAILURE, "Information Unit Too Short" },
+    { 0x0E, 0x02, FAILURE, "Information Unit Too Long" },
+    { 0x0E, 0x03, FAILURE, "Invalid Field In Command Information Unit" },
+    { 0x10, 0x00, FAILURE, "ID CRC Or ECC Error" },
+    { 0x10, 0x01, FAILURE, "Logical Block Guard Check Failed" },
+    { 0x10, 0x02, FAILURE, "Logical Block Application Tag Check Failed" },
+    { 0x10, 0x03, FAILURE, "Logical Block Reference Tag Check Failed" },
+    { 0x10, 0x04, FAILURE, "Logical Block Protection Error On Recover Buffered Data" },
+    { 0x10, 0x05, FAILURE, "Logical Block Protection Method Error" },
+    { 0x11, 0x00, FAILURE, "Unrecovered Read Error" },
+    { 0x11, 0x01, FAILURE, "Read Retries Exhausted" },
+    { 0x11, 0x02, FAILURE, "Error Too Long To Correct" },
+    { 0x11, 0x03, FAILURE, "Multiple Read Errors" },
+    { 0x11, 0x04, FAILURE, "Unrecovered Read Error - Auto Reallocate Failed" },
+    { 0x11, 0x05, FAILURE, "L-EC Uncorrectable Error" },
+    { 0x11, 0x06, FAILURE, "CIRC Unrecovered Error" },
+    { 0x11, 0x07, FAILURE, "Data Re-synchonization Error" },
+    { 0x11, 0x08, FAILURE, "Incomplete Block Read" },
+    { 0x11, 0x09, FAILURE, "No Gap Found" },
+    { 0x11, 0x0A, FAILURE, "Miscorrected Error" },
+    { 0x11, 0x0B, FAILURE, "Unrecovered Read Error - Recommend Reassignment" },
+    { 0x11, 0x0C, FAILURE, "Unrecovered Read Error - Recommend Rewrite The Data" },
+    { 0x11, 0x0D, FAILURE, "De-compression CRC Error" },
+    { 0x11, 0x0E, FAILURE, "Cannot Decompress Using Declared Algorithm" },
+    { 0x11, 0x0F, FAILURE, "Error Reading UPC/EAN Number" },
+    { 0x11, 0x10, FAILURE, "Error Reading ISRC Number" },
+    { 0x11, 0x11, FAILURE, "Read Error - Loss Of Streaming" },
+    { 0x11, 0x12, FAILURE, "Auxiliary Memory Read Error" },
+    { 0x11, 0x13, FAILURE, "Read Error - Failed Retransmission Request" },
+    { 0x11, 0x14, FAILURE, "Read Error - LBA Marked Bad By Application Client" },
+    { 0x11, 0x15, FAILURE, "Write After Sanitize Required" },
+    { 0x12, 0x00, FAILURE, "Address Mark Not Found for ID Field" },
+    { 0x13, 0x00, FAILURE, "Address Mark Not Found for Data Field" },
+    { 0x14, 0x00, FAILURE, "Recorded Entity Not Found" },
+    { 0x14, 0x01, FAILURE, "Record Not Found" },
+    { 0x14, 0x02, FAILURE, "Filemark Or Setmark Not Found" },
+    { 0x14, 0x03, FAILURE, "End-Of-Data Not Found" },
+    { 0x14, 0x04, FAILURE, "Block Sequence Error" },
+    { 0x14, 0x05, FAILURE, "Record Not Found - Recommend Reassignment" },
+    { 0x14, 0x06, FAILURE, "Record Not Found - Data Auto-Reallocated" },
+    { 0x14, 0x07, FAILURE, "Locate Operation Failure" },
+    { 0x15, 0x00, FAILURE, "Random Positioning Error" },
+    { 0x15, 0x01, FAILURE, "Mechanical Positioning Error" },
+    { 0x15, 0x02, FAILURE, "Positioning Error Detected By Read Of Medium" },
+    { 0x16, 0x00, FAILURE, "Data Synchronization Mark Error" },
+    { 0x16, 0x01, SUCCESS, "Data Sync Error - Data Rewritten" },
+    { 0x16, 0x02, FAILURE, "Data Sync Error - Recommend Rewrite" },
+    { 0x16, 0x03, SUCCESS, "Data Sync Error - Data Auto-Reallocation" },
+    { 0x16, 0x04, FAILURE, "Data Sync Error - Recommend Reassignment" },
+    { 0x17, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With No Error Correction Applied" },
+    { 0x17, 0x01, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With Retries" },
+    { 0x17, 0x02, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With Positive Head Offset" },
+    { 0x17, 0x03, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With Negative Head Offset" },
+    { 0x17, 0x04, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With Retries And/Or CIRC Applied" },
+    { 0x17, 0x05, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data Using Previous Sector ID" },
+    { 0x17, 0x06, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data Without ECC - Data Auto-Reallocated" },
+    { 0x17, 0x07, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data Without ECC - Recommend Reassignment" },
+    { 0x17, 0x08, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data Without ECC - Recommend Rewrite" },
+    { 0x17, 0x09, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data Without ECC - Data Rewritten" },
+    { 0x18, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With Error Correction Applied" },
+    { 0x18, 0x01, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With Error Correction & Retries Applied" },
+    { 0x18, 0x02, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data - Data Auto-Reallocated" },
+    { 0x18, 0x03, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With CIRC" },
+    { 0x18, 0x04, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With L-EC" },
+    { 0x18, 0x05, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data - Recommend Reassignment" },
+    { 0x18, 0x06, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data - Recommend Rewrite" },
+    { 0x18, 0x07, SENSE_RESULT_FROM_SENSE_KEY, "Recovered Data With ECC - Data Rewritten" },
+    { 0x18, 0x08, FAILURE, "Recovered Data With Linking" },
+    { 0x19, 0x00, FAILURE, "Defect List Error" },
+    { 0x19, 0x01, FAILURE, "Defect List Not Available" },
+    { 0x19, 0x02, FAILURE, "Defect List Error In Primary List" },
+    { 0x19, 0x03, FAILURE, "Defect List Error In Grown List" },
+    { 0x1A, 0x00, FAILURE, "Parameter List Length Error" },
+    { 0x1B, 0x00, FAILURE, "Synchronous Data Transfer Error" },
+    { 0x1C, 0x00, FAILURE, "Defect List Not Found" },
+    { 0x1C, 0x01, FAILURE, "Primary Defect List Not Found" },
+    { 0x1C, 0x02, FAILURE, "Grown Defect List Not Found" },
+    { 0x1D, 0x00, FAILURE, "Miscompare During Verify Operation" },
+    { 0x1D, 0x01, FAILURE, "Miscompare During Verify Of Unmapped LBA" },
+    { 0x1E, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Recovered ID With ECC Correction" },
+    { 0x1F, 0x00, FAILURE, "Partial Defect List Transfer" },
+    { 0x20, 0x00, NOT_SUPPORTED, "Invalid Command Operation Code" },
+    { 0x20, 0x01, FAILURE, "Access Denied - Initiator Pending - Enrolled" },
+    { 0x20, 0x02, FAILURE, "Access Denied - No Access Rights" },
+    { 0x20, 0x03, FAILURE, "Access Denied - Invalid Management ID Key" },
+    { 0x20, 0x04, FAILURE, "Illegal Command While In Write Capable State" },
+    { 0x20, 0x05, FAILURE, "Illegal Command While In Read Capable State" },
+    { 0x20, 0x06, FAILURE, "Illegal Command While In Explicit Address Mode" },
+    { 0x20, 0x07, FAILURE, "Illegal Command While In Implicit Address Mode" },
+    { 0x20, 0x08, FAILURE, "Access Denied - Enrollment Conflict" },
+    { 0x20, 0x09, FAILURE, "Access Denied - Invalid Logical Unit Identifier" },
+    { 0x20, 0x0A, FAILURE, "Access Denied - Invalid Proxy Token" },
+    { 0x20, 0x0B, FAILURE, "Access Denied - ACL LUN Conflict" },
+    { 0x20, 0x0C, FAILURE, "Illegal Command When Not In Append-Only Mode" },
+    { 0x20, 0x0D, FAILURE, "Not An Administrative Logical Unit" },
+    { 0x20, 0x0E, FAILURE, "Not A Subsidiary Logical Unit" },
+    { 0x20, 0x0F, FAILURE, "Not A Conglomerate Logical Unit" },
+    { 0x21, 0x00, FAILURE, "Logical Block Address Out Of Range" },
+    { 0x21, 0x01, FAILURE, "Invalid Element Address" },
+    { 0x21, 0x02, FAILURE, "Invalid Address For Write" },
+    { 0x21, 0x03, FAILURE, "Invalid Write Crossing Layer Jump" },
+    { 0x21, 0x04, FAILURE, "Unaligned Write Command" },
+    { 0x21, 0x05, FAILURE, "Write Boundary Violation" },
+    { 0x21, 0x06, FAILURE, "Attempt To Read Invalid Data" },
+    { 0x21, 0x07, FAILURE, "Read Boundary Violation" },
+    { 0x21, 0x08, FAILURE, "Misaligned Write Command" },
+    { 0x22, 0x00, NOT_SUPPORTED, "Illegal Function. Use 22 00, 24 00, or 26 00" },
+    { 0x23, 0x00, FAILURE, "Invalid Token Operation - Cause Not Reportable" },
+    { 0x23, 0x01, FAILURE, "Invalid Token Operation - Unsupported Token Type" },
+    { 0x23, 0x02, NOT_SUPPORTED, "Invalid Token Operation - Remote Token Usage Not Supported" },
+    { 0x23, 0x03, NOT_SUPPORTED, "Invalid Token Operation - Remote ROD Token Creation Not Supported" },
+    { 0x23, 0x04, FAILURE, "Invalid Token Operation - Token Unknown" },
+    { 0x23, 0x05, FAILURE, "Invalid Token Operation - Token Corrupt" },
+    { 0x23, 0x06, FAILURE, "Invalid Token Operation - Token Revoked" },
+    { 0x23, 0x07, FAILURE, "Invalid Token Operation - Token Expired" },
+    { 0x23, 0x08, FAILURE, "Invalid Token Operation - Token Cancelled" },
+    { 0x23, 0x09, FAILURE, "Invalid Token Operation - Token Deleted" },
+    { 0x23, 0x0A, FAILURE, "Invalid Token Operation - Invalid Token Length" },
+    { 0x24, 0x00, NOT_SUPPORTED, "Invalid Field In CDB" },
+    { 0x24, 0x01, FAILURE, "CDB Decryption Error" },
+    { 0x24, 0x02, FAILURE, "Invalid CDB Field While In Explicit Block Address Model" },
+    { 0x24, 0x03, FAILURE, "Invalid CDB Field While In Implicit Block Address Model" },
+    { 0x24, 0x04, FAILURE, "Security Audit Value Frozen" },
+    { 0x24, 0x05, FAILURE, "Security Working Key Frozen" },
+    { 0x24, 0x06, FAILURE, "Nonce Not Unique" },
+    { 0x24, 0x07, FAILURE, "Nonce Timestamp Out Of Range" },
+    { 0x24, 0x08, FAILURE, "Invalid XCDB" },
+    { 0x24, 0x09, FAILURE, "Invalid Fast Format" },
+    { 0x25, 0x00, NOT_SUPPORTED, "Logical Unit Not Supported" },
+    { 0x26, 0x00, FAILURE, "Invalid Field In Parameter List" },
+    { 0x26, 0x01, NOT_SUPPORTED, "Parameter Not Supported" },
+    { 0x26, 0x02, FAILURE, "Parameter Value Invalid" },
+    { 0x26, 0x03, NOT_SUPPORTED, "Threshold Parameters Not Supported" },
+    { 0x26, 0x04, FAILURE, "Invalid Release Of Persistent Reservation" },
+    { 0x26, 0x05, FAILURE, "Data Decryption Error" },
+    { 0x26, 0x06, FAILURE, "Too Many Target Descriptors" },
+    { 0x26, 0x07, NOT_SUPPORTED, "Unsupported Target Descriptor Type Code" },
+    { 0x26, 0x08, FAILURE, "Too Many Segment Descriptors" },
+    { 0x26, 0x09, FAILURE, "Unsupported Segment Descriptor Type Code" },
+    { 0x26, 0x0A, FAILURE, "Unexpected Inexact Segment" },
+    { 0x26, 0x0B, FAILURE, "Inline Data Length Exceeded" },
+    { 0x26, 0x0C, FAILURE, "Invalid Operation For Copy Source Or Destination" },
+    { 0x26, 0x0D, FAILURE, "Copy Segment Granularity Violation" },
+    { 0x26, 0x0E, FAILURE, "Invalid Parameter While Port Is Enabled" },
+    { 0x26, 0x0F, FAILURE, "Invalid Data-Out Buffer Integrity Check Value" },
+    { 0x26, 0x10, FAILURE, "Data Decryption Key Fail Limit Reached" },
+    { 0x26, 0x11, FAILURE, "Incomplete Key-Associated Data Set" },
+    { 0x26, 0x12, FAILURE, "Vendor Specific Key Reference Not Found" },
+    { 0x26, 0x13, FAILURE, "Application Tag Mode Page Is Invalid" },
+    { 0x26, 0x14, FAILURE, "Tape Stream Mirroring Prevented" },
+    { 0x26, 0x15, FAILURE, "Copy Source Or Copy Destination Not Authorized" },
+    { 0x27, 0x00, FAILURE, "Write Protected" },
+    { 0x27, 0x01, FAILURE, "Hardware Write Protected" },
+    { 0x27, 0x02, FAILURE, "Logical Unit Software Write Protected" },
+    { 0x27, 0x03, FAILURE, "Associated Write Protect" },
+    { 0x27, 0x04, FAILURE, "Persistent Write Protect" },
+    { 0x27, 0x05, FAILURE, "Permanent Write Protect" },
+    { 0x27, 0x06, FAILURE, "Conditional Write Protect" },
+    { 0x27, 0x07, FAILURE, "Space Allocation Failed Write Protect" },
+    { 0x27, 0x08, FAILURE, "Zone Is Read Only" },
+    { 0x28, 0x00, FAILURE, "Not Ready To Ready Change, Medium May Have Changed" },
+    { 0x28, 0x01, SUCCESS, "Import or Export Element Accessed" },
+    { 0x28, 0x02, FAILURE, "Format-Layer May Have Changed" },
+    { 0x28, 0x03, FAILURE, "Import/Export Element Accessed, Medium Changed" },
+    { 0x29, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Power On, Reset, Or Bus Device Reset Occurred" },
+    { 0x29, 0x01, SENSE_RESULT_FROM_SENSE_KEY, "Power On Occurred" },
+    { 0x29, 0x02, SENSE_RESULT_FROM_SENSE_KEY, "SCSI Bus Reset Occurred" },
+    { 0x29, 0x03, SENSE_RESULT_FROM_SENSE_KEY, "Bus Device Reset Function Occurred" },
+    { 0x29, 0x04, SENSE_RESULT_FROM_SENSE_KEY, "Device Internal Reset" },
+    { 0x29, 0x05, SENSE_RESULT_FROM_SENSE_KEY, "Transceiver Mode Changed To Single-Ended" },
+    { 0x29, 0x06, SENSE_RESULT_FROM_SENSE_KEY, "Transceiver Mode Changed To LVD" },
+    { 0x29, 0x07, FAILURE, "I_T Nexus Loss Occurred" },
+    { 0x2A, 0x00, SUCCESS, "Parameters Changed" },
+    { 0x2A, 0x01, SUCCESS, "Mode Parameters Changed" },
+    { 0x2A, 0x02, SUCCESS, "Log Parameters Changed" },
+    { 0x2A, 0x03, SUCCESS, "Reservations Preempted" },
+    { 0x2A, 0x04, SUCCESS, "Reservations Released" },
+    { 0x2A, 0x05, SUCCESS, "Registrations Preempted" },
+    { 0x2A, 0x06, FAILURE, "Asymmetric Access State Changed" },
+    { 0x2A, 0x07, FAILURE, "Implicit Asymetric Access State Transition Failed" },
+    { 0x2A, 0x08, SUCCESS, "Priority Changed" },
+    { 0x2A, 0x09, SUCCESS, "Capacity Data Has Changed" },
+    { 0x2A, 0x0A, SUCCESS, "Error History I_T Nexus Cleared" },
+    { 0x2A, 0x0B, SUCCESS, "Error History Snapshot Released" },
+    { 0x2A, 0x0C, SUCCESS, "Error Recovery Attributes Have Changed" },
+    { 0x2A, 0x0D, SUCCESS, "Data Encryption Capabilities Changed" },
+    { 0x2A, 0x10, SUCCESS, "Timestamp Changed" },
+    { 0x2A, 0x11, SENSE_RESULT_FROM_SENSE_KEY, "Data Encryption Parameters Changed By Another I_T Nexus" },
+    { 0x2A, 0x12, SENSE_RESULT_FROM_SENSE_KEY, "Data Encryption Parameters Changed By Vendor Specific Event" },
+    { 0x2A, 0x13, SENSE_RESULT_FROM_SENSE_KEY, "Data Encryption Key Instance Counter Has Changed" },
+    { 0x2A, 0x14, SUCCESS, "SA Creation Capabilities Has Changed" },
+    { 0x2A, 0x15, FAILURE, "Medium Removal Precention Preempted" },
+    { 0x2A, 0x16, SENSE_RESULT_FROM_SENSE_KEY, "Zone Reset Write Pointer Recommended" },
+    { 0x2B, 0x00, FAILURE, "Copy Cannot Execute Since Host Cannot Disconnect" },
+    { 0x2C, 0x00, FAILURE, "Command Sequence Error" },
+    { 0x2C, 0x01, FAILURE, "Too Many Windows Specified" },
+    { 0x2C, 0x02, FAILURE, "Invalid Combination Of Windows Specified" },
+    { 0x2C, 0x03, FAILURE, "Current Program Area Is Not Empty" },
+    { 0x2C, 0x04, SENSE_RESULT_FROM_SENSE_KEY, "Current Program Area Is Empty" },
+    { 0x2C, 0x05, FAILURE, "Illegal Power Condition Request" },
+    { 0x2C, 0x06, FAILURE, "Persistent Prevent Conflict" },
+    { 0x2C, 0x07, FAILURE, "Previous Busy Status" },
+    { 0x2C, 0x08, FAILURE, "Previous Task Set Full Status" },
+    { 0x2C, 0x09, FAILURE, "Previous Reservation Conflict Status" },
+    { 0x2C, 0x0A, SENSE_RESULT_FROM_SENSE_KEY, "Partition Or Collection Contains User Objects" },
+    { 0x2C, 0x0B, SENSE_RESULT_FROM_SENSE_KEY, "Not Reserved" },
+    { 0x2C, 0x0C, FAILURE, "ORWrite Generation Does Not Match" },
+    { 0x2C, 0x0D, FAILURE, "Reset Write Pointer Not Allowed" },
+    { 0x2C, 0x0E, FAILURE, "Zone Is Offline" },
+    { 0x2C, 0x0F, FAILURE, "Stream Not Open" },
+    { 0x2C, 0x10, SENSE_RESULT_FROM_SENSE_KEY, "Unwritten Data In Zone" },
+    { 0x2C, 0x11, FAILURE, "Descriptor Format Sense Data Required" },
+    { 0x2D, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Overwrite Error On Update In Place" },
+    { 0x2E, 0x00, FAILURE, "Insufficient Time For Operation" },
+    { 0x2E, 0x01, FAILURE, "Command Timeout Before Processing" },
+    { 0x2E, 0x02, FAILURE, "Command Timeout During Processing" },
+    { 0x2E, 0x03, FAILURE, "Command Timeout During Processing Due To Error Recovery" },
+    { 0x2F, 0x00, FAILURE, "Commands Cleared By Another Initiator" },
+    { 0x2F, 0x01, FAILURE, "Commands Cleared By Power Loss Notification" },
+    { 0x2F, 0x02, FAILURE, "Commands Cleared By Device Server" },
+    { 0x2F, 0x03, FAILURE, "Some Commands Cleared By Queuing Layer Event" },
+    { 0x30, 0x00, FAILURE, "Incompatible Medium Installed" },
+    { 0x30, 0x01, FAILURE, "Cannot Read Medium - Unknown Format" },
+    { 0x30, 0x02, FAILURE, "Cannot Read Medium - Incompatible Format" },
+    { 0x30, 0x03, UNKNOWN, "Cleaning Cartridge Installed" },
+    { 0x30, 0x04, FAILURE, "Cannot Write Medium - Unknown Format" },
+    { 0x30, 0x05, FAILURE, "Cannot Write Medium - Incompatible Format" },
+    { 0x30, 0x06, FAILURE, "Cannot Format Medium - Incompatible Medium" },
+    { 0x30, 0x07, FAILURE, "Cleaning Failure" },
+    { 0x30, 0x08, FAILURE, "Cannot Write - Application Code Mismatch" },
+    { 0x30, 0x09, FAILURE, "Current Session Not Fixated For Append" },
+    { 0x30, 0x0A, FAILURE, "Cleaning Request Rejected" },
+    { 0x30, 0x0C, FAILURE, "WORM Medium - Overwrite Attempted" },
+    { 0x30, 0x0D, FAILURE, "WORM Medium - Integrity Check" },
+    { 0x30, 0x10, FAILURE, "Medium Not Formatted" },
+    { 0x30, 0x11, FAILURE, "Incompatible Volume Type" },
+    { 0x30, 0x12, FAILURE, "Incompatible Volume Qualifier" },
+    { 0x30, 0x13, FAILURE, "Cleaning Volume Expired" },
+    { 0x31, 0x00, FAILURE, "Medium Format Corrupted" },
+    { 0x31, 0x01, FAILURE, "Format Command Failed" },
+    { 0x31, 0x02, FAILURE, "Zoned Formatting Failed Due To Spare Linking" },
+    { 0x31, 0x03, FAILURE, "Sanitize Command Failed" },
+    { 0x32, 0x00, FAILURE, "No Defect Space Location Available" },
+    { 0x32, 0x01, FAILURE, "Defect List Update Failure" },
+    { 0x33, 0x00, FAILURE, "Tape Length Error" },
+    { 0x34, 0x00, FAILURE, "Enclosure Failure" },
+    { 0x35, 0x00, FAILURE, "Enclosure Services Failure" },
+    { 0x35, 0x01, NOT_SUPPORTED, "Unsupported Enclosure Function" },
+    { 0x35, 0x02, NOT_SUPPORTED, "Enclosure Services Unavailable" },
+    { 0x35, 0x03, FAILURE, "Enclosure Services Transfer Failure" },
+    { 0x35, 0x04, FAILURE, "Enclosure Services Transfer Refused" },
+    { 0x35, 0x05, FAILURE, "Enclosure Services Checksum Failure" },
+    { 0x36, 0x00, FAILURE, "Ribbon, Ink, Or Toner Failure" },
+    { 0x37, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Rounded Parameter" },
+    { 0x38, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Event Status Notification" },
+    { 0x38, 0x02, SENSE_RESULT_FROM_SENSE_KEY, "ESN - Power Management Class Event" },
+    { 0x38, 0x04, SENSE_RESULT_FROM_SENSE_KEY, "ESN - Media Class Event" },
+    { 0x38, 0x06, SENSE_RESULT_FROM_SENSE_KEY, "ESN - Device Busy Class Event" },
+    { 0x38, 0x07, FAILURE, "Thin Provisioning Soft Threshold Reached" },
+    { 0x39, 0x00, NOT_SUPPORTED, "Saving Parameters Not Supported" },
+    { 0x3A, 0x00, FAILURE, "Medium Not Present" },
+    { 0x3A, 0x01, FAILURE, "Medium Not Present - Tray Closed" },
+    { 0x3A, 0x02, FAILURE, "Medium Not Present - Tray Open" },
+    { 0x3A, 0x03, FAILURE, "Medium Not Present - Loadable" },
+    { 0x3A, 0x04, FAILURE, "Medium Not Present - Medium Auxilary Memory Accessible" },
+    { 0x3B, 0x00, FAILURE, "Sequential Positioning Error" },
+    { 0x3B, 0x01, FAILURE, "Tape Position Error At Beginning-Of-Medium" },
+    { 0x3B, 0x02, FAILURE, "Tape Position Error At End-Of-Medium" },
+    { 0x3B, 0x03, FAILURE, "Tape Or Electronic Vertical Forms Unit Not Ready" },
+    { 0x3B, 0x04, FAILURE, "Slew Failure" },
+    { 0x3B, 0x05, FAILURE, "Paper Jam" },
+    { 0x3B, 0x06, FAILURE, "Failed To Sense Top-Of-Form" },
+    { 0x3B, 0x07, FAILURE, "Failed To Sense Bottom-Of-Form" },
+    { 0x3B, 0x08, FAILURE, "Reposition Error" },
+    { 0x3B, 0x09, FAILURE, "Read Past End Of Medium" },
+    { 0x3B, 0x0A, FAILURE, "Read Past Beginning Of Medium" },
+    { 0x3B, 0x0B, FAILURE, "Position Past End Of Medium" },
+    { 0x3B, 0x0C, FAILURE, "Position Past Beginning Of Medium" },
+    { 0x3B, 0x0D, FAILURE, "Medium Destination Element Full" },
+    { 0x3B, 0x0E, FAILURE, "Medium Source Element Empty" },
+    { 0x3B, 0x0F, SENSE_RESULT_FROM_SENSE_KEY, "End Of Medium Reached" },
+    { 0x3B, 0x11, SENSE_RESULT_FROM_SENSE_KEY, "Medium Magazine Not Accessible" },
+    { 0x3B, 0x12, SENSE_RESULT_FROM_SENSE_KEY, "Medium Magazine Removed" },
+    { 0x3B, 0x13, SENSE_RESULT_FROM_SENSE_KEY, "Medium Magazine Inserted" },
+    { 0x3B, 0x14, SENSE_RESULT_FROM_SENSE_KEY, "Medium Magazine Locked" },
+    { 0x3B, 0x15, SENSE_RESULT_FROM_SENSE_KEY, "Medium Magazine Unlocked" },
+    { 0x3B, 0x16, FAILURE, "Mechanical Positioning Or Changer Error" },
+    { 0x3B, 0x17, FAILURE, "Read Past End Of User Object" },
+    { 0x3B, 0x18, SENSE_RESULT_FROM_SENSE_KEY, "Element Disabled" },
+    { 0x3B, 0x19, SENSE_RESULT_FROM_SENSE_KEY, "Element Enabled" },
+    { 0x3B, 0x1A, SENSE_RESULT_FROM_SENSE_KEY, "Data Transfer Device Removed" },
+    { 0x3B, 0x1B, SENSE_RESULT_FROM_SENSE_KEY, "Data Transfer Device Inserted" },
+    { 0x3B, 0x1C, FAILURE, "Too Many Logical Objects On Partition To Supported Operation" },
+    { 0x3D, 0x00, FAILURE, "Invalid Bits In Identify Message" },
+    { 0x3E, 0x00, FAILURE, "Logical Unit Has Not Self-Configured Yet" },
+    { 0x3E, 0x01, FAILURE, "Logical Unit Failure" },
+    { 0x3E, 0x02, FAILURE, "Timeout On Logical Unit" },
+    { 0x3E, 0x03, FAILURE, "Logical Unit Failed Self-Test" },
+    { 0x3E, 0x04, FAILURE, "Logical Unit Unable to Update Self-Test Log" },
+    { 0x3F, 0x00, SUCCESS, "Target Operating Conditions Have Changed" },
+    { 0x3F, 0x01, SUCCESS, "Microcode Has Been Changed" },
+    { 0x3F, 0x02, SUCCESS, "Changed Operation Definition" },
+    { 0x3F, 0x03, SUCCESS, "Inquiry Data Has Changed" },
+    { 0x3F, 0x04, SUCCESS, "Component Device Attached" },
+    { 0x3F, 0x05, SUCCESS, "Device Identifier Changed" },
+    { 0x3F, 0x06, SUCCESS, "Redundancy Group Created Or Modified" },
+    { 0x3F, 0x07, SUCCESS, "Redundancy Group Deleted" },
+    { 0x3F, 0x08, SUCCESS, "Spare Created Or Modified" },
+    { 0x3F, 0x09, SUCCESS, "Spare Deleted" },
+    { 0x3F, 0x0A, SUCCESS, "Volume Set Created Or Modified" },
+    { 0x3F, 0x0B, SUCCESS, "Volume Set Deleted" },
+    { 0x3F, 0x0C, SUCCESS, "Volume Set Deassigned" },
+    { 0x3F, 0x0D, SUCCESS, "Volume Set Reassigned" },
+    { 0x3F, 0x0E, SUCCESS, "Reported LUNs Data Has Changed" },
+    { 0x3F, 0x0F, SUCCESS, "Echo Buffer Overwritten" },
+    { 0x3F, 0x10, SUCCESS, "Medium Loadable" },
+    { 0x3F, 0x11, SUCCESS, "Medium Auxilary Memory Accessible" },
+    { 0x3F, 0x12, SUCCESS, "iSCSI IP Address Added" },
+    { 0x3F, 0x13, SUCCESS, "iSCSI IP Address Removed" },
+    { 0x3F, 0x14, SUCCESS, "iSCSI IP Address Changed" },
+    { 0x3F, 0x15, SUCCESS, "Inspect Referrals Sense Descriptors" },
+    { 0x3F, 0x16, SUCCESS, "Microcode Has Been Changed Without Reset" },
+    { 0x3F, 0x17, SUCCESS, "Zone Transition To Full" },
+    { 0x3F, 0x18, SENSE_RESULT_FROM_SENSE_KEY, "Bind Completed" },
+    { 0x3F, 0x19, SENSE_RESULT_FROM_SENSE_KEY, "Bind Redirected" },
+    { 0x3F, 0x1A, SENSE_RESULT_FROM_SENSE_KEY, "Subsidiary Binding Changed" },
+    { 0x40, 0x00, FAILURE, "RAM Failure (Should Use 40 NN) " },
+    { 0x41, 0x00, FAILURE, "Data Path Failure (Should Use 40NN)" },
+    { 0x42, 0x00, FAILURE, "Power-on Or Self-Test Failure (Should use 40 NN)" },
+    { 0x43, 0x00, FAILURE, "Message Error" },
+    { 0x44, 0x00, FAILURE, "Internal Target Failure" },
+    { 0x44, 0x01, FAILURE, "Persistent Reservation Information Lost" },
+    { 0x44, 0x71, FAILURE, "ATA Device Failed Set Features" },
+    { 0x45, 0x00, FAILURE, "Select Or Reselect Failure" },
+    { 0x46, 0x00, FAILURE, "Unsuccessful Soft Reset" },
+    { 0x47, 0x00, FAILURE, "SCSI Parity Error" },
+    { 0x47, 0x01, FAILURE, "Data Phase CRC Error Detected" },
+    { 0x47, 0x02, FAILURE, "SCSI Parity Error Detected During ST Data Phase" },
+    { 0x47, 0x03, FAILURE, "Information Unit uiCRC Error Detected" },
+    { 0x47, 0x04, FAILURE, "Asynchronous Information Protection Error Detected" },
+    { 0x47, 0x05, FAILURE, "Protocol Service CRC Error" },
+    { 0x47, 0x06, IN_PROGRESS, "PHY Test Function In Progress" },
+    { 0x47, 0x7F, FAILURE, "Some Commands Cleared By ISCSI Protocol Event" },
+    { 0x48, 0x00, SUCCESS, "Initiator Detected Error Message Received" },
+    { 0x49, 0x00, FAILURE, "Invalid Message Error" },
+    { 0x4A, 0x00, FAILURE, "Command Phase Error" },
+    { 0x4B, 0x00, FAILURE, "Data Phase Error" },
+    { 0x4B, 0x01, FAILURE, "Invalid Target Port Transfer Tag Received" },
+    { 0x4B, 0x02, FAILURE, "Too Much Write Data" },
+    { 0x4B, 0x03, FAILURE, "ACK/NAK Timeout" },
+    { 0x4B, 0x04, SUCCESS, "NAK Received" },
+    { 0x4B, 0x05, FAILURE, "Data Offset Error" },
+    { 0x4B, 0x06, FAILURE, "Initiator Response Timeout" },
+    { 0x4B, 0x07, FAILURE, "Connection Lost" },
+    { 0x4B, 0x08, FAILURE, "Data-In Buffer Overflow - Data Buffer Size" },
+    { 0x4B, 0x09, FAILURE, "Data-In Buffer Overflow - Data Buffer Descriptor Area" },
+    { 0x4B, 0x0A, FAILURE, "Data-In Buffer Error" },
+    { 0x4B, 0x0B, FAILURE, "Data-Out Buffer Overflow - Data Buffer Size" },
+    { 0x4B, 0x0C, FAILURE, "Data-Out Buffer Overflow - Data Buffer Descriptor Area" },
+    { 0x4B, 0x0D, FAILURE, "Data-Out Buffer Error" },
+    { 0x4B, 0x0E, FAILURE, "PCIE Fabric Error" },
+    { 0x4B, 0x0F, FAILURE, "PCIE Completion Timeout" },
+    { 0x4B, 0x10, FAILURE, "PCIE Completer Abort" },
+    { 0x4B, 0x11, FAILURE, "PCIE Poisoned TLP Received" },
+    { 0x4B, 0x12, FAILURE, "PCIE ECRC Check Failed" },
+    { 0x4B, 0x13, NOT_SUPPORTED, "PCIE Unsupported Request" },
+    { 0x4B, 0x14, FAILURE, "PCIE ACS Violation" },
+    { 0x4B, 0x15, FAILURE, "PCIE TLP Prefix Blocked" },
+    { 0x4C, 0x00, FAILURE, "Logical Unit Failed Self-Configuration" },
+    { 0x4E, 0x00, FAILURE, "Overlapped Commands Attempted" },
+    { 0x50, 0x00, FAILURE, "Write Append Error" },
+    { 0x50, 0x01, FAILURE, "Write Append Position Error" },
+    { 0x50, 0x02, FAILURE, "Position Error Related To Timing" },
+    { 0x51, 0x00, FAILURE, "Erase Failure" },
+    { 0x51, 0x01, FAILURE, "Erase Failure - Incomplete Erase Operation Detected" },
+    { 0x52, 0x00, FAILURE, "Cartridge Fault" },
+    { 0x53, 0x00, FAILURE, "Media Load Or Eject Failed" },
+    { 0x53, 0x01, FAILURE, "Unload Tape Failure" },
+    { 0x53, 0x02, FAILURE, "Medium Removal Prevented" },
+    { 0x53, 0x03, FAILURE, "Medium Removal Prevented By Data Transfer Element" },
+    { 0x53, 0x04, FAILURE, "Medium Thread Or Unthread Failure" },
+    { 0x53, 0x05, FAILURE, "Volume Identifier Invalid" },
+    { 0x53, 0x06, FAILURE, "Volume Identifier Missing" },
+    { 0x53, 0x07, FAILURE, "Duplicate Volume Identifier" },
+    { 0x53, 0x08, FAILURE, "Element Status Unknown" },
+    { 0x53, 0x09, FAILURE, "Data Transfer Device Error - Load Failed" },
+    { 0x53, 0x0A, FAILURE, "Data Transfer Device Error - Unload Failed" },
+    { 0x53, 0x0B, FAILURE, "Data Transfer Device Error - Unload Missing" },
+    { 0x53, 0x0C, FAILURE, "Data Transfer Device Error - Eject Failed" },
+    { 0x53, 0x0D, FAILURE, "Data Transfer Device Error - Library Communication Failed" },
+    { 0x54, 0x00, FAILURE, "SCSI To host System Interface Failure" },
+    { 0x55, 0x00, FAILURE, "System Resource Failure" },
+    { 0x55, 0x01, FAILURE, "System Buffer Full" },
+    { 0x55, 0x02, FAILURE, "Insufficient Reservation Resources" },
+    { 0x55, 0x03, FAILURE, "Insufficient Resources" },
+    { 0x55, 0x04, FAILURE, "Insufficient Registration Resources" },
+    { 0x55, 0x05, FAILURE, "Insufficient Access Control Resources" },
+    { 0x55, 0x06, FAILURE, "Auxiliary Memory Out Of Space" },
+    { 0x55, 0x07, FAILURE, "Quota Error" },
+    { 0x55, 0x08, FAILURE, "Maximum Number Of Supplemental Decryption Keys Exceeded" },
+    { 0x55, 0x09, FAILURE, "Medium Auxilary Memory Not Accessible" },
+    { 0x55, 0x0A, FAILURE, "Data Currently Unavailable" },
+    { 0x55, 0x0B, FAILURE, "Insufficient Power For Operation" },
+    { 0x55, 0x0C, FAILURE, "Insufficient Resources To Create ROD" },
+    { 0x55, 0x0D, FAILURE, "Insufficient Resources To Create ROD Token" },
+    { 0x55, 0x0E, FAILURE, "Insufficient Zone Resources" },
+    { 0x55, 0x0F, SENSE_RESULT_FROM_SENSE_KEY, "Insufficient Zone Resources To Complete Write" },
+    { 0x55, 0x10, SENSE_RESULT_FROM_SENSE_KEY, "Maximum Number Of Streams Open" },
+    { 0x55, 0x11, SENSE_RESULT_FROM_SENSE_KEY, "Insufficient Resources To Bind" },
+    { 0x57, 0x00, FAILURE, "Unable To Recover Table-Of-Contents" },
+    { 0x58, 0x00, FAILURE, "Generation Does Not Exist" },
+    { 0x59, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Updated Block Read" },
+    { 0x5A, 0x00, FAILURE, "Operator Request Or State Change Input" },
+    { 0x5A, 0x01, FAILURE, "Operator Medium Removal Request" },
+    { 0x5A, 0x02, FAILURE, "Operator Selected Write Protect" },
+    { 0x5A, 0x03, FAILURE, "Operator Selected Write Permit" },
+    { 0x5B, 0x00, FAILURE, "Log Exception" },
+    { 0x5B, 0x01, FAILURE, "Threshold Condition Met" },
+    { 0x5B, 0x02, FAILURE, "Log Counter At Maximum" },
+    { 0x5B, 0x03, FAILURE, "Log List Codes Exhausted" },
+    { 0x5C, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "RPL Status Change" },
+    { 0x5C, 0x01, SUCCESS, "Spindles Synchronized" },
+    { 0x5C, 0x02, FAILURE, "Spindles Not Synchronized" },
+    { 0x5D, 0x00, FAILURE, "Failure Prediction Threshold Exceeded" },
+    { 0x5D, 0x01, FAILURE, "Media Failure Prediction Threshold Exceeded" },
+    { 0x5D, 0x02, FAILURE, "Logical Unit Failure Prediction Threshold Exceeded" },
+    { 0x5D, 0x03, FAILURE, "Spare Area Exhaustion Prediction Threshold Exceeded" },
+    { 0x5D, 0x10, FAILURE, "Hardware Impending Failure - General Hard Drive Failure" },
+    { 0x5D, 0x11, FAILURE, "Hardware Impending Failure - Drive Error Rate Too High" },
+    { 0x5D, 0x12, FAILURE, "Hardware Impending Failure - Data Error Rate Too High" },
+    { 0x5D, 0x13, FAILURE, "Hardware Impending Failure - Seek Error Rate Too High" },
+    { 0x5D, 0x14, FAILURE, "Hardware Impending Failure - Too Many Block Reassigns" },
+    { 0x5D, 0x15, FAILURE, "Hardware Impending Failure - Access Times Too High" },
+    { 0x5D, 0x16, FAILURE, "Hardware Impending Failure - Start Unit Times Too High" },
+    { 0x5D, 0x17, FAILURE, "Hardware Impending Failure - Channel Parametrics" },
+    { 0x5D, 0x18, FAILURE, "Hardware Impending Failure - Controller Detected" },
+    { 0x5D, 0x19, FAILURE, "Hardware Impending Failure - Throughput Performance" },
+    { 0x5D, 0x1A, FAILURE, "Hardware Impending Failure - Seek Time Performance" },
+    { 0x5D, 0x1B, FAILURE, "Hardware Impending Failure - Spin-Up Retry Count" },
+    { 0x5D, 0x1C, FAILURE, "Hardware Impending Failure - Drive Calibration Retry Count" },
+    { 0x5D, 0x1D, FAILURE, "Hardware Impending Failure - Power Loss Protection Circuit" },
+    { 0x5D, 0x20, FAILURE, "Controller Impending Failure - General Hard Drive Failure" },
+    { 0x5D, 0x21, FAILURE, "Controller Impending Failure - Drive Error Rate Too High" },
+    { 0x5D, 0x22, FAILURE, "Controller Impending Failure - Data Error Rate Too High" },
+    { 0x5D, 0x23, FAILURE, "Controller Impending Failure - Seek Error Rate Too High" },
+    { 0x5D, 0x24, FAILURE, "Controller Impending Failure - Too Many Block Reassigns" },
+    { 0x5D, 0x25, FAILURE, "Controller Impending Failure - Access Times Too High" },
+    { 0x5D, 0x26, FAILURE, "Controller Impending Failure - Start Unit Times Too High" },
+    { 0x5D, 0x27, FAILURE, "Controller Impending Failure - Channel Parametrics" },
+    { 0x5D, 0x28, FAILURE, "Controller Impending Failure - Controller Detected" },
+    { 0x5D, 0x29, FAILURE, "Controller Impending Failure - Throughput Performance" },
+    { 0x5D, 0x2A, FAILURE, "Controller Impending Failure - Seek Time Performance" },
+    { 0x5D, 0x2B, FAILURE, "Controller Impending Failure - Spin-Up Retry Count" },
+    { 0x5D, 0x2C, FAILURE, "Controller Impending Failure - Drive Calibration Retry Count" },
+    { 0x5D, 0x30, FAILURE, "Data Channel Impending Failure - General Hard Drive Failure" },
+    { 0x5D, 0x31, FAILURE, "Data Channel Impending Failure - Drive Error Rate Too High" },
+    { 0x5D, 0x32, FAILURE, "Data Channel Impending Failure - Data Error Rate Too High" },
+    { 0x5D, 0x33, FAILURE, "Data Channel Impending Failure - Seek Error Rate Too High" },
+    { 0x5D, 0x34, FAILURE, "Data Channel Impending Failure - Too Many Block Reassigns" },
+    { 0x5D, 0x35, FAILURE, "Data Channel Impending Failure - Access Times Too High" },
+    { 0x5D, 0x36, FAILURE, "Data Channel Impending Failure - Start Unit Times Too High" },
+    { 0x5D, 0x37, FAILURE, "Data Channel Impending Failure - Channel Parametrics" },
+    { 0x5D, 0x38, FAILURE, "Data Channel Impending Failure - Controller Detected" },
+    { 0x5D, 0x39, FAILURE, "Data Channel Impending Failure - Throughput Performance" },
+    { 0x5D, 0x3A, FAILURE, "Data Channel Impending Failure - Seek Time Performance" },
+    { 0x5D, 0x3B, FAILURE, "Data Channel Impending Failure - Spin-Up Retry Count" },
+    { 0x5D, 0x3C, FAILURE, "Data Channel Impending Failure - Drive Calibration Retry Count" },
+    { 0x5D, 0x40, FAILURE, "Servo Impending Failure - General Hard Drive Failure" },
+    { 0x5D, 0x41, FAILURE, "Servo Impending Failure - Drive Error Rate Too High" },
+    { 0x5D, 0x42, FAILURE, "Servo Impending Failure - Data Error Rate Too High" },
+    { 0x5D, 0x43, FAILURE, "Servo Impending Failure - Seek Error Rate Too High" },
+    { 0x5D, 0x44, FAILURE, "Servo Impending Failure - Too Many Block Reassigns" },
+    { 0x5D, 0x45, FAILURE, "Servo Impending Failure - Access Times Too High" },
+    { 0x5D, 0x46, FAILURE, "Servo Impending Failure - Start Unit Times Too High" },
+    { 0x5D, 0x47, FAILURE, "Servo Impending Failure - Channel Parametrics" },
+    { 0x5D, 0x48, FAILURE, "Servo Impending Failure - Controller Detected" },
+    { 0x5D, 0x49, FAILURE, "Servo Impending Failure - Throughput Performance" },
+    { 0x5D, 0x4A, FAILURE, "Servo Impending Failure - Seek Time Performance" },
+    { 0x5D, 0x4B, FAILURE, "Servo Impending Failure - Spin-Up Retry Count" },
+    { 0x5D, 0x4C, FAILURE, "Servo Impending Failure - Drive Calibration Retry Count" },
+    { 0x5D, 0x50, FAILURE, "Spindle Impending Failure - General Hard Drive Failure" },
+    { 0x5D, 0x51, FAILURE, "Spindle Impending Failure - Drive Error Rate Too High" },
+    { 0x5D, 0x52, FAILURE, "Spindle Impending Failure - Data Error Rate Too High" },
+    { 0x5D, 0x53, FAILURE, "Spindle Impending Failure - Seek Error Rate Too High" },
+    { 0x5D, 0x54, FAILURE, "Spindle Impending Failure - Too Many Block Reassigns" },
+    { 0x5D, 0x55, FAILURE, "Spindle Impending Failure - Access Times Too High" },
+    { 0x5D, 0x56, FAILURE, "Spindle Impending Failure - Start Unit Times Too High" },
+    { 0x5D, 0x57, FAILURE, "Spindle Impending Failure - Channel Parametrics" },
+    { 0x5D, 0x58, FAILURE, "Spindle Impending Failure - Controller Detected" },
+    { 0x5D, 0x59, FAILURE, "Spindle Impending Failure - Throughput Performance" },
+    { 0x5D, 0x5A, FAILURE, "Spindle Impending Failure - Seek Time Performance" },
+    { 0x5D, 0x5B, FAILURE, "Spindle Impending Failure - Spin-Up Retry Count" },
+    { 0x5D, 0x5C, FAILURE, "Spindle Impending Failure - Drive Calibration Retry Count" },
+    { 0x5D, 0x60, FAILURE, "Firmware Impending Failure - General Hard Drive Failure" },
+    { 0x5D, 0x61, FAILURE, "Firmware Impending Failure - Drive Error Rate Too High" },
+    { 0x5D, 0x62, FAILURE, "Firmware Impending Failure - Data Error Rate Too High" },
+    { 0x5D, 0x63, FAILURE, "Firmware Impending Failure - Seek Error Rate Too High" },
+    { 0x5D, 0x64, FAILURE, "Firmware Impending Failure - Too Many Block Reassigns" },
+    { 0x5D, 0x65, FAILURE, "Firmware Impending Failure - Access Times Too High" },
+    { 0x5D, 0x66, FAILURE, "Firmware Impending Failure - Start Unit Times Too High" },
+    { 0x5D, 0x67, FAILURE, "Firmware Impending Failure - Channel Parametrics" },
+    { 0x5D, 0x68, FAILURE, "Firmware Impending Failure - Controller Detected" },
+    { 0x5D, 0x69, FAILURE, "Firmware Impending Failure - Throughput Performance" },
+    { 0x5D, 0x6A, FAILURE, "Firmware Impending Failure - Seek Time Performance" },
+    { 0x5D, 0x6B, FAILURE, "Firmware Impending Failure - Spin-Up Retry Count" },
+    { 0x5D, 0x6C, FAILURE, "Firmware Impending Failure - Drive Calibration Retry Count" },
+    { 0x5D, 0x73, FAILURE, "Media Impending Failure Endurance Limit Met" },
+    { 0x5D, 0xFF, FAILURE, "Failure Prediction Threshold Exceeded (False)" },
+    { 0x5E, 0x00, SUCCESS, "Low Power Condition On" },
+    { 0x5E, 0x01, SUCCESS, "Idle Condition Activated By Timer" },
+    { 0x5E, 0x02, SUCCESS, "Standby Condition Activated By Timer" },
+    { 0x5E, 0x03, SUCCESS, "Idle Condition Activated By Command" },
+    { 0x5E, 0x04, SUCCESS, "Standby Condition Activated By Command" },
+    { 0x5E, 0x05, SUCCESS, "Idle_B Condition Activated By Timer" },
+    { 0x5E, 0x06, SUCCESS, "Idle_B Condition Activated By Command" },
+    { 0x5E, 0x07, SUCCESS, "Idle_C Condition Activated By Timer" },
+    { 0x5E, 0x08, SUCCESS, "Idle_C Condition Activated By Command" },
+    { 0x5E, 0x09, SUCCESS, "Standby_Y Condition Activated By Timer" },
+    { 0x5E, 0x0A, SUCCESS, "Standby_Y Condition Activated By Command" },
+    { 0x5E, 0x41, SUCCESS, "Power State Change To Active" },
+    { 0x5E, 0x42, SUCCESS, "Power State Change To Idle" },
+    { 0x5E, 0x43, SUCCESS, "Power State Change To Standby" },
+    { 0x5E, 0x45, SUCCESS, "Power State Change To Sleep" },
+    { 0x5E, 0x47, SUCCESS, "Power State Change To Device Control" },
+    { 0x60, 0x00, FAILURE, "Lamp Failure" },
+    { 0x61, 0x00, FAILURE, "Video ascuisition Error" },
+    { 0x61, 0x01, FAILURE, "Unable To ascuire Video" },
+    { 0x61, 0x02, FAILURE, "Out Of Focus" },
+    { 0x62, 0x00, FAILURE, "Scan Head Positioning Error" },
+    { 0x63, 0x00, FAILURE, "End Of User Area Encountered On This Track" },
+    { 0x63, 0x01, FAILURE, "Packet Does Not Fit In Available Space" },
+    { 0x64, 0x00, FAILURE, "Illegal Mode For This Track" },
+    { 0x64, 0x01, FAILURE, "Invalid Packet Size" },
+    { 0x65, 0x00, FAILURE, "Voltage Fault" },
+    { 0x66, 0x00, FAILURE, "Automatic Document Feeder Cover Up" },
+    { 0x66, 0x01, FAILURE, "Automatic Document Feeder Lift Up" },
+    { 0x66, 0x02, FAILURE, "Document Jam In Automatic Document Feeder" },
+    { 0x66, 0x03, FAILURE, "Document Miss Feed Automatic In Document Feeder" },
+    { 0x67, 0x00, FAILURE, "Configuration Failure" },
+    { 0x67, 0x01, FAILURE, "Configuration Of Incapable Logical Units Failed" },
+    { 0x67, 0x02, FAILURE, "Add Logical Unit Failed" },
+    { 0x67, 0x03, FAILURE, "Modification Of Logical Unit Failed" },
+    { 0x67, 0x04, FAILURE, "Exchange Of Logical Unit Failed" },
+    { 0x67, 0x05, FAILURE, "Remove Of Logical Unit Failed" },
+    { 0x67, 0x06, FAILURE, "Attachment Of Logical Unit Failed" },
+    { 0x67, 0x07, FAILURE, "Creation Of Logical Unit Failed" },
+    { 0x67, 0x08, FAILURE, "Assign Failure Occurred" },
+    { 0x67, 0x09, FAILURE, "Multiply Assigned Logical Unit" },
+    { 0x67, 0x0A, FAILURE, "Set Target Port Groups Command Failed" },
+    { 0x67, 0x0B, NOT_SUPPORTED, "ATA Device Feature Not Enabled" },
+    { 0x67, 0x0C, SENSE_RESULT_FROM_SENSE_KEY, "Command Rejected" },
+    { 0x67, 0x0D, SENSE_RESULT_FROM_SENSE_KEY, "Explicit Bind Not Allowed" },
+    { 0x68, 0x00, FAILURE, "Logical Unit Not Configured" },
+    { 0x68, 0x01, FAILURE, "Subsidiary Logical Unit Not Configured" },
+    { 0x69, 0x00, FAILURE, "Data Loss On Logical Unit" },
+    { 0x69, 0x01, FAILURE, "Multiple Logical Unit Failures" },
+    { 0x69, 0x02, FAILURE, "Parity/Data Mismatch" },
+    { 0x6A, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Informational, Refer To Log" },
+    { 0x6B, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "State Change Has Occurred" },
+    { 0x6B, 0x01, SENSE_RESULT_FROM_SENSE_KEY, "Redundancy Level Got Better" },
+    { 0x6B, 0x02, SENSE_RESULT_FROM_SENSE_KEY, "Redundancy Level Got Worse" },
+    { 0x6C, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Rebuild Failure Occurred" },
+    { 0x6D, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Recalculate Failure Occurred" },
+    { 0x6E, 0x00, FAILURE, "Command To Logical Unit Failed" },
+    { 0x6F, 0x00, FAILURE, "Copy Protection Key Exchange Failure - Authentication Failure" },
+    { 0x6F, 0x01, FAILURE, "Copy Protection Key Exchange Failure - Key Not Present" },
+    { 0x6F, 0x02, FAILURE, "Copy Protection Key Exchange Failure - Key Not Established" },
+    { 0x6F, 0x03, FAILURE, "Read Of Scrambled Sector Without Authentication" },
+    { 0x6F, 0x04, FAILURE, "Media Region Code Is Mismatched To Logical Unit Region" },
+    { 0x6F, 0x05, FAILURE, "Drive Region Must Be Permanent/Region Reset Count Error" },
+    { 0x6F, 0x06, FAILURE, "Insufficient Block Count For Binding Nonce Recording" },
+    { 0x6F, 0x07, FAILURE, "Conflict In Binding Nonce Recording" },
+    { 0x6F, 0x08, SENSE_RESULT_FROM_SENSE_KEY, "Insufficient Permission" },
+    { 0x6F, 0x09, SENSE_RESULT_FROM_SENSE_KEY, "Invalid Drive-Host Pairing Server" },
+    { 0x6F, 0x0A, SENSE_RESULT_FROM_SENSE_KEY, "Drive-Host Pairing Suspended" },
+    { 0x71, 0x00, SENSE_RESULT_FROM_SENSE_KEY, "Decompression Exception Long Algorithm ID" },
+    { 0x72, 0x00, FAILURE, "Session Fixation Error" },
+    { 0x72, 0x01, FAILURE, "Session Fixation Error Writing Lead-In" },
+    { 0x72, 0x02, FAILURE, "Session Fixation Error Writing Lead-Out" },
+    { 0x72, 0x03, FAILURE, "Session Fixation Error - Incomplete Track In Session" },
+    { 0x72, 0x04, FAILURE, "Empty Or Partially Written Reserved Track" },
+    { 0x72, 0x05, FAILURE, "No More Track Reservations Allowed" },
+    { 0x72, 0x06, FAILURE, "RMZ Extension Is Not Allowed" },
+    { 0x72, 0x07, FAILURE, "No More Test Zone Extensions Are Allowed" },
+    { 0x73, 0x00, FAILURE, "CD Control Error" },
+    { 0x73, 0x01, SENSE_RESULT_FROM_SENSE_KEY, "Power Calibration Area Almost Full" },
+    { 0x73, 0x02, SENSE_RESULT_FROM_SENSE_KEY, "Power Calibration Area Is Full" },
+    { 0x73, 0x03, SENSE_RESULT_FROM_SENSE_KEY, "Power Calibration Area Error" },
+    { 0x73, 0x04, SENSE_RESULT_FROM_SENSE_KEY, "Program Memory Area Update Failuer" },
+    { 0x73, 0x05, SENSE_RESULT_FROM_SENSE_KEY, "Program Memory Area Is Full" },
+    { 0x73, 0x06, SENSE_RESULT_FROM_SENSE_KEY, "RMA/PMA Is Almost Full" },
+    { 0x73, 0x10, SENSE_RESULT_FROM_SENSE_KEY, "Current Power Calibration Area Almost Full" },
+    { 0x73, 0x11, SENSE_RESULT_FROM_SENSE_KEY, "Current Power Calibration Area Is Full" },
+    { 0x73, 0x17, SENSE_RESULT_FROM_SENSE_KEY, "RDZ Is Full" },
+    { 0x74, 0x00, FAILURE, "Security Error" },
+    { 0x74, 0x01, FAILURE, "Unable To Decrypt Data" },
+    { 0x74, 0x02, FAILURE, "Unencrypted Data Encountered While Decrypting" },
+    { 0x74, 0x03, FAILURE, "Incorrect Data Encryption Key" },
+    { 0x74, 0x04, FAILURE, "Cryptographic Integrity Validation Failed" },
+    { 0x74, 0x05, FAILURE, "Error Decrypting Data" },
+    { 0x74, 0x06, FAILURE, "Unknown Signature Verification Key" },
+    { 0x74, 0x07, FAILURE, "Encryption Parameters Not Useable" },
+    { 0x74, 0x08, FAILURE, "Digital Signature Validation Failure" },
+    { 0x74, 0x09, FAILURE, "Encryption Mode Mismatch On Read" },
+    { 0x74, 0x0A, FAILURE, "Encrypted Block Not Raw Read Enabled" },
+    { 0x74, 0x0B, FAILURE, "Incorrect Encryption Parameters" },
+    { 0x74, 0x0C, FAILURE, "Unable To Decrypt Parameter List" },
+    { 0x74, 0x0D, FAILURE, "Encryption Algorithm Disabled" },
+    { 0x74, 0x10, FAILURE, "SA Creation Parameter Value Invalid" },
+    { 0x74, 0x11, FAILURE, "SA Creation Parameter Value Rejected" },
+    { 0x74, 0x12, FAILURE, "Invalid SA Usage" },
+    { 0x74, 0x21, FAILURE, "Data Encryption Configuration Prevented" },
+    { 0x74, 0x30, NOT_SUPPORTED, "SA Creation Parameter Not Supported" },
+    { 0x74, 0x40, FAILURE, "Authenticaion Failed" },
+    { 0x74, 0x61, FAILURE, "External Data Encryption Key Manager Access Error" },
+    { 0x74, 0x62, FAILURE, "External Data Encryption Key Manager Error" },
+    { 0x74, 0x63, FAILURE, "External Data Encryption Key Not Found" },
+    { 0x74, 0x64, FAILURE, "External Data Encryption Request Not Authorized" },
+    { 0x74, 0x6E, FAILURE, "External Data Encryption Control Timeout" },
+    { 0x74, 0x6F, FAILURE, "External Data Encryption Control Error" },
+    { 0x74, 0x71, FAILURE, "Logical Unit Access Not Authorized" },
+    { 0x74, 0x79, FAILURE, "Security Conflict In Translated Device" }
+};
+
+static const ascAscqResult* find_ASC_ASCQ_Result(uint8_t asc, uint8_t ascq)
+{
+    uint16_t key = M_BytesTo2ByteValue(asc, ascq);
+    size_t low = 0, high = sizeof(ascAscqResults) / sizeof(ascAscqResults[0]);
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        uint16_t middleKey = M_BytesTo2ByteValue(ascAscqResults[middle].asc, ascAscqResults[middle].ascq);
+        if (middleKey == key)
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            return &ascAscqResults[middle];
         }
-        break;
-    case 0x79:
-        switch (ascq)
+        else if (middleKey < key)
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            low = middle + 1;
         }
-        break;
-    case 0x7A:
-        switch (ascq)
+        else
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            high = middle;
         }
-        break;
-    case 0x7B:
-        switch (ascq)
+    }
+    return NULL;
+}
+
+int check_Sense_Key_ASC_ASCQ_And_FRU(tDevice *device, uint8_t senseKey, uint8_t asc, uint8_t ascq, uint8_t fru)
+{
+    int ret = UNKNOWN;//if this gets returned from this function, then something is not right...
+    const ascAscqResult *ascResult = NULL;
+    //first check the senseKey
+    senseKey = senseKey & 0x0F;//strip off bits that are not part of the sense key
+    ret = senseKeyResults[senseKey].result;
+    if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
+    {
+        print_sense_key(senseKeyResults[senseKey].name, senseKey);
+    }
+    //now check the asc and ascq combination.
+    ascResult = find_ASC_ASCQ_Result(asc, ascq);
+    if (ascResult)
+    {
+        if (ascResult->result != SENSE_RESULT_FROM_SENSE_KEY)
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            ret = ascResult->result;
         }
-        break;
-    case 0x7C:
-        switch (ascq)
+        if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            print_acs_ascq(ascResult->message, asc, ascq);
         }
-        break;
-    case 0x7D:
-        switch (ascq)
+    }
+    else if (asc == 0x40 && ascq >= 0x80)
+    {
+        if (VERBOSITY_COMMAND_NAMES <= device->deviceVerbosity)
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            printf("asc & ascq: %" PRIX8 "h - %" PRIX8 "h = Diagnostic Failure On Component %02" PRIX8 "h\n", asc, ascq, ascq);
         }
-        break;
-    case 0x7E:
-        switch (ascq)
+        ret = FAILURE;
+    }
+    else if (asc == 0x4D)
+    {
+        if (VERBOSITY_COMMAND_NAMES <= device->deviceVerbosity)
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            printf("asc & ascq: %" PRIX8 "h - %" PRIX8 "h = Tagged Overlapped Commands. Task Tag = %02" PRIX8 "h\n", asc, ascq, ascq);
         }
-        break;
-    case 0x7F:
-        switch (ascq)
+    }
+    else if (asc == 0x70)
+    {
+        if (VERBOSITY_COMMAND_NAMES <= device->deviceVerbosity)
         {
-        default:
-            if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
-            {
-                if (ascq >= 0x80 && ascq <= 0xFF)
-                {
-                    print_acs_ascq("Vendor specific ascq code", asc, ascq);
-                }
-                else
-                {
-                    print_acs_ascq("Unknown ascq code", asc, ascq);
-                }
-            }
-            ret = UNKNOWN;
-            break;
+            printf("asc & ascq: %" PRIX8 "h - %" PRIX8 "h = Decompression Exception Short Algorithm ID of %" PRIX8 "h\n", asc, ascq, ascq);
         }
-        break;
-    default:
+    }
+    else
+    {
         if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
         {
-            if (asc >= 0x80 && asc <= 0xFF)
+            if (asc >= 0x80)
             {
                 print_acs_ascq("Vendor specific ASC & ascq code", asc, ascq);
             }
+            else if (ascq >= 0x80)
+            {
+                print_acs_ascq("Vendor specific ascq code", asc, ascq);
+            }
             else
             {
-                print_acs_ascq("Unknown ASC & ASCQ code", asc, ascq);
+                print_acs_ascq("Unknown ascq code", asc, ascq);
             }
         }
         ret = UNKNOWN;
-        break;
     }
     if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
     {
@@ -8612,26 +1996,18 @@ uint16_t get_Returned_Sense_Data_Length(uint8_t *pbuf)
 // \brief copy in the necessary data to our struct from INQ data.
 void copy_Inquiry_Data( uint8_t *pbuf, driveInfo *info )
 {
-    // \todo: Create a macro to get various stuff out of the inq buffer
-    memcpy(info->T10_vendor_ident, &pbuf[8], INQ_DATA_T10_VENDOR_ID_LEN);
-    info->T10_vendor_ident[INQ_DATA_T10_VENDOR_ID_LEN] = '\0';
-    memcpy(info->product_identification, &pbuf[16], INQ_DATA_PRODUCT_ID_LEN);
-    info->product_identification[INQ_DATA_PRODUCT_ID_LEN] = '\0';
-    memcpy(info->product_revision, &pbuf[32], INQ_DATA_PRODUCT_REV_LEN);
-    info->product_revision[INQ_DATA_PRODUCT_REV_LEN] = '\0';
-    remove_Leading_And_Trailing_Whitespace(info->product_identification);
-    remove_Leading_And_Trailing_Whitespace(info->product_revision);
-    remove_Leading_And_Trailing_Whitespace(info->T10_vendor_ident);
+    //Products older than SCSI 2 response format may have non-printable characters in these fields, so scrub them.
+    eDeviceStringOptions options = M_GETBITRANGE(pbuf[3], 3, 0) < 2 ? DEVICE_STRING_SCRUB_NON_PRINTABLE : DEVICE_STRING_NO_OPTIONS;
+    copy_Device_String(info->T10_vendor_ident, T10_VENDOR_ID_LEN + 1, &pbuf[8], INQ_DATA_T10_VENDOR_ID_LEN, options);
+    copy_Device_String(info->product_identification, MODEL_NUM_LEN + 1, &pbuf[16], INQ_DATA_PRODUCT_ID_LEN, options);
+    copy_Device_String(info->product_revision, FW_REV_LEN + 1, &pbuf[32], INQ_DATA_PRODUCT_REV_LEN, options);
 }
 
 // \brief copy the serial number off of 0x80 VPD page data.
 void copy_Serial_Number( uint8_t *pbuf, char *serialNumber )
 {
     uint16_t snLen = ((uint16_t)pbuf[2] << 8) | pbuf[3];
-    memcpy(serialNumber, &pbuf[4], M_Min(snLen,SERIAL_NUM_LEN));
-    serialNumber[M_Min(snLen,SERIAL_NUM_LEN)]='\0';
-    remove_Leading_Whitespace(serialNumber);
-    remove_Trailing_Whitespace(serialNumber);
+    copy_Device_String(serialNumber, SERIAL_NUM_LEN + 1, &pbuf[4], M_Min(snLen, SERIAL_NUM_LEN), DEVICE_STRING_NO_OPTIONS);
 }
 
 void copy_Read_Capacity_Info(uint32_t *logicalBlockSize, uint32_t *physicalBlockSize, uint64_t *maxLBA, uint16_t *sectorAlignment, uint8_t *ptrBuf, bool readCap16)
@@ -8977,35 +2353,6 @@ int fill_In_Device_Info(tDevice *device)
             set_Passthrough_Hacks_By_Inquiry_Data(device);
         }
 
-        uint8_t responseFormat = M_GETBITRANGE(inq_buf[3], 3, 0);
-        if (responseFormat < 2)
-        {
-            //Need to check if vendor ID, MN, and FWRev are printable or not
-            //vendor ID
-            for (uint8_t iter = 0; iter < T10_VENDOR_ID_LEN; ++iter)
-            {
-                if (!is_ASCII(device->drive_info.T10_vendor_ident[iter]) || !isprint(device->drive_info.T10_vendor_ident[iter]))
-                {
-                    device->drive_info.T10_vendor_ident[iter] = ' ';
-                }
-            }
-            //product ID
-            for (uint8_t iter = 0; iter < MODEL_NUM_LEN && iter < INQ_DATA_PRODUCT_ID_LEN; ++iter)
-            {
-                if (!is_ASCII(device->drive_info.product_identification[iter]) ||!isprint(device->drive_info.product_identification[iter]))
-                {
-                    device->drive_info.product_identification[iter] = ' ';
-                }
-            }
-            //FWRev
-            for (uint8_t iter = 0; iter < FW_REV_LEN && iter < INQ_DATA_PRODUCT_REV_LEN; ++iter)
-            {
-                if (!is_ASCII(device->drive_info.product_revision[iter]) ||!isprint(device->drive_info.product_revision[iter]))
-                {
-                    device->drive_info.product_revision[iter] = ' ';
-                }
-            }
-        }
         uint8_t version = inq_buf[2];
         switch (version) //convert some versions since old standards broke the version number into ANSI vs ECMA vs ISO standard numbers
         {
@@ -9332,16 +2679,7 @@ int fill_In_Device_Info(tDevice *device)
                         uint16_t serialNumberLength = M_BytesTo2ByteValue(unitSerialNumber[2], unitSerialNumber[3]);
                         if (serialNumberLength > 0)
                         {
-                            memcpy(&device->drive_info.serialNumber[0], &unitSerialNumber[4], M_Min(SERIAL_NUM_LEN, serialNumberLength));
-                            device->drive_info.serialNumber[M_Min(SERIAL_NUM_LEN, serialNumberLength)] = '\0';
-                            remove_Leading_And_Trailing_Whitespace(device->drive_info.serialNumber);
-                            for (uint8_t iter = 0; iter < SERIAL_NUM_LEN; ++iter)
-                            {
-                                if (!isprint(device->drive_info.serialNumber[iter]))
-                                {
-                                    device->drive_info.serialNumber[iter] = ' ';
-                                }
-                            }
+                            copy_Device_String(device->drive_info.serialNumber, SERIAL_NUM_LEN + 1, &unitSerialNumber[4], M_Min(SERIAL_NUM_LEN, serialNumberLength), DEVICE_STRING_SCRUB_NON_PRINTABLE);
                         }
                         else
                         {
@@ -9358,16 +2696,8 @@ int fill_In_Device_Info(tDevice *device)
             else
             {
                 //SN may not be available...just going to read where it may otherwise show up in inquiry data like some vendors like to put it
-                memcpy(&device->drive_info.serialNumber[0], &inq_buf[36], SERIAL_NUM_LEN);
-                device->drive_info.serialNumber[SERIAL_NUM_LEN] = '\0';
                 //make sure the SN is printable if it's coming from here since it's non-standardized
-                for (uint8_t iter = 0; iter < SERIAL_NUM_LEN; ++iter)
-                {
-                    if (!is_ASCII(device->drive_info.serialNumber[iter]) || !isprint(device->drive_info.serialNumber[iter]))
-                    {
-                        device->drive_info.serialNumber[iter] = ' ';
-                    }
-                }
+                copy_Device_String(device->drive_info.serialNumber, SERIAL_NUM_LEN + 1, &inq_buf[36], SERIAL_NUM_LEN, DEVICE_STRING_SCRUB_NON_PRINTABLE);
             }
             if (version >= 3)//device identification added in SPC
             {
@@ -9510,16 +2840,7 @@ int fill_In_Device_Info(tDevice *device)
                             uint16_t serialNumberLength = M_BytesTo2ByteValue(unitSerialNumber[2], unitSerialNumber[3]);
                             if (serialNumberLength > 0)
                             {
-                                memcpy(&device->drive_info.serialNumber[0], &unitSerialNumber[4], M_Min(SERIAL_NUM_LEN, serialNumberLength));
-                                device->drive_info.serialNumber[M_Min(SERIAL_NUM_LEN, serialNumberLength)] = '\0';
-                                remove_Leading_And_Trailing_Whitespace(device->drive_info.serialNumber);
-                                for (uint8_t iter = 0; iter < SERIAL_NUM_LEN && iter < strlen(device->drive_info.serialNumber); ++iter)
-                                {
-                                    if (!isprint(device->drive_info.serialNumber[iter]))
-                                    {
-                                        device->drive_info.serialNumber[iter] = ' ';
-                                    }
-                                }
+                                copy_Device_String(device->drive_info.serialNumber, SERIAL_NUM_LEN + 1, &unitSerialNumber[4], M_Min(SERIAL_NUM_LEN, serialNumberLength), DEVICE_STRING_SCRUB_NON_PRINTABLE);
                             }
                         }
                     }
@@ -9653,16 +2974,8 @@ int fill_In_Device_Info(tDevice *device)
         else
         {
             //SN may not be available...just going to read where it may otherwise show up in inquiry data like some vendors like to put it
-            memcpy(&device->drive_info.serialNumber[0], &inq_buf[36], SERIAL_NUM_LEN);
-            device->drive_info.serialNumber[SERIAL_NUM_LEN] = '\0';
             //make sure the SN is printable if it's coming from here since it's non-standardized
-            for (uint8_t iter = 0; iter < SERIAL_NUM_LEN; ++iter)
-            {
-                if (!is_ASCII(device->drive_info.serialNumber[iter]) || !isprint(device->drive_info.serialNumber[iter]))
-                {
-                    device->drive_info.serialNumber[iter] = ' ';
-                }
-            }
+            copy_Device_String(device->drive_info.serialNumber, SERIAL_NUM_LEN + 1, &inq_buf[36], SERIAL_NUM_LEN, DEVICE_STRING_SCRUB_NON_PRINTABLE);
         }
 
         if (readCapacity)
@@ -21,7 +21,13 @@
 #include <sys/ioctl.h>
 #include <errno.h>
 #include <libgen.h>//for basename and dirname
+#include <poll.h>
+#include <limits.h>
 #include "sg_helper.h"
+#include <pthread.h>
+#if defined (SEA_IO_URING_NVME)
+#include <sys/syscall.h>
+#endif
 #include "cmds.h"
 #include "scsi_helper_func.h"
 #include "ata_helper_func.h"
@@ -809,6 +815,205 @@ long get_Device_Page_Size(void)
 #endif
 }
 
+#if defined (SEA_IO_URING_NVME)
+//io_uring engine for NVMe passthrough. Commands are sent with IORING_OP_URING_CMD to the NVMe generic char device (/dev/ngXnY).
+//Submissions are only placed in the ring until completions are reaped, so one io_uring_enter call submits a whole batch of commands.
+//This uses the system calls directly instead of liburing so that there is no new library dependency.
+//https://kernel.dk/io_uring.pdf
+typedef struct _linuxIOUring
+{
+    int ringFd;
+    int ngFd;//NVMe generic char handle. Ex: /dev/ng0n1
+    uint32_t sqEntries;
+    uint32_t pendingSubmissions;//SQEs placed in the ring that have not been submitted with io_uring_enter yet.
+    void *sqRing;
+    size_t sqRingSize;
+    void *cqRing;
+    size_t cqRingSize;
+    uint8_t *sqes;//128 byte SQEs (IORING_SETUP_SQE128)
+    size_t sqesSize;
+    uint32_t *sqHead;
+    uint32_t *sqTail;
+    uint32_t *sqRingMask;
+    uint32_t *sqArray;
+    uint32_t *cqHead;
+    uint32_t *cqTail;
+    uint32_t *cqRingMask;
+    uint8_t *cqes;//32 byte CQEs (IORING_SETUP_CQE32)
+}linuxIOUring;
+
+#define IO_URING_SQE128_SIZE (sizeof(struct io_uring_sqe) * 2)
+#define IO_URING_CQE32_SIZE (sizeof(struct io_uring_cqe) * 2)
+#define IO_URING_ENGINE_ENTRIES (64)
+
+static int io_uring_setup_syscall(uint32_t entries, struct io_uring_params *params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int io_uring_enter_syscall(int ringFd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+    return (int)syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static void close_IO_Uring_Engine(tDevice *device)
+{
+    linuxIOUring *ring = device->os_info.ioUring;
+    if (!ring)
+    {
+        return;
+    }
+    if (ring->sqes && ring->sqes != MAP_FAILED)
+    {
+        munmap(ring->sqes, ring->sqesSize);
+    }
+    if (ring->cqRing && ring->cqRing != MAP_FAILED && ring->cqRing != ring->sqRing)
+    {
+        munmap(ring->cqRing, ring->cqRingSize);
+    }
+    if (ring->sqRing && ring->sqRing != MAP_FAILED)
+    {
+        munmap(ring->sqRing, ring->sqRingSize);
+    }
+    if (ring->ringFd >= 0)
+    {
+        close(ring->ringFd);
+    }
+    if (ring->ngFd >= 0)
+    {
+        close(ring->ngFd);
+    }
+    safe_Free(ring);
+    device->os_info.ioUring = NULL;
+}
+
+//Sets up the io_uring engine for an NVMe namespace handle. If anything is not supported (old kernel, io_uring disabled, no generic char device)
+//this returns NOT_SUPPORTED and all commands keep using the ioctls.
+static int setup_IO_Uring_Engine(tDevice *device)
+{
+    struct io_uring_params params;
+    linuxIOUring *ring = NULL;
+    char ngHandle[30] = { 0 };
+    uint32_t controller = 0, namespaceNumber = 0;
+    if (2 != sscanf(device->os_info.name, "/dev/nvme%" SCNu32 "n%" SCNu32, &controller, &namespaceNumber))
+    {
+        //controller handle. There is no generic namespace handle to send IO through.
+        return NOT_SUPPORTED;
+    }
+    snprintf(ngHandle, 30, NVME_GENERIC_DRIVE "%" PRIu32 "n%" PRIu32, controller, namespaceNumber);
+    ring = (linuxIOUring*)calloc(1, sizeof(linuxIOUring));
+    if (!ring)
+    {
+        return MEMORY_FAILURE;
+    }
+    ring->ringFd = -1;
+    device->os_info.ioUring = ring;
+    ring->ngFd = open(ngHandle, O_RDWR | O_NONBLOCK);
+    if (ring->ngFd < 0)
+    {
+        device->os_info.last_error = errno;
+        close_IO_Uring_Engine(device);
+        return NOT_SUPPORTED;
+    }
+    memset(&params, 0, sizeof(struct io_uring_params));
+    params.flags = IORING_SETUP_SQE128 | IORING_SETUP_CQE32;
+    ring->ringFd = io_uring_setup_syscall(IO_URING_ENGINE_ENTRIES, &params);
+    if (ring->ringFd < 0)
+    {
+        device->os_info.last_error = errno;
+        close_IO_Uring_Engine(device);
+        return NOT_SUPPORTED;
+    }
+    ring->sqEntries = params.sq_entries;
+    ring->sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    ring->cqRingSize = params.cq_off.cqes + params.cq_entries * IO_URING_CQE32_SIZE;
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->sqRingSize = M_Max(ring->sqRingSize, ring->cqRingSize);
+        ring->cqRingSize = ring->sqRingSize;
+    }
+    ring->sqRing = mmap(NULL, ring->sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQ_RING);
+    if (ring->sqRing == MAP_FAILED)
+    {
+        device->os_info.last_error = errno;
+        close_IO_Uring_Engine(device);
+        return NOT_SUPPORTED;
+    }
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        ring->cqRing = ring->sqRing;
+    }
+    else
+    {
+        ring->cqRing = mmap(NULL, ring->cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_CQ_RING);
+        if (ring->cqRing == MAP_FAILED)
+        {
+            device->os_info.last_error = errno;
+            close_IO_Uring_Engine(device);
+            return NOT_SUPPORTED;
+        }
+    }
+    ring->sqesSize = params.sq_entries * IO_URING_SQE128_SIZE;
+    ring->sqes = (uint8_t*)mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ringFd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED)
+    {
+        device->os_info.last_error = errno;
+        close_IO_Uring_Engine(device);
+        return NOT_SUPPORTED;
+    }
+    ring->sqHead = (uint32_t*)((uint8_t*)ring->sqRing + params.sq_off.head);
+    ring->sqTail = (uint32_t*)((uint8_t*)ring->sqRing + params.sq_off.tail);
+    ring->sqRingMask = (uint32_t*)((uint8_t*)ring->sqRing + params.sq_off.ring_mask);
+    ring->sqArray = (uint32_t*)((uint8_t*)ring->sqRing + params.sq_off.array);
+    ring->cqHead = (uint32_t*)((uint8_t*)ring->cqRing + params.cq_off.head);
+    ring->cqTail = (uint32_t*)((uint8_t*)ring->cqRing + params.cq_off.tail);
+    ring->cqRingMask = (uint32_t*)((uint8_t*)ring->cqRing + params.cq_off.ring_mask);
+    ring->cqes = (uint8_t*)ring->cqRing + params.cq_off.cqes;
+    return SUCCESS;
+}
+
+//Returns the next free SQE, cleared, or NULL when the submission ring is full.
+//The SQE is not visible to the kernel until commit_IO_Uring_SQE is called after it has been filled in.
+static struct io_uring_sqe* get_IO_Uring_SQE(linuxIOUring *ring)
+{
+    uint32_t tail = *ring->sqTail;
+    uint32_t head = __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    struct io_uring_sqe *sqe = NULL;
+    if ((tail - head) >= ring->sqEntries)
+    {
+        return NULL;
+    }
+    sqe = (struct io_uring_sqe*)(ring->sqes + (tail & *ring->sqRingMask) * IO_URING_SQE128_SIZE);
+    memset(sqe, 0, IO_URING_SQE128_SIZE);
+    return sqe;
+}
+
+//Publishes the SQE from get_IO_Uring_SQE by moving the tail past it.
+static void commit_IO_Uring_SQE(linuxIOUring *ring)
+{
+    uint32_t tail = *ring->sqTail;
+    ring->sqArray[tail & *ring->sqRingMask] = tail & *ring->sqRingMask;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+    ring->pendingSubmissions++;
+}
+
+//Removes one completion from the ring if one is available. The CQE is copied out since the slot is reused by the kernel once the head moves.
+static bool get_IO_Uring_CQE(linuxIOUring *ring, uint64_t *userData, int32_t *res)
+{
+    uint32_t head = *ring->cqHead;
+    struct io_uring_cqe *cqe = NULL;
+    if (head == __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+    cqe = (struct io_uring_cqe*)(ring->cqes + (head & *ring->cqRingMask) * IO_URING_CQE32_SIZE);
+    *userData = cqe->user_data;
+    *res = cqe->res;
+    __atomic_store_n(ring->cqHead, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+#endif //SEA_IO_URING_NVME
+
 #define LIN_MAX_HANDLE_LENGTH 16
 int get_Device(const char *filename, tDevice *device)
 {
@@ -916,7 +1121,16 @@ int get_Device(const char *filename, tDevice *device)
             sprintf(device->os_info.name, "/dev/%s", baseLink);
             sprintf(device->os_info.friendlyName, "%s", baseLink);
 
-            ret = fill_Drive_Info_Data(device);
+            ret = fill_Drive_Info_Data_With_Cache(device);
+            #if defined (SEA_IO_URING_NVME)
+            if (ret == SUCCESS && (device->dFlags & IO_URING_ENGINE))
+            {
+                if (SUCCESS != setup_IO_Uring_Engine(device) && VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+                {
+                    printf("io_uring engine not available for %s. Using ioctls instead.\n", device->os_info.name);
+                }
+            }
+            #endif
             #if defined (_DEBUG)
             printf("\nsg helper-nvmedev\n");
             printf("Drive type: %d\n",device->drive_info.drive_type);
@@ -1004,7 +1218,7 @@ int get_Device(const char *filename, tDevice *device)
 //                  set_ATA_Passthrough_Type_By_PID_and_VID(device);
 //              }
 
-                ret = fill_Drive_Info_Data(device);
+                ret = fill_Drive_Info_Data_With_Cache(device);
 
                 #if defined (_DEBUG)
                 printf("\nsg helper\n");
@@ -1122,7 +1336,7 @@ int send_IO( ScsiIoCtx *scsiIoCtx )
 int send_sg_io( ScsiIoCtx *scsiIoCtx )
 {
     sg_io_hdr_t io_hdr;
-    uint8_t     *localSenseBuffer = NULL;
+    uint8_t     localSenseBuffer[SPC3_SENSE_LEN];//used when the caller does not provide sense data. The driver copies sense data out, so this does not need any special alignment.
     int         ret          = SUCCESS;
     seatimer_t  commandTimer;
 #ifdef _DEBUG
@@ -1151,11 +1365,7 @@ int send_sg_io( ScsiIoCtx *scsiIoCtx )
     }
     else
     {
-        localSenseBuffer = (uint8_t *)calloc_aligned(SPC3_SENSE_LEN, sizeof(uint8_t), scsiIoCtx->device->os_info.minimumAlignment);
-        if (!localSenseBuffer)
-        {
-            return MEMORY_FAILURE;
-        }
+        memset(localSenseBuffer, 0, SPC3_SENSE_LEN);
         io_hdr.mx_sb_len = SPC3_SENSE_LEN;
         io_hdr.sbp = localSenseBuffer;
     }
@@ -1185,12 +1395,17 @@ int send_sg_io( ScsiIoCtx *scsiIoCtx )
         {
             printf("%s Didn't understand direction\n", __FUNCTION__);
         }
-        safe_Free_aligned(localSenseBuffer);
         return BAD_PARAMETER;
     }
 
     io_hdr.dxfer_len = scsiIoCtx->dataLength;
     io_hdr.dxferp = scsiIoCtx->pdata;
+    if (scsiIoCtx->dataLength > 0 && is_Device_Pool_Buffer(scsiIoCtx->device, scsiIoCtx->pdata, scsiIoCtx->dataLength))
+    {
+        //Pool buffers are page aligned, so ask sg to transfer straight into them instead of copying through its own buffer.
+        //sg quietly falls back to indirect IO when direct IO is not allowed (allow_dio module parameter)
+        io_hdr.flags |= SG_FLAG_DIRECT_IO;
+    }
     io_hdr.cmdp = scsiIoCtx->cdb;
     if (scsiIoCtx->device->drive_info.defaultTimeoutSeconds > 0 && scsiIoCtx->device->drive_info.defaultTimeoutSeconds > scsiIoCtx->timeout)
     {
@@ -1468,7 +1683,6 @@ int send_sg_io( ScsiIoCtx *scsiIoCtx )
 #ifdef _DEBUG
     printf("<--%s (%d)\n",__FUNCTION__, ret);
 #endif
-    safe_Free_aligned(localSenseBuffer);
     return ret;
 }
 
@@ -1553,6 +1767,52 @@ int get_Device_Count(uint32_t * numberOfDevices, uint64_t flags)
     return SUCCESS;
 }
 
+//Shared state for get_Device_List when discovering devices on multiple threads.
+//Each thread takes the next handle from the list, so slow devices do not hold up the others. Output slots are assigned before any thread starts.
+typedef struct _discoveryWorker
+{
+    pthread_mutex_t lock;
+    bool locked;//false when only one thread is running, so the lock is not needed
+    uint32_t nextIndex;
+    uint32_t count;
+    char **handles;//handle for each output slot
+    tDevice *devices;
+    int *results;//get_Device result for each output slot
+}discoveryWorker;
+
+static void* discovery_Worker_Thread(void *data)
+{
+    discoveryWorker *worker = (discoveryWorker*)data;
+    while (true)
+    {
+        uint32_t index = 0;
+        if (worker->locked)
+        {
+            pthread_mutex_lock(&worker->lock);
+        }
+        index = worker->nextIndex++;
+        if (worker->locked)
+        {
+            pthread_mutex_unlock(&worker->lock);
+        }
+        if (index >= worker->count)
+        {
+            break;
+        }
+#if defined (DEGUG_SCAN_TIME)
+        seatimer_t getDeviceTimer;
+        memset(&getDeviceTimer, 0, sizeof(seatimer_t));
+        start_Timer(&getDeviceTimer);
+#endif
+        worker->results[index] = get_Device(worker->handles[index], &worker->devices[index]);
+#if defined (DEGUG_SCAN_TIME)
+        stop_Timer(&getDeviceTimer);
+        printf("Time to get %s = %fms\n", worker->handles[index], get_Milli_Seconds(getDeviceTimer));
+#endif
+    }
+    return NULL;
+}
+
 //-----------------------------------------------------------------------------
 //
 //  get_Device_List()
@@ -1586,9 +1846,7 @@ int get_Device_List(tDevice * const ptrToDeviceList, uint32_t sizeInBytes, versi
     int fd;
     tDevice * d = NULL;
 #if defined (DEGUG_SCAN_TIME)
-    seatimer_t getDeviceTimer;
     seatimer_t getDeviceListTimer;
-    memset(&getDeviceTimer, 0, sizeof(seatimer_t));
     memset(&getDeviceListTimer, 0, sizeof(seatimer_t));
 #endif
     
@@ -1649,11 +1907,29 @@ int get_Device_List(tDevice * const ptrToDeviceList, uint32_t sizeInBytes, versi
     }
     else
     {
+        uint32_t discoveryThreads = GET_DISCOVERY_THREAD_COUNT(flags);
+        discoveryWorker worker;
+        memset(&worker, 0, sizeof(discoveryWorker));
         numberOfDevices = sizeInBytes / sizeof(tDevice);
         d = ptrToDeviceList;
 #if defined (DEGUG_SCAN_TIME)
         start_Timer(&getDeviceListTimer);
 #endif
+        worker.handles = (char **)calloc(M_Min((uint32_t)numberOfDevices, MAX_DEVICES_TO_SCAN), sizeof(char *));
+        worker.results = (int *)calloc(M_Min((uint32_t)numberOfDevices, MAX_DEVICES_TO_SCAN), sizeof(int));
+        if (!worker.handles || !worker.results)
+        {
+            safe_Free(worker.handles);
+            safe_Free(worker.results);
+            for (driveNumber = 0; driveNumber < MAX_DEVICES_TO_SCAN && devs[driveNumber]; ++driveNumber)
+            {
+                safe_Free(devs[driveNumber]);
+            }
+            safe_Free(devs);
+            return MEMORY_FAILURE;
+        }
+        worker.devices = ptrToDeviceList;
+        //Pick the output slot for each handle that can be opened first so that the list is in the same order no matter how many threads are used.
         for (driveNumber = 0; ((driveNumber < MAX_DEVICES_PER_CONTROLLER && driveNumber < (num_sg_devs + num_sd_devs + num_nvme_devs)) && (found < numberOfDevices)); ++driveNumber)
         {
             if(!devs[driveNumber] || strlen(devs[driveNumber]) == 0)
@@ -1673,21 +1949,10 @@ int get_Device_List(tDevice * const ptrToDeviceList, uint32_t sizeInBytes, versi
                 d->deviceVerbosity = temp;
                 d->sanity.size = ver.size;
                 d->sanity.version = ver.version;
-#if defined (DEGUG_SCAN_TIME)
-                seatimer_t getDeviceTimer;
-                memset(&getDeviceTimer, 0, sizeof(seatimer_t));
-                start_Timer(&getDeviceTimer);
-#endif
                 d->dFlags = flags;
-                int ret = get_Device(name, d);
-#if defined (DEGUG_SCAN_TIME)
-                stop_Timer(&getDeviceTimer);
-                printf("Time to get %s = %fms\n", name, get_Milli_Seconds(getDeviceTimer));
-#endif
-                if (ret != SUCCESS)
-                {
-                    failedGetDeviceCount++;
-                }
+                //the worker owns the handle name now
+                worker.handles[found] = devs[driveNumber];
+                devs[driveNumber] = NULL;
                 found++;
                 d++;
             }
@@ -1703,6 +1968,45 @@ int get_Device_List(tDevice * const ptrToDeviceList, uint32_t sizeInBytes, versi
             //free the dev[deviceNumber] since we are done with it now.
             safe_Free(devs[driveNumber]);
         }
+        worker.count = (uint32_t)found;
+        discoveryThreads = M_Min(discoveryThreads, worker.count);
+        if (discoveryThreads > 1)
+        {
+            pthread_t *threads = (pthread_t *)calloc(discoveryThreads, sizeof(pthread_t));
+            uint32_t threadsStarted = 0;
+            pthread_mutex_init(&worker.lock, NULL);
+            worker.locked = true;
+            //This thread takes a share of the work too, so start one less than requested.
+            for (; threads && threadsStarted < (discoveryThreads - 1); ++threadsStarted)
+            {
+                if (0 != pthread_create(&threads[threadsStarted], NULL, discovery_Worker_Thread, &worker))
+                {
+                    //Could not make another thread. Run with the ones that did start.
+                    break;
+                }
+            }
+            discovery_Worker_Thread(&worker);
+            for (uint32_t threadIter = 0; threadIter < threadsStarted; ++threadIter)
+            {
+                pthread_join(threads[threadIter], NULL);
+            }
+            safe_Free(threads);
+            pthread_mutex_destroy(&worker.lock);
+        }
+        else
+        {
+            discovery_Worker_Thread(&worker);
+        }
+        for (uint32_t devIter = 0; devIter < worker.count; ++devIter)
+        {
+            if (worker.results[devIter] != SUCCESS)
+            {
+                failedGetDeviceCount++;
+            }
+            safe_Free(worker.handles[devIter]);
+        }
+        safe_Free(worker.handles);
+        safe_Free(worker.results);
 #if defined (DEGUG_SCAN_TIME)
         stop_Timer(&getDeviceListTimer);
         printf("Time to get all device = %fms\n", get_Milli_Seconds(getDeviceListTimer));
@@ -1738,6 +2042,20 @@ int close_Device(tDevice *dev)
     int retValue = 0;
     if (dev)
     {
+        stop_Async_IO(dev);
+        free_Zone_Map(dev);
+        stop_Device_Buffer_Pool(dev);
+        stop_Device_Log_Cache(dev);
+        free_Memoized_Supported_Op_Codes(dev);
+        #if defined (SEA_IO_URING_NVME)
+        close_IO_Uring_Engine(dev);
+        #endif
+        if (dev->os_info.secondHandleOpened)
+        {
+            close(dev->os_info.fd2);
+            dev->os_info.fd2 = -1;
+            dev->os_info.secondHandleOpened = false;
+        }
         retValue = close(dev->os_info.fd);
         dev->os_info.last_error = errno;
         if ( retValue == 0)
@@ -2081,22 +2399,544 @@ int pci_Read_Bar_Reg( tDevice * device, uint8_t * pData, uint32_t dataSize )
     return ret;
 }
 #endif
+//OS read/write/verify/flush go through the kernel block layer on the block device for this drive (sd or nvme namespace) with O_DIRECT so the page cache is bypassed.
+//The block handle is kept in fd2 and opened the first time it is needed. If that fails, blockDeviceUnavailable is set and the block layer is not tried again.
+static const char* get_Block_Device_Name(tDevice *device)
+{
+    struct stat handleStat;
+    if (device->os_info.secondHandleValid && stat(device->os_info.secondName, &handleStat) == 0 && S_ISBLK(handleStat.st_mode))
+    {
+        return device->os_info.secondName;
+    }
+    if (stat(device->os_info.name, &handleStat) == 0 && S_ISBLK(handleStat.st_mode))
+    {
+        return device->os_info.name;
+    }
+    return NULL;
+}
+
+static int open_Block_Device_Handle(tDevice *device)
+{
+    const char *blockName = NULL;
+    if (device->os_info.secondHandleOpened)
+    {
+        return SUCCESS;
+    }
+    if (device->os_info.blockDeviceUnavailable)
+    {
+        return NOT_SUPPORTED;
+    }
+    blockName = get_Block_Device_Name(device);
+    if (!blockName)
+    {
+        device->os_info.blockDeviceUnavailable = true;
+        return NOT_SUPPORTED;
+    }
+    device->os_info.fd2 = open(blockName, O_RDWR | O_DIRECT);
+    if (device->os_info.fd2 < 0)
+    {
+        device->os_info.last_error = errno;
+        if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+        {
+            printf("Unable to open block device %s for direct IO. errno = %d\n", blockName, errno);
+        }
+        //a failed open (permissions, O_DIRECT not supported, etc) will not start working on the next command, so do not try again for this handle
+        device->os_info.blockDeviceUnavailable = true;
+        return NOT_SUPPORTED;
+    }
+    device->os_info.secondHandleOpened = true;
+    return SUCCESS;
+}
+
+//The block layer does not return sense data or RTFRs, so set up something that looks like the result of the command like the Windows API functions do.
+static void set_Block_Device_IO_Result(tDevice *device, bool success)
+{
+    memset(&device->drive_info.lastCommandRTFRs, 0, sizeof(ataReturnTFRs));
+    memset(device->drive_info.lastCommandSenseData, 0, SPC3_SENSE_LEN);
+    if (success)
+    {
+        if (device->drive_info.drive_type == ATA_DRIVE)
+        {
+            device->drive_info.lastCommandRTFRs.status = ATA_STATUS_BIT_READY | ATA_STATUS_BIT_SEEK_COMPLETE;
+        }
+    }
+    else
+    {
+        if (device->drive_info.drive_type == ATA_DRIVE)
+        {
+            device->drive_info.lastCommandRTFRs.status = ATA_STATUS_BIT_READY | ATA_STATUS_BIT_ERROR;
+        }
+        device->drive_info.lastCommandSenseData[0] = SCSI_SENSE_CUR_INFO_FIXED;
+        device->drive_info.lastCommandSenseData[2] |= device->os_info.last_error == EIO ? SENSE_KEY_MEDIUM_ERROR : SENSE_KEY_ABORTED_COMMAND;
+    }
+}
+
+//pread/pwrite the whole range, continuing after short transfers and interrupted calls
+static int block_Device_Transfer(tDevice *device, bool write, uint64_t offset, uint8_t *ptrData, uint32_t dataSize)
+{
+    uint32_t transferred = 0;
+    while (transferred < dataSize)
+    {
+        ssize_t result = 0;
+        if (write)
+        {
+            result = pwrite(device->os_info.fd2, ptrData + transferred, dataSize - transferred, (off_t)(offset + transferred));
+        }
+        else
+        {
+            result = pread(device->os_info.fd2, ptrData + transferred, dataSize - transferred, (off_t)(offset + transferred));
+        }
+        if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (result <= 0)
+        {
+            device->os_info.last_error = result < 0 ? errno : EIO;
+            return FAILURE;
+        }
+        transferred += (uint32_t)result;
+    }
+    device->os_info.last_error = 0;
+    return SUCCESS;
+}
+
+static int os_Block_Device_IO(tDevice *device, bool write, uint64_t lba, bool async, uint8_t *ptrData, uint32_t dataSize)
+{
+    int ret = SUCCESS;
+    uint8_t *alignedBuffer = NULL;
+    uint8_t *ioBuffer = ptrData;
+    uint32_t alignment = device->drive_info.deviceBlockSize > 0 ? device->drive_info.deviceBlockSize : LEGACY_DRIVE_SEC_SIZE;
+    seatimer_t commandTimer;
+    memset(&commandTimer, 0, sizeof(seatimer_t));
+    if (async)
+    {
+        //asynchronous IO is done with submit_Async_IO
+        return NOT_SUPPORTED;
+    }
+    if (!ptrData || dataSize % alignment != 0)
+    {
+        return BAD_PARAMETER;
+    }
+    if (SUCCESS != (ret = open_Block_Device_Handle(device)))
+    {
+        return ret;
+    }
+    if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+    {
+        printf("Using Linux block device to %s LBAs\n", write ? "Write" : "Read");
+    }
+    //O_DIRECT needs the buffer aligned to the logical block size. Bounce through a pool buffer when the caller's is not.
+    if ((uintptr_t)ptrData % alignment != 0)
+    {
+        alignedBuffer = lease_Device_Buffer(device, dataSize);
+        if (!alignedBuffer)
+        {
+            return MEMORY_FAILURE;
+        }
+        if (write)
+        {
+            memcpy(alignedBuffer, ptrData, dataSize);
+        }
+        ioBuffer = alignedBuffer;
+    }
+    start_Timer(&commandTimer);
+    ret = block_Device_Transfer(device, write, lba * device->drive_info.deviceBlockSize, ioBuffer, dataSize);
+    stop_Timer(&commandTimer);
+    device->drive_info.lastCommandTimeNanoSeconds = get_Nano_Seconds(commandTimer);
+    set_Block_Device_IO_Result(device, ret == SUCCESS);
+    if (ret == SUCCESS && !write && alignedBuffer)
+    {
+        memcpy(ptrData, alignedBuffer, dataSize);
+    }
+    safe_Return_Device_Buffer(device, alignedBuffer);
+    if (device->deviceVerbosity >= VERBOSITY_COMMAND_VERBOSE)
+    {
+        if (ret != SUCCESS)
+        {
+            printf("Linux block device error: %s\n", strerror((int)device->os_info.last_error));
+        }
+        print_Command_Time(device->drive_info.lastCommandTimeNanoSeconds);
+    }
+    if (VERBOSITY_BUFFERS <= device->deviceVerbosity && !write)
+    {
+        printf("\t  Data Buffer being returned:\n");
+        print_Data_Buffer(ptrData, dataSize, true);
+        printf("\n");
+    }
+    if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+    {
+        print_Return_Enum(write ? "Linux Block Device Write" : "Linux Block Device Read", ret);
+    }
+    return ret;
+}
+
 int os_Read(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint32_t dataSize)
 {
-    return NOT_SUPPORTED;
+    return os_Block_Device_IO(device, false, lba, async, ptrData, dataSize);
 }
 
 int os_Write(tDevice *device, uint64_t lba, bool async, uint8_t *ptrData, uint32_t dataSize)
 {
-    return NOT_SUPPORTED;
+    return os_Block_Device_IO(device, true, lba, async, ptrData, dataSize);
 }
 
+#define OS_VERIFY_CHUNK_SIZE (1024 * 1024)
+//There is no verify in the block layer, so this reads the range with O_DIRECT and throws the data away. Unlike a verify command, the data is transferred.
 int os_Verify(tDevice *device, uint64_t lba, uint32_t range)
 {
-    return NOT_SUPPORTED;
+    int ret = SUCCESS;
+    uint8_t *verifyBuffer = NULL;
+    uint64_t remainingBytes = (uint64_t)range * device->drive_info.deviceBlockSize;
+    uint64_t offset = lba * device->drive_info.deviceBlockSize;
+    uint64_t totalTime = 0;
+    seatimer_t verifyTimer;
+    if (device->drive_info.deviceBlockSize == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    if (SUCCESS != (ret = open_Block_Device_Handle(device)))
+    {
+        return ret;
+    }
+    if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+    {
+        printf("Using Linux block device to Verify LBAs\n");
+    }
+    verifyBuffer = lease_Device_Buffer(device, (uint32_t)M_Min(remainingBytes, OS_VERIFY_CHUNK_SIZE));
+    if (!verifyBuffer)
+    {
+        return MEMORY_FAILURE;
+    }
+    while (ret == SUCCESS && remainingBytes > 0)
+    {
+        uint32_t chunk = (uint32_t)M_Min(remainingBytes, OS_VERIFY_CHUNK_SIZE);
+        memset(&verifyTimer, 0, sizeof(seatimer_t));
+        start_Timer(&verifyTimer);
+        ret = block_Device_Transfer(device, false, offset, verifyBuffer, chunk);
+        stop_Timer(&verifyTimer);
+        totalTime += get_Nano_Seconds(verifyTimer);
+        offset += chunk;
+        remainingBytes -= chunk;
+    }
+    safe_Return_Device_Buffer(device, verifyBuffer);
+    device->drive_info.lastCommandTimeNanoSeconds = totalTime;
+    set_Block_Device_IO_Result(device, ret == SUCCESS);
+    if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+    {
+        print_Command_Time(device->drive_info.lastCommandTimeNanoSeconds);
+        print_Return_Enum("Linux Block Device Verify", ret);
+    }
+    return ret;
 }
 
+//fdatasync on a block device sends a cache flush to the drive
 int os_Flush(tDevice *device)
 {
-    return NOT_SUPPORTED;
+    int ret = SUCCESS;
+    seatimer_t flushTimer;
+    memset(&flushTimer, 0, sizeof(seatimer_t));
+    if (SUCCESS != (ret = open_Block_Device_Handle(device)))
+    {
+        return ret;
+    }
+    start_Timer(&flushTimer);
+    if (fdatasync(device->os_info.fd2) != 0)
+    {
+        device->os_info.last_error = errno;
+        ret = FAILURE;
+    }
+    stop_Timer(&flushTimer);
+    device->drive_info.lastCommandTimeNanoSeconds = get_Nano_Seconds(flushTimer);
+    set_Block_Device_IO_Result(device, ret == SUCCESS);
+    if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+    {
+        print_Command_Time(device->drive_info.lastCommandTimeNanoSeconds);
+        print_Return_Enum("Linux Block Device Flush", ret);
+    }
+    return ret;
+}
+
+//Asynchronous IO through the sg driver's write()/read() interface. Each command is written to the handle with a sg_io_hdr and read back once it finishes.
+//http://www.tldp.org/HOWTO/SCSI-Generic-HOWTO/async.html
+#if !defined (SG_MAX_QUEUE)
+#define SG_MAX_QUEUE 16
+#endif
+int os_Async_IO_Init(tDevice *device, asyncIOQueue *queue)
+{
+    sg_io_hdr_t *asyncHeaders = NULL;
+    switch (device->drive_info.interface_type)
+    {
+    case NVME_INTERFACE:
+        #if defined (SEA_IO_URING_NVME)
+        if (device->os_info.ioUring)
+        {
+            //The ring is owned by the device, so there is nothing to allocate here.
+            queue->osContext = device->os_info.ioUring;
+            queue->osQueueDepth = M_Min(queue->queueDepth, device->os_info.ioUring->sqEntries);
+            return SUCCESS;
+        }
+        #endif
+        return NOT_SUPPORTED;
+    case SCSI_INTERFACE:
+    case IDE_INTERFACE:
+    case USB_INTERFACE:
+    case IEEE_1394_INTERFACE:
+        break;
+    default:
+        return NOT_SUPPORTED;
+    }
+    if (!device->os_info.sgDriverVersion.driverVersionValid || !is_SCSI_Generic_Handle(device->os_info.name))
+    {
+        return NOT_SUPPORTED;
+    }
+    asyncHeaders = (sg_io_hdr_t*)calloc(queue->queueDepth, sizeof(sg_io_hdr_t));
+    if (!asyncHeaders)
+    {
+        return MEMORY_FAILURE;
+    }
+    queue->osContext = asyncHeaders;
+    //The sg driver accepts a limited number of outstanding commands per handle. Anything beyond that waits in the library's queue.
+    queue->osQueueDepth = M_Min(queue->queueDepth, SG_MAX_QUEUE);
+    return SUCCESS;
+}
+
+static uint32_t get_SG_Timeout_Milliseconds(tDevice *device)
+{
+    uint32_t timeoutSeconds = device->drive_info.defaultTimeoutSeconds > 0 ? device->drive_info.defaultTimeoutSeconds : 15;
+    if (timeoutSeconds < 4294966)
+    {
+        return timeoutSeconds * 1000;
+    }
+    return UINT32_MAX;
+}
+
+#if defined (SEA_IO_URING_NVME)
+static int submit_IO_Uring_NVMe_IO(tDevice *device, linuxIOUring *ring, asyncIOSlot *slot)
+{
+    struct io_uring_sqe *sqe = NULL;
+    struct nvme_uring_cmd nvmeCmd;
+    uint32_t numberOfLogicalBlocks = 0;
+    if (device->drive_info.deviceBlockSize == 0)
+    {
+        return BAD_PARAMETER;
+    }
+    numberOfLogicalBlocks = slot->dataSize / device->drive_info.deviceBlockSize;
+    if (numberOfLogicalBlocks == 0 || numberOfLogicalBlocks > (UINT16_MAX + 1))
+    {
+        return BAD_PARAMETER;
+    }
+    memset(&nvmeCmd, 0, sizeof(struct nvme_uring_cmd));
+    nvmeCmd.opcode = slot->write ? NVME_CMD_WRITE : NVME_CMD_READ;
+    nvmeCmd.nsid = device->drive_info.namespaceID;
+    nvmeCmd.addr = (uint64_t)(uintptr_t)slot->ptrData;
+    nvmeCmd.data_len = slot->dataSize;
+    nvmeCmd.cdw10 = M_DoubleWord0(slot->lba);
+    nvmeCmd.cdw11 = M_DoubleWord1(slot->lba);
+    nvmeCmd.cdw12 = numberOfLogicalBlocks - 1;//0's based value
+    nvmeCmd.timeout_ms = get_SG_Timeout_Milliseconds(device);
+    sqe = get_IO_Uring_SQE(ring);
+    if (!sqe)
+    {
+        return FAILURE;
+    }
+    sqe->opcode = IORING_OP_URING_CMD;
+    sqe->fd = ring->ngFd;
+    sqe->cmd_op = NVME_URING_CMD_IO;
+    sqe->user_data = (uint64_t)(uintptr_t)slot;
+    memcpy(sqe->cmd, &nvmeCmd, sizeof(struct nvme_uring_cmd));
+    commit_IO_Uring_SQE(ring);
+    return SUCCESS;
+}
+
+static int reap_IO_Uring_NVMe_IO(tDevice *device, linuxIOUring *ring, uint32_t timeoutMilliseconds, asyncIOSlot **completedSlot)
+{
+    uint64_t userData = 0;
+    int32_t res = 0;
+    bool haveCompletion = get_IO_Uring_CQE(ring, &userData, &res);
+    uint32_t enterFlags = 0, minComplete = 0;
+    asyncIOSlot *slot = NULL;
+    if (!haveCompletion && timeoutMilliseconds == ASYNC_IO_INFINITE_WAIT)
+    {
+        //submit everything batched up and wait in the same call
+        enterFlags = IORING_ENTER_GETEVENTS;
+        minComplete = 1;
+    }
+    if (ring->pendingSubmissions > 0 || minComplete > 0)
+    {
+        int submitted = io_uring_enter_syscall(ring->ringFd, ring->pendingSubmissions, minComplete, enterFlags);
+        if (submitted < 0)
+        {
+            device->os_info.last_error = errno;
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+            {
+                if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+                {
+                    printf("Error submitting io_uring commands: ");
+                    print_Errno_To_Screen(device->os_info.last_error);
+                }
+                return OS_PASSTHROUGH_FAILURE;
+            }
+        }
+        else
+        {
+            ring->pendingSubmissions -= M_Min((uint32_t)submitted, ring->pendingSubmissions);
+        }
+    }
+    if (!haveCompletion && !get_IO_Uring_CQE(ring, &userData, &res))
+    {
+        if (timeoutMilliseconds > 0 && timeoutMilliseconds != ASYNC_IO_INFINITE_WAIT)
+        {
+            struct pollfd pollHandle;
+            memset(&pollHandle, 0, sizeof(struct pollfd));
+            pollHandle.fd = ring->ringFd;
+            pollHandle.events = POLLIN;
+            if (poll(&pollHandle, 1, (int)M_Min(timeoutMilliseconds, INT_MAX)) > 0)
+            {
+                haveCompletion = get_IO_Uring_CQE(ring, &userData, &res);
+            }
+        }
+        if (!haveCompletion)
+        {
+            return IN_PROGRESS;
+        }
+    }
+    slot = (asyncIOSlot*)(uintptr_t)userData;
+    if (!slot || slot < device->asyncIO->slots || slot >= (device->asyncIO->slots + device->asyncIO->queueDepth))
+    {
+        return OS_PASSTHROUGH_FAILURE;
+    }
+    slot->commandTimeNanoSeconds = 0;//not reported by the kernel for uring commands
+    if (res < 0)
+    {
+        //errno from the kernel. The command may not have been sent to the drive.
+        device->os_info.last_error = -res;
+        slot->nvmeStatus = 0;
+        slot->result = OS_PASSTHROUGH_FAILURE;
+    }
+    else
+    {
+        //NVMe status field, same as the ioctl return value on the synchronous path
+        slot->nvmeStatus = (uint32_t)res << 17;//shift into place since we don't get the phase tag or command ID bits and these are the status field
+        slot->result = check_NVMe_Status(slot->nvmeStatus);
+    }
+    device->drive_info.lastNVMeResult.lastNVMeStatus = slot->nvmeStatus;
+    device->drive_info.lastNVMeResult.lastNVMeCommandSpecific = 0;
+    *completedSlot = slot;
+    return SUCCESS;
+}
+#endif //SEA_IO_URING_NVME
+
+int os_Submit_Async_IO(tDevice *device, asyncIOQueue *queue, asyncIOSlot *slot)
+{
+    sg_io_hdr_t *io_hdr = NULL;
+    if (!queue->osContext)
+    {
+        return NOT_SUPPORTED;
+    }
+    #if defined (SEA_IO_URING_NVME)
+    if (queue->osContext == device->os_info.ioUring)
+    {
+        return submit_IO_Uring_NVMe_IO(device, device->os_info.ioUring, slot);
+    }
+    #endif
+    io_hdr = &((sg_io_hdr_t*)queue->osContext)[slot - queue->slots];
+    memset(io_hdr, 0, sizeof(sg_io_hdr_t));
+    io_hdr->interface_id = 'S';
+    io_hdr->cmd_len = slot->cdbLength;
+    io_hdr->cmdp = slot->cdb;
+    io_hdr->mx_sb_len = SPC3_SENSE_LEN;
+    io_hdr->sbp = slot->senseData;
+    io_hdr->dxfer_direction = slot->write ? SG_DXFER_TO_DEV : SG_DXFER_FROM_DEV;
+    io_hdr->dxfer_len = slot->dataSize;
+    io_hdr->dxferp = slot->ptrData;
+    if (is_Device_Pool_Buffer(device, slot->ptrData, slot->dataSize))
+    {
+        io_hdr->flags |= SG_FLAG_DIRECT_IO;
+    }
+    io_hdr->timeout = get_SG_Timeout_Milliseconds(device);
+    io_hdr->pack_id = (int)slot->tag;
+    io_hdr->usr_ptr = slot;
+    if (write(device->os_info.fd, io_hdr, sizeof(sg_io_hdr_t)) < 0)
+    {
+        device->os_info.last_error = errno;
+        if (VERBOSITY_COMMAND_VERBOSE <= device->deviceVerbosity)
+        {
+            printf("Error submitting async IO: ");
+            print_Errno_To_Screen(device->os_info.last_error);
+        }
+        return OS_PASSTHROUGH_FAILURE;
+    }
+    return SUCCESS;
+}
+
+int os_Reap_Async_IO(tDevice *device, asyncIOQueue *queue, uint32_t timeoutMilliseconds, asyncIOSlot **completedSlot)
+{
+    sg_io_hdr_t io_hdr;
+    struct pollfd pollHandle;
+    int pollTimeout = timeoutMilliseconds == ASYNC_IO_INFINITE_WAIT ? -1 : (int)M_Min(timeoutMilliseconds, INT_MAX);
+    asyncIOSlot *slot = NULL;
+    if (!queue->osContext || !completedSlot)
+    {
+        return NOT_SUPPORTED;
+    }
+    *completedSlot = NULL;
+    #if defined (SEA_IO_URING_NVME)
+    if (queue->osContext == device->os_info.ioUring)
+    {
+        return reap_IO_Uring_NVMe_IO(device, device->os_info.ioUring, timeoutMilliseconds, completedSlot);
+    }
+    #endif
+    memset(&pollHandle, 0, sizeof(struct pollfd));
+    pollHandle.fd = device->os_info.fd;
+    pollHandle.events = POLLIN;
+    int pollRet = poll(&pollHandle, 1, pollTimeout);
+    if (pollRet == 0 || (pollRet < 0 && errno == EINTR))
+    {
+        return IN_PROGRESS;
+    }
+    else if (pollRet < 0)
+    {
+        device->os_info.last_error = errno;
+        return OS_PASSTHROUGH_FAILURE;
+    }
+    memset(&io_hdr, 0, sizeof(sg_io_hdr_t));
+    io_hdr.interface_id = 'S';
+    io_hdr.pack_id = -1;//any finished command
+    if (read(device->os_info.fd, &io_hdr, sizeof(sg_io_hdr_t)) < 0)
+    {
+        device->os_info.last_error = errno;
+        if (errno == EAGAIN || errno == EINTR)
+        {
+            return IN_PROGRESS;
+        }
+        return OS_PASSTHROUGH_FAILURE;
+    }
+    slot = (asyncIOSlot*)io_hdr.usr_ptr;
+    if (!slot || slot < queue->slots || slot >= (queue->slots + queue->queueDepth))
+    {
+        return OS_PASSTHROUGH_FAILURE;
+    }
+    slot->commandTimeNanoSeconds = (uint64_t)io_hdr.duration * UINT64_C(1000000);
+    slot->result = SUCCESS;
+    if ((io_hdr.info & SG_INFO_OK_MASK) != SG_INFO_OK && io_hdr.sb_len_wr == 0)
+    {
+        //error with no sense data to explain it, so the layers above cannot tell what happened.
+        slot->result = OS_PASSTHROUGH_FAILURE;
+    }
+    *completedSlot = slot;
+    return SUCCESS;
+}
+
+void os_Async_IO_Cleanup(tDevice *device, asyncIOQueue *queue)
+{
+    #if defined (SEA_IO_URING_NVME)
+    if (queue->osContext == device->os_info.ioUring)
+    {
+        //Ring stays open with the device. It is released in close_Device.
+        queue->osContext = NULL;
+        return;
+    }
+    #endif
+    safe_Free(queue->osContext);
 }
@@ -18,6 +18,7 @@
 #include "scsi_helper.h"
 #include "nvme_helper.h"
 #include "nvme_helper_func.h"
+#include "cmds.h"
 
 //This file is written based on what is described in the SCSI to NVMe translation white paper (SNTL).
 //Some things that are clearly wrong (incorrect bit or offset, etc) are fixed as this was written. Most of these are noted in comments.
@@ -104,13 +105,14 @@ void sntl_Set_Sense_Data_For_Translation(uint8_t *sensePtr, uint32_t senseDataLe
             uint32_t descriptorOffset = 0;
             while (counter < descriptorCount)
             {
-                descriptorLength = descriptor[descriptorOffset + 1] + 1;
-                memcpy(&senseData[senseDataOffset], descriptor, descriptorLength);
+                //descriptor length is the additional length plus the type and additional length bytes
+                descriptorLength = descriptor[descriptorOffset + 1] + 2;
+                memcpy(&senseData[senseDataOffset], &descriptor[descriptorOffset], descriptorLength);
                 additionalSenseLength += descriptorLength;
                 ++counter;
                 descriptorOffset += descriptorLength;
                 senseDataOffset += descriptorLength;
-                if (descriptor[descriptorOffset] == 9)
+                if (counter < descriptorCount && descriptor[descriptorOffset] == 9)
                 {
                     descriptorOffset += 1;//adding 1 since we put the log index in one extra byte, which is non standard and not part of the actual descriptor. This handles going on to the next descriptor in the list properly. We don't return this byte in the descriptor anyways
                 }
@@ -1452,8 +1454,9 @@ int sntl_Translate_Block_Limits_VPD_Page_B0h(tDevice *device, ScsiIoCtx *scsiIoC
     //unmap stuff
     if (device->drive_info.IdentifyData.nvme.ctrl.oncs & BIT2)
     {
+        //The translator sends as many dataset management commands as it takes, so the only limits are what fits in one UNMAP parameter list
         uint32_t unmapLBACount = UINT32_MAX;
-        uint32_t unmapMaxBlockDescriptors = 256;
+        uint32_t unmapMaxBlockDescriptors = (UINT16_MAX - 8) / 16;
         //maximum unmap LBA count (unspecified....we decide)
         blockLimits[20] = M_Byte3(unmapLBACount);
         blockLimits[21] = M_Byte2(unmapLBACount);
@@ -2017,7 +2020,7 @@ int sntl_Translate_Temperature_Log_0x0D(tDevice *device, ScsiIoCtx *scsiIoCtx)
     temperatureLog[1] = 0x00;
     if (parameterPointer <= 0)
     {
-        if (SUCCESS != nvme_Get_Log_Page(device, &getSMARTHealthData))
+        if (SUCCESS != nvme_Get_Log_Page_Cached(device, &getSMARTHealthData))
         {
             set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
             return FAILURE;
@@ -2107,7 +2110,7 @@ int sntl_Translate_Solid_State_Media_Log_0x11(tDevice *device, ScsiIoCtx *scsiIo
     if (parameterPointer <= 1)
     {
         //endurance
-        if (SUCCESS != nvme_Get_Log_Page(device, &getSMARTHealthData))
+        if (SUCCESS != nvme_Get_Log_Page_Cached(device, &getSMARTHealthData))
         {
             set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
             return FAILURE;
@@ -2152,7 +2155,7 @@ int sntl_Translate_Informational_Exceptions_Log_Page_2F(tDevice *device, ScsiIoC
         //request for controller wide data
         getSMARTHealthData.nsid = UINT32_MAX;//or zero?
     }
-    if (SUCCESS != nvme_Get_Log_Page(device, &getSMARTHealthData))
+    if (SUCCESS != nvme_Get_Log_Page_Cached(device, &getSMARTHealthData))
     {
         set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
         return FAILURE;
@@ -2224,7 +2227,7 @@ int sntl_Translate_Background_Scan_Results_Log_0x15(tDevice *device, ScsiIoCtx *
         //request for controller wide data
         readSmartLog.nsid = UINT32_MAX;//or zero?
     }
-    if (SUCCESS != nvme_Get_Log_Page(device, &readSmartLog))
+    if (SUCCESS != nvme_Get_Log_Page_Cached(device, &readSmartLog))
     {
         set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
         return FAILURE;
@@ -2303,7 +2306,7 @@ int sntl_Translate_General_Statistics_And_Performance_Log_0x19(tDevice *device,
         //request for controller wide data
         readSmartLog.nsid = UINT32_MAX;//or zero?
     }
-    if (SUCCESS != nvme_Get_Log_Page(device, &readSmartLog))
+    if (SUCCESS != nvme_Get_Log_Page_Cached(device, &readSmartLog))
     {
         set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
         return FAILURE;
@@ -4270,6 +4273,12 @@ int sntl_Translate_SCSI_Synchronize_Cache_Command(tDevice *device, ScsiIoCtx *sc
     return ret;
 }
 
+//Bytes per logical block in the host buffer. This is more than the logical block size when the namespace is formatted with metadata (or PI) transferred as part of an extended LBA.
+static uint32_t sntl_Host_Block_Stride(ScsiIoCtx *scsiIoCtx, uint32_t transferLength)
+{
+    return transferLength > 0 ? scsiIoCtx->dataLength / transferLength : 0;
+}
+
 //TODO: DPO bit
 int sntl_Translate_SCSI_Read_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
 {
@@ -4381,7 +4390,7 @@ int sntl_Translate_SCSI_Read_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
     {
         return SUCCESS;
     }
-    else if (transferLength > 65536)//not issuing multiple commands...
+    else if ((uint64_t)transferLength * M_Max(sntl_Host_Block_Stride(scsiIoCtx, transferLength), device->drive_info.deviceBlockSize) > UINT32_MAX)//larger transfers are split into multiple commands, but the total must still fit in a 32bit byte count
     {
         //return an error
         switch (scsiIoCtx->cdb[OPERATION_CODE])
@@ -4426,8 +4435,24 @@ int sntl_Translate_SCSI_Read_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
             return UNKNOWN;
         }
     }
-    int ret = nvme_Read(device, lba, transferLength - 1, false, fua, pi, scsiIoCtx->pdata, scsiIoCtx->dataLength);
-    set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
+    int ret = SUCCESS;
+    uint32_t maxBlocks = M_Min(get_Max_Transfer_Length_Blocks(device), UINT32_C(65536));
+    if (transferLength <= maxBlocks)
+    {
+        ret = nvme_Read(device, lba, (uint16_t)(transferLength - 1), false, fua, pi, scsiIoCtx->pdata, scsiIoCtx->dataLength);
+        set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
+        return ret;
+    }
+    //too large for one command (MDTS or the 16bit block count), so split it up and stop at the first failure
+    //Chunks are laid out in the host buffer with the same per block stride as the whole transfer so that extended LBA metadata stays with its block
+    uint32_t blockStride = sntl_Host_Block_Stride(scsiIoCtx, transferLength);
+    for (uint32_t blocksDone = 0; ret == SUCCESS && blocksDone < transferLength;)
+    {
+        uint32_t chunkBlocks = M_Min(maxBlocks, transferLength - blocksDone);
+        ret = nvme_Read(device, lba + blocksDone, (uint16_t)(chunkBlocks - 1), false, fua, pi, scsiIoCtx->pdata + (blocksDone * blockStride), chunkBlocks * blockStride);
+        set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
+        blocksDone += chunkBlocks;
+    }
     return ret;
 }
 
@@ -4542,7 +4567,7 @@ int sntl_Translate_SCSI_Write_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
         //a transfer length of zero means do nothing but validate inputs and is not an error
         return SUCCESS;
     }
-    else if (transferLength > 65536)
+    else if ((uint64_t)transferLength * M_Max(sntl_Host_Block_Stride(scsiIoCtx, transferLength), device->drive_info.deviceBlockSize) > UINT32_MAX)//larger transfers are split into multiple commands, but the total must still fit in a 32bit byte count
     {
         //return an error
         switch (scsiIoCtx->cdb[OPERATION_CODE])
@@ -4587,8 +4612,24 @@ int sntl_Translate_SCSI_Write_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
             return UNKNOWN;
         }
     }
-    int ret = nvme_Write(device, lba, transferLength - 1, false, fua, pi, 0, scsiIoCtx->pdata, scsiIoCtx->dataLength);
-    set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
+    int ret = SUCCESS;
+    uint32_t maxBlocks = M_Min(get_Max_Transfer_Length_Blocks(device), UINT32_C(65536));
+    if (transferLength <= maxBlocks)
+    {
+        ret = nvme_Write(device, lba, (uint16_t)(transferLength - 1), false, fua, pi, 0, scsiIoCtx->pdata, scsiIoCtx->dataLength);
+        set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
+        return ret;
+    }
+    //too large for one command (MDTS or the 16bit block count), so split it up and stop at the first failure
+    //Chunks are laid out in the host buffer with the same per block stride as the whole transfer so that extended LBA metadata stays with its block
+    uint32_t blockStride = sntl_Host_Block_Stride(scsiIoCtx, transferLength);
+    for (uint32_t blocksDone = 0; ret == SUCCESS && blocksDone < transferLength;)
+    {
+        uint32_t chunkBlocks = M_Min(maxBlocks, transferLength - blocksDone);
+        ret = nvme_Write(device, lba + blocksDone, (uint16_t)(chunkBlocks - 1), false, fua, pi, 0, scsiIoCtx->pdata + (blocksDone * blockStride), chunkBlocks * blockStride);
+        set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
+        blocksDone += chunkBlocks;
+    }
     return ret;
 }
 
@@ -4936,7 +4977,7 @@ int sntl_Translate_SCSI_Report_Luns_Command(tDevice *device, ScsiIoCtx *scsiIoCt
         //read the identify active namespace list
     {
         bool singleLun = false;
-        uint8_t* activeNamespaces = (uint8_t*)calloc_aligned(4096, sizeof(uint8_t), device->os_info.minimumAlignment);
+        uint8_t* activeNamespaces = lease_Device_Buffer(device, 4096);
         if (activeNamespaces)
         {
             if (SUCCESS == nvme_Identify(device, activeNamespaces, 0, 2))
@@ -4985,7 +5026,7 @@ int sntl_Translate_SCSI_Report_Luns_Command(tDevice *device, ScsiIoCtx *scsiIoCt
             //dummy up a single lun
             singleLun = true;
         }
-        safe_Free_aligned(activeNamespaces);
+        safe_Return_Device_Buffer(device, activeNamespaces);
         if (singleLun)
         {
             reportLunsDataLength += 8;
@@ -5897,15 +5938,12 @@ int sntl_Translate_SCSI_Unmap_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
         uint16_t unmapBlockDescriptorLength = (M_BytesTo2ByteValue(scsiIoCtx->pdata[2], scsiIoCtx->pdata[3]) / 16) * 16;//this can be set to zero, which is NOT an error. Also, I'm making sure this is a multiple of 16 to avoid partial block descriptors-TJE
         if (unmapBlockDescriptorLength > 0)
         {
-            uint8_t *dsmBuffer = (uint8_t*)calloc_aligned(4096, sizeof(uint8_t), device->os_info.minimumAlignment);//allocate the max size the device supports...we'll fill in as much as we need to
             //need to check to make sure there weren't any truncated block descriptors before we begin
             uint16_t minBlockDescriptorLength = M_Min(unmapBlockDescriptorLength + 8, parameterListLength);
-            uint16_t unmapBlockDescriptorIter = 8;
-            uint64_t numberOfLBAsToDeallocate = 0;//this will be checked later to make sure it isn't greater than what we reported on the VPD pages
-            uint16_t numberOfBlockDescriptors = 0;//this will be checked later to make sure it isn't greater than what we reported on the VPD pages
-            uint16_t nvmeDSMOffset = 0;
             uint32_t numberOfRanges = 0;
-            if (!dsmBuffer)
+            uint8_t *rangeBuffer = lease_Device_Buffer(device, (uint32_t)(((minBlockDescriptorLength - 8) / 16 + 1) * sizeof(deallocateRange)));
+            deallocateRange *ranges = (deallocateRange*)rangeBuffer;
+            if (!rangeBuffer)
             {
                 //lets just set this error for now...-TJE
                 fieldPointer = 7;
@@ -5914,10 +5952,9 @@ int sntl_Translate_SCSI_Unmap_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
                 sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x1A, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
                 return MEMORY_FAILURE;
             }
-            //start building the buffer to transfer with data set management
-            for (; unmapBlockDescriptorIter < minBlockDescriptorLength; unmapBlockDescriptorIter += 16, numberOfBlockDescriptors++)
+            //collect the block descriptors. The deallocation engine sorts and merges them, then sends as many dataset management commands as it takes.
+            for (uint16_t unmapBlockDescriptorIter = 8; unmapBlockDescriptorIter + 16 <= minBlockDescriptorLength; unmapBlockDescriptorIter += 16)
             {
-                bool exitLoop = false;
                 uint64_t unmapLogicalBlockAddress = M_BytesTo8ByteValue(scsiIoCtx->pdata[unmapBlockDescriptorIter + 0], scsiIoCtx->pdata[unmapBlockDescriptorIter + 1], scsiIoCtx->pdata[unmapBlockDescriptorIter + 2], scsiIoCtx->pdata[unmapBlockDescriptorIter + 3], scsiIoCtx->pdata[unmapBlockDescriptorIter + 4], scsiIoCtx->pdata[unmapBlockDescriptorIter + 5], scsiIoCtx->pdata[unmapBlockDescriptorIter + 6], scsiIoCtx->pdata[unmapBlockDescriptorIter + 7]);
                 uint32_t unmapNumberOfLogicalBlocks = M_BytesTo4ByteValue(scsiIoCtx->pdata[unmapBlockDescriptorIter + 8], scsiIoCtx->pdata[unmapBlockDescriptorIter + 9], scsiIoCtx->pdata[unmapBlockDescriptorIter + 10], scsiIoCtx->pdata[unmapBlockDescriptorIter + 11]);
                 if (unmapNumberOfLogicalBlocks == 0)
@@ -5925,8 +5962,6 @@ int sntl_Translate_SCSI_Unmap_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
                     //nothing to unmap...
                     continue;
                 }
-                //increment this so we can check if we were given more to do than we support (to be checked after the loop)
-                numberOfLBAsToDeallocate += unmapNumberOfLogicalBlocks;
                 //check we aren't trying to go over the end of the drive
                 if (unmapLogicalBlockAddress > device->drive_info.deviceMaxLba)
                 {
@@ -5935,94 +5970,47 @@ int sntl_Translate_SCSI_Unmap_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
                     sntl_Set_Sense_Key_Specific_Descriptor_Invalid_Field(senseKeySpecificDescriptor, false, true, bitPointer, fieldPointer);
                     ret = FAILURE;
                     sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x21, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
-                    exitLoop = true;
                     break;
                 }
-                else if (unmapLogicalBlockAddress + unmapNumberOfLogicalBlocks > device->drive_info.deviceMaxLba)
+                else if (unmapNumberOfLogicalBlocks > device->drive_info.deviceMaxLba - unmapLogicalBlockAddress + 1)
                 {
                     fieldPointer = unmapBlockDescriptorIter + 8;
                     bitPointer = 7;
                     sntl_Set_Sense_Key_Specific_Descriptor_Invalid_Field(senseKeySpecificDescriptor, false, true, bitPointer, fieldPointer);
                     ret = FAILURE;
                     sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x21, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, senseKeySpecificDescriptor, 1);
-                    exitLoop = true;
                     break;
                 }
-                //check that we haven't had too many block descriptors yet
-                if (numberOfBlockDescriptors > (255))//max of 255 ranges
+                ranges[numberOfRanges].lba = unmapLogicalBlockAddress;
+                ranges[numberOfRanges].length = unmapNumberOfLogicalBlocks;
+                ++numberOfRanges;
+            }
+            if (ret == SUCCESS)
+            {
+                switch (deallocate_LBA_Ranges(device, ranges, numberOfRanges))
                 {
-                    //not setting sense key specific information because it's not clear in this condition what error we should point to
+                case SUCCESS:
+                    break;
+                //These are returned before any command is sent, so there is no command status to build sense data from
+                case NOT_SUPPORTED:
                     ret = FAILURE;
-                    sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x26, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                    exitLoop = true;
+                    sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x20, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
                     break;
-                }
-                //check that we haven't been asked to TRIM more LBAs than we care to support in this code
-                if (numberOfLBAsToDeallocate > (UINT64_C(255) * UINT32_MAX))//max of 255 ranges * UINT32_MAX for number LBAs in each range
-                {
-                    //not setting sense key specific information because it's not clear in this condition what error we should point to
+                case BAD_PARAMETER:
                     ret = FAILURE;
-                    sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x26, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
-                    exitLoop = true;
+                    sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ILLEGAL_REQUEST, 0x21, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
                     break;
-                }
-                //now that we've done all of our checks so far, start setting up the buffer
-                //break this block descriptor into multiple ATA entries if necessary
-                while (unmapNumberOfLogicalBlocks > 0)
-                {
-                    //range
-                    dsmBuffer[nvmeDSMOffset + 4] = M_Byte3(unmapNumberOfLogicalBlocks);
-                    dsmBuffer[nvmeDSMOffset + 5] = M_Byte2(unmapNumberOfLogicalBlocks);
-                    dsmBuffer[nvmeDSMOffset + 6] = M_Byte1(unmapNumberOfLogicalBlocks);
-                    dsmBuffer[nvmeDSMOffset + 7] = M_Byte0(unmapNumberOfLogicalBlocks);
-                    ++numberOfRanges;
-                    //lba
-                    dsmBuffer[nvmeDSMOffset + 8] = M_Byte7(unmapLogicalBlockAddress);
-                    dsmBuffer[nvmeDSMOffset + 9] = M_Byte6(unmapLogicalBlockAddress);
-                    dsmBuffer[nvmeDSMOffset + 10] = M_Byte5(unmapLogicalBlockAddress);
-                    dsmBuffer[nvmeDSMOffset + 11] = M_Byte4(unmapLogicalBlockAddress);
-                    dsmBuffer[nvmeDSMOffset + 12] = M_Byte3(unmapLogicalBlockAddress);
-                    dsmBuffer[nvmeDSMOffset + 13] = M_Byte2(unmapLogicalBlockAddress);
-                    dsmBuffer[nvmeDSMOffset + 14] = M_Byte1(unmapLogicalBlockAddress);
-                    dsmBuffer[nvmeDSMOffset + 15] = M_Byte0(unmapLogicalBlockAddress);
-                    
-                    //now increment the nvmeDSMOffset
-                    nvmeDSMOffset += 16;
-                    //check if the NVMe DSM buffer is full...if it is and there are more or potentially more block descriptors, send the command now
-                    if ((nvmeDSMOffset > 4096) && ((unmapBlockDescriptorIter + 16) < minBlockDescriptorLength))
-                    {
-                        if(SUCCESS == nvme_Dataset_Management(device, numberOfRanges, true, false, false, dsmBuffer, 4096))
-                        {
-                            //clear the buffer for reuse
-                            memset(dsmBuffer, 0, device->drive_info.IdentifyData.ata.Word105 * LEGACY_DRIVE_SEC_SIZE);
-                            //reset the ataTrimOffset
-                            nvmeDSMOffset = 0;
-                            numberOfRanges = 0;
-                        }
-                        else
-                        {
-                            ret = FAILURE;
-                            set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
-                            exitLoop = true;
-                            break;
-                        }
-                    }
-                }
-                if (exitLoop)
-                {
+                case MEMORY_FAILURE:
+                    ret = FAILURE;
+                    sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_ABORTED_COMMAND, 0x55, 0x03, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
                     break;
-                }
-            }
-            if (ret == SUCCESS)
-            {
-                //send the data set management command with whatever is in the trim buffer at this point (all zeros is safe to send if we do get that)
-                if (SUCCESS != nvme_Dataset_Management(device, numberOfRanges, true, false, false, dsmBuffer, 4096))
-                {
+                default:
                     ret = FAILURE;
                     set_Sense_Data_By_NVMe_Status(device, device->drive_info.lastNVMeResult.lastNVMeStatus, scsiIoCtx->psense, scsiIoCtx->senseDataSize);
+                    break;
                 }
             }
-            safe_Free_aligned(dsmBuffer);
+            safe_Return_Device_Buffer(device, rangeBuffer);
         }
     }
     return ret;
@@ -9386,7 +9374,15 @@ int sntl_Translate_SCSI_Report_Supported_Operation_Codes_Command(tDevice *device
     switch (reportingOptions)
     {
     case 0://return all op codes (return not supported for now until we get the other methods working...)
-        ret = sntl_Create_All_Supported_Op_Codes_Buffer(device, rctd, &supportedOpData, &supportedOpDataLength);
+        {
+            const uint8_t *allOpCodes = NULL;
+            uint32_t allOpCodesLength = 0;
+            ret = get_Memoized_Supported_Op_Codes(device, rctd, sntl_Create_All_Supported_Op_Codes_Buffer, &allOpCodes, &allOpCodesLength);
+            if (ret == SUCCESS && scsiIoCtx->pdata)
+            {
+                memcpy(scsiIoCtx->pdata, allOpCodes, M_Min(allOpCodesLength, allocationLength));
+            }
+        }
         break;
     case 1://check operation code, service action ignored
         //check op code func
@@ -9432,10 +9428,41 @@ int sntl_Translate_SCSI_Report_Supported_Operation_Codes_Command(tDevice *device
     return ret;
 }
 
+//Commands that use the capacity or block size from the complete tier of driveInfo. Only these finish lazy discovery so that commands like test unit ready and inquiry do not touch the media.
+static bool sntl_Command_Needs_Complete_Drive_Info(ScsiIoCtx *scsiIoCtx)
+{
+    switch (scsiIoCtx->cdb[OPERATION_CODE])
+    {
+    case READ6:
+    case READ10:
+    case READ12:
+    case READ16:
+    case WRITE6:
+    case WRITE10:
+    case WRITE12:
+    case WRITE16:
+    case VERIFY10:
+    case VERIFY12:
+    case VERIFY16:
+    case WRITE_AND_VERIFY_10:
+    case WRITE_AND_VERIFY_12:
+    case WRITE_AND_VERIFY_16:
+    case READ_CAPACITY_10:
+    case UNMAP_CMD:
+    case WRITE_SAME_10_CMD:
+    case WRITE_SAME_16_CMD:
+    case SCSI_FORMAT_UNIT_CMD:
+        return true;
+    case 0x9E:
+        return (scsiIoCtx->cdb[1] & 0x1F) == 0x10;//read capacity 16
+    default:
+        return false;
+    }
+}
+
 //always sets Descriptor type sense data
 int sntl_Translate_SCSI_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
 {
-    static bool deviceInfoAvailable = false;
     int ret = UNKNOWN;
     bool invalidFieldInCDB = false;
     bool invalidOperationCode = false;
@@ -9473,8 +9500,12 @@ int sntl_Translate_SCSI_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
         return SUCCESS;
     }
     sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
+    if (sntl_Command_Needs_Complete_Drive_Info(scsiIoCtx))
+    {
+        complete_Lazy_Drive_Info_Data(device);
+    }
     //if the ataIdentify data is zero, send an identify at least once so we aren't sending that every time we do a read or write command...inquiry, read capacity will always do one though to get the most recent data
-    if (!deviceInfoAvailable)
+    if (!device->drive_info.softSATFlags.deviceInfoAvailable)
     {
         uint8_t zeroData[NVME_IDENTIFY_DATA_LEN] = { 0 };
         if (memcmp(&device->drive_info.IdentifyData.nvme.ctrl, zeroData, LEGACY_DRIVE_SEC_SIZE) == 0)
@@ -9484,12 +9515,12 @@ int sntl_Translate_SCSI_Command(tDevice *device, ScsiIoCtx *scsiIoCtx)
             {
                 return FAILURE;
             }
-            deviceInfoAvailable = true;
+            device->drive_info.softSATFlags.deviceInfoAvailable = true;
             sntl_Set_Sense_Data_For_Translation(scsiIoCtx->psense, scsiIoCtx->senseDataSize, SENSE_KEY_NO_ERROR, 0, 0, device->drive_info.softSATFlags.senseDataDescriptorFormat, NULL, 0);
         }
         else
         {
-            deviceInfoAvailable = true;
+            device->drive_info.softSATFlags.deviceInfoAvailable = true;
         }
     }
     //start checking the scsi command and call the function to translate it
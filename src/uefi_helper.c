@@ -1776,6 +1776,11 @@ int os_nvme_Subsystem_Reset(tDevice *device)
 
 int close_Device(tDevice *device)
 {
+    stop_Async_IO(device);
+    free_Zone_Map(device);
+    stop_Device_Buffer_Pool(device);
+    stop_Device_Log_Cache(device);
+    free_Memoized_Supported_Op_Codes(device);
     return NOT_SUPPORTED;
 }
 
@@ -2397,3 +2402,23 @@ int os_Flush(tDevice *device)
 {
     return NOT_SUPPORTED;
 }
+
+int os_Async_IO_Init(tDevice *device, asyncIOQueue *queue)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Submit_Async_IO(tDevice *device, asyncIOQueue *queue, asyncIOSlot *slot)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Reap_Async_IO(tDevice *device, asyncIOQueue *queue, uint32_t timeoutMilliseconds, asyncIOSlot **completedSlot)
+{
+    return NOT_SUPPORTED;
+}
+
+void os_Async_IO_Cleanup(tDevice *device, asyncIOQueue *queue)
+{
+    return;
+}
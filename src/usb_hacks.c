@@ -21,18 +21,190 @@
 #include "common.h"
 
 
+//Order to try legacy passthroughs in when nothing has been learned about a bridge yet. This is roughly how often each one is found on products in the field.
+//SAT is by far the most common. PSP should always be last since it is not clear it was ever used.
+static const ePassthroughType defaultATAPassthroughProbeOrder[] = { ATA_PASSTHROUGH_SAT, ATA_PASSTHROUGH_CYPRESS, ATA_PASSTHROUGH_NEC, ATA_PASSTHROUGH_PROLIFIC, ATA_PASSTHROUGH_TI, ATA_PASSTHROUGH_PSP };
+#define ATA_PASSTHROUGH_PROBE_COUNT (sizeof(defaultATAPassthroughProbeOrder) / sizeof(defaultATAPassthroughProbeOrder[0]))
+
+static char passthroughLearningFile[4096] = { 0 };
+
+int set_USB_Passthrough_Learning_File(const char *path)
+{
+    if (!path)
+    {
+        memset(passthroughLearningFile, 0, sizeof(passthroughLearningFile));
+        return SUCCESS;
+    }
+    if (strlen(path) >= sizeof(passthroughLearningFile))
+    {
+        return BAD_PARAMETER;
+    }
+    snprintf(passthroughLearningFile, sizeof(passthroughLearningFile), "%s", path);
+    return SUCCESS;
+}
+
+//Returns the index of a passthrough type in the probe order table, or ATA_PASSTHROUGH_PROBE_COUNT if it is not in the table.
+static uint8_t get_Passthrough_Probe_Index(uint32_t type)
+{
+    uint8_t probeIter = 0;
+    for (; probeIter < ATA_PASSTHROUGH_PROBE_COUNT; ++probeIter)
+    {
+        if (defaultATAPassthroughProbeOrder[probeIter] == (ePassthroughType)type)
+        {
+            break;
+        }
+    }
+    return probeIter;
+}
+
+//One adapter's entry from the learned passthrough file
+typedef struct _learnedPassthroughEntry
+{
+    uint32_t infoType;
+    uint32_t vendorID;
+    uint32_t productID;
+    uint32_t revision;
+    uint32_t type;
+}learnedPassthroughEntry;
+
+//Reads the learned passthrough file. Each line is "<adapter info type> <vendor ID> <product ID> <revision> <passthrough type>" with IDs in hex.
+//The file is append-only, so only the last entry for each adapter counts.
+//Returns true if a passthrough was learned for this adapter. successCounts is filled with how many adapters use each type in the probe order table.
+static bool read_Learned_Passthrough(tDevice *device, ePassthroughType *learnedType, uint32_t successCounts[ATA_PASSTHROUGH_PROBE_COUNT])
+{
+    bool found = false;
+    char line[128] = { 0 };
+    uint32_t revision = device->drive_info.adapter_info.revisionValid ? device->drive_info.adapter_info.revision : UINT32_MAX;
+    learnedPassthroughEntry *entries = NULL;
+    uint32_t entryCount = 0, entryCapacity = 0;
+    FILE *learnedFile = NULL;
+    if (passthroughLearningFile[0] == '\0')
+    {
+        return false;
+    }
+    learnedFile = fopen(passthroughLearningFile, "r");
+    if (!learnedFile)
+    {
+        return false;
+    }
+    while (fgets(line, sizeof(line), learnedFile))
+    {
+        learnedPassthroughEntry entry;
+        uint32_t entryIter = 0;
+        if (5 != sscanf(line, "%" SCNu32 " %" SCNx32 " %" SCNx32 " %" SCNx32 " %" SCNu32, &entry.infoType, &entry.vendorID, &entry.productID, &entry.revision, &entry.type))
+        {
+            continue;
+        }
+        if (get_Passthrough_Probe_Index(entry.type) == ATA_PASSTHROUGH_PROBE_COUNT)
+        {
+            //not a passthrough this version knows about
+            continue;
+        }
+        //later entries for the same adapter replace earlier ones
+        for (entryIter = 0; entryIter < entryCount; ++entryIter)
+        {
+            if (entries[entryIter].infoType == entry.infoType && entries[entryIter].vendorID == entry.vendorID && entries[entryIter].productID == entry.productID && entries[entryIter].revision == entry.revision)
+            {
+                break;
+            }
+        }
+        if (entryIter == entryCount)
+        {
+            if (entryCount == entryCapacity)
+            {
+                uint32_t newCapacity = entryCapacity == 0 ? 16 : entryCapacity * 2;
+                learnedPassthroughEntry *grown = (learnedPassthroughEntry*)realloc(entries, newCapacity * sizeof(learnedPassthroughEntry));
+                if (!grown)
+                {
+                    break;
+                }
+                entries = grown;
+                entryCapacity = newCapacity;
+            }
+            ++entryCount;
+        }
+        entries[entryIter] = entry;
+    }
+    fclose(learnedFile);
+    for (uint32_t entryIter = 0; entryIter < entryCount; ++entryIter)
+    {
+        ++successCounts[get_Passthrough_Probe_Index(entries[entryIter].type)];
+        if (entries[entryIter].infoType == (uint32_t)device->drive_info.adapter_info.infoType && entries[entryIter].vendorID == device->drive_info.adapter_info.vendorID && entries[entryIter].productID == device->drive_info.adapter_info.productID && entries[entryIter].revision == revision)
+        {
+            *learnedType = (ePassthroughType)entries[entryIter].type;
+            found = true;
+        }
+    }
+    safe_Free(entries);
+    return found;
+}
+
+static void save_Learned_Passthrough(tDevice *device)
+{
+    char line[128] = { 0 };
+    uint32_t revision = device->drive_info.adapter_info.revisionValid ? device->drive_info.adapter_info.revision : UINT32_MAX;
+    FILE *learnedFile = NULL;
+    if (passthroughLearningFile[0] == '\0')
+    {
+        return;
+    }
+    learnedFile = fopen(passthroughLearningFile, "a");
+    if (!learnedFile)
+    {
+        return;
+    }
+    //one write per line so that devices discovered in parallel do not interleave their entries
+    snprintf(line, sizeof(line), "%" PRIu32 " %04" PRIX32 " %04" PRIX32 " %04" PRIX32 " %" PRIu32 "\n", (uint32_t)device->drive_info.adapter_info.infoType, device->drive_info.adapter_info.vendorID, device->drive_info.adapter_info.productID, revision, (uint32_t)device->drive_info.passThroughHacks.passthroughType);
+    setvbuf(learnedFile, NULL, _IONBF, 0);
+    fputs(line, learnedFile);
+    fclose(learnedFile);
+}
+
 bool set_ATA_Passthrough_Type_By_Trial_And_Error(tDevice *device)
 {
     bool passthroughTypeSet = false;
     if ((device->drive_info.interface_type == USB_INTERFACE || device->drive_info.interface_type == IEEE_1394_INTERFACE)
         && device->drive_info.drive_type == SCSI_DRIVE)
     {
+        ePassthroughType probeOrder[ATA_PASSTHROUGH_PROBE_COUNT];
+        uint32_t successCounts[ATA_PASSTHROUGH_PROBE_COUNT] = { 0 };
+        uint8_t probeCount = 0;
+        ePassthroughType learnedType = ATA_PASSTHROUGH_UNKNOWN;
+        bool learned = false;
+        bool canLearn = device->drive_info.adapter_info.vendorIDValid && device->drive_info.adapter_info.productIDValid;
 #if defined (_DEBUG)
         printf("\n\tAttempting to set USB passthrough type with identify commands\n");
 #endif
-        while (device->drive_info.passThroughHacks.passthroughType != ATA_PASSTHROUGH_UNKNOWN)
+        if (canLearn)
+        {
+            learned = read_Learned_Passthrough(device, &learnedType, successCounts);
+        }
+        //try what worked before on this adapter first, then everything else with the types seen most often on other adapters first.
+        if (learned)
+        {
+            probeOrder[probeCount++] = learnedType;
+        }
+        for (uint8_t probeIter = 0; probeIter < ATA_PASSTHROUGH_PROBE_COUNT; ++probeIter)
+        {
+            uint8_t mostSuccessful = ATA_PASSTHROUGH_PROBE_COUNT;
+            for (uint8_t countIter = 0; countIter < ATA_PASSTHROUGH_PROBE_COUNT; ++countIter)
+            {
+                //UINT32_MAX marks a type already placed in the order. Ties keep the default order.
+                if (successCounts[countIter] != UINT32_MAX && (mostSuccessful == ATA_PASSTHROUGH_PROBE_COUNT || successCounts[countIter] > successCounts[mostSuccessful]))
+                {
+                    mostSuccessful = countIter;
+                }
+            }
+            successCounts[mostSuccessful] = UINT32_MAX;
+            if (!learned || defaultATAPassthroughProbeOrder[mostSuccessful] != learnedType)
+            {
+                probeOrder[probeCount++] = defaultATAPassthroughProbeOrder[mostSuccessful];
+            }
+        }
+        for (uint8_t probeIter = 0; probeIter < probeCount; ++probeIter)
         {
             uint8_t identifyData[LEGACY_DRIVE_SEC_SIZE] = { 0 };
+            device->drive_info.passThroughHacks.passthroughType = probeOrder[probeIter];
             if (SUCCESS == ata_Identify(device, identifyData, LEGACY_DRIVE_SEC_SIZE))
             {
                 //command succeeded so this is most likely the correct pass-through type to use for this device
@@ -49,8 +221,18 @@ bool set_ATA_Passthrough_Type_By_Trial_And_Error(tDevice *device)
                 passthroughTypeSet = true;
                 break;
             }
-            ++device->drive_info.passThroughHacks.passthroughType;
+        }
+        if (passthroughTypeSet)
+        {
+            if (canLearn && (!learned || learnedType != device->drive_info.passThroughHacks.passthroughType))
+            {
+                save_Learned_Passthrough(device);
+            }
+        }
+        else
+        {
+            device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_UNKNOWN;
         }
     }
     return passthroughTypeSet;
-}
\ No newline at end of file
+}
@@ -294,6 +294,11 @@ int close_Device(tDevice *device)
     int retValue = 0;
     if(device)
     {
+        stop_Async_IO(device);
+        free_Zone_Map(device);
+        stop_Device_Buffer_Pool(device);
+        stop_Device_Log_Cache(device);
+        free_Memoized_Supported_Op_Codes(device);
         retValue = close(device->os_info.fd);
         device->os_info.last_error = errno;
         if(retValue == 0)
@@ -463,6 +468,26 @@ int os_Flush(tDevice *device)
     return NOT_SUPPORTED;
 }
 
+int os_Async_IO_Init(tDevice *device, asyncIOQueue *queue)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Submit_Async_IO(tDevice *device, asyncIOQueue *queue, asyncIOSlot *slot)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Reap_Async_IO(tDevice *device, asyncIOQueue *queue, uint32_t timeoutMilliseconds, asyncIOSlot **completedSlot)
+{
+    return NOT_SUPPORTED;
+}
+
+void os_Async_IO_Cleanup(tDevice *device, asyncIOQueue *queue)
+{
+    return;
+}
+
 #if !defined(DISABLE_NVME_PASSTHROUGH)
 int send_NVMe_IO(nvmeCmdCtx *nvmeIoCtx)
 {
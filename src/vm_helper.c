@@ -1823,6 +1823,11 @@ int close_Device(tDevice *dev)
 
     if (dev)
     {
+        stop_Async_IO(dev);
+        free_Zone_Map(dev);
+        stop_Device_Buffer_Pool(dev);
+        stop_Device_Log_Cache(dev);
+        free_Memoized_Supported_Op_Codes(dev);
         if (isNVMe) 
         {
             Nvme_Close(dev->os_info.nvmeFd);
@@ -2086,3 +2091,23 @@ int os_Flush(tDevice *device)
 {
     return NOT_SUPPORTED;
 }
+
+int os_Async_IO_Init(tDevice *device, asyncIOQueue *queue)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Submit_Async_IO(tDevice *device, asyncIOQueue *queue, asyncIOSlot *slot)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Reap_Async_IO(tDevice *device, asyncIOQueue *queue, uint32_t timeoutMilliseconds, asyncIOSlot **completedSlot)
+{
+    return NOT_SUPPORTED;
+}
+
+void os_Async_IO_Cleanup(tDevice *device, asyncIOQueue *queue)
+{
+    return;
+}
@@ -34,6 +34,7 @@
 #include "scsi_helper_func.h"
 #include "ata_helper_func.h"
 #include "win_helper.h"
+#include "cmds.h"
 #include "sat_helper_func.h"
 #include "usb_hacks.h"
 #include "common_public.h"
@@ -1683,6 +1684,11 @@ int close_Device(tDevice *dev)
     int retValue = 0;
     if (dev)
     {
+        stop_Async_IO(dev);
+        free_Zone_Map(dev);
+        stop_Device_Buffer_Pool(dev);
+        stop_Device_Log_Cache(dev);
+        free_Memoized_Supported_Op_Codes(dev);
 #if defined (ENABLE_OFNVME)
         close_SCSI_SRB_Handle(dev);
 #endif
@@ -8682,6 +8688,26 @@ int os_Flush(tDevice *device)
     return ret;
 }
 
+int os_Async_IO_Init(tDevice *device, asyncIOQueue *queue)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Submit_Async_IO(tDevice *device, asyncIOQueue *queue, asyncIOSlot *slot)
+{
+    return NOT_SUPPORTED;
+}
+
+int os_Reap_Async_IO(tDevice *device, asyncIOQueue *queue, uint32_t timeoutMilliseconds, asyncIOSlot **completedSlot)
+{
+    return NOT_SUPPORTED;
+}
+
+void os_Async_IO_Cleanup(tDevice *device, asyncIOQueue *queue)
+{
+    return;
+}
+
 long getpagesize(void)
 {
     //implementation for get page size in windows using the WinAPI